@@ -161,6 +161,7 @@
             math = "math_.*_test";
             block = "block_.*_test";
             multiprecision = "multiprecision_.*_test";
+            parallelization = "parallelization_.*_test";
           };
           makeTestDerivation = { name, compiler, targets ? [ ], buildTargets ? targets, testTargets ? targets }:
             (makeCrypto3Derivation { inherit system; }).overrideAttrs (oldAttrs: {
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_INVERSE_HPP
+#define CRYPTO3_ALGEBRA_BATCH_INVERSE_HPP
+
+#include <iterator>
+#include <vector>
+
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /** @brief Montgomery's simultaneous inversion over [first, last).
+                 *
+                 * Costs one field inversion and 3(n - 1) multiplications. Zero elements are skipped
+                 * and left as zero, so the range does not have to be filtered beforehand.
+                 */
+                template<typename Iterator>
+                void batch_inverse_chunk(Iterator first, Iterator last) {
+                    typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+                    const std::size_t size = std::distance(first, last);
+                    if (size == 0) {
+                        return;
+                    }
+
+                    // prefix[i] holds the product of all non-zero elements before position i
+                    std::vector<value_type> prefix;
+                    prefix.reserve(size);
+
+                    value_type acc = value_type::one();
+                    for (Iterator it = first; it != last; ++it) {
+                        prefix.emplace_back(acc);
+                        if (!it->is_zero()) {
+                            acc = acc * (*it);
+                        }
+                    }
+
+                    acc = acc.inversed();
+
+                    std::size_t i = size;
+                    for (Iterator it = last; it != first;) {
+                        --it;
+                        --i;
+                        if (it->is_zero()) {
+                            continue;
+                        }
+                        const value_type inv = acc * prefix[i];
+                        acc = acc * (*it);
+                        *it = inv;
+                    }
+                }
+
+                inline std::size_t batch_default_chunks_count() {
+                    // to override, install another executor with parallelization::scoped_executor
+                    return parallelization::current_executor().concurrency();
+                }
+            }    // namespace detail
+
+            /** @brief Inverts every element of [first, last) in place.
+             *
+             * The range is split into chunks_count contiguous chunks, each of which performs its own
+             * Montgomery batch inversion, so the total cost is chunks_count inversions plus a linear
+             * number of multiplications. Chunks are processed in parallel on the current executor.
+             * Works for every field value type with is_zero(), one(), inversed() and operator*,
+             * including extension fields. Zero elements remain zero.
+             */
+            template<typename Iterator>
+            void batch_inverse(Iterator first, Iterator last,
+                               std::size_t chunks_count = detail::batch_default_chunks_count()) {
+                const std::size_t total_size = std::distance(first, last);
+
+                if ((total_size < 2 * chunks_count) || (chunks_count <= 1)) {
+                    detail::batch_inverse_chunk(first, last);
+                    return;
+                }
+
+                const std::size_t one_chunk_size = total_size / chunks_count;
+
+                parallelization::parallel_for(0, chunks_count, [&](std::size_t i) {
+                    detail::batch_inverse_chunk(first + i * one_chunk_size,
+                                                (i == chunks_count - 1 ? last : first + (i + 1) * one_chunk_size));
+                });
+            }
+
+            template<typename InputRange>
+            void batch_inverse(InputRange &range, std::size_t chunks_count = detail::batch_default_chunks_count()) {
+                batch_inverse(std::begin(range), std::end(range), chunks_count);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_INVERSE_HPP
@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_NORMALIZE_HPP
+#define CRYPTO3_ALGEBRA_BATCH_NORMALIZE_HPP
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/algebra/algorithms/batch_inverse.hpp>
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/edwards/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /** @brief Rescales a curve element to Z = 1 given the inverse of its Z coordinate.
+                 *
+                 * Specialized per coordinates representation, since the weight of Z differs: jacobian
+                 * coordinates carry (X/Z^2, Y/Z^3), projective and inverted ones carry (X/Z, Y/Z).
+                 * The resulting element stays in its own coordinates, which is what mixed addition expects.
+                 */
+                template<typename Coordinates>
+                struct batch_normalize_policy;
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::affine> {
+                    constexpr static const bool is_normalized = true;
+                };
+
+                struct batch_normalize_jacobian_policy {
+                    constexpr static const bool is_normalized = false;
+
+                    template<typename ElementType, typename FieldValueType>
+                    static inline void process(ElementType &element, const FieldValueType &Z_inv) {
+                        const FieldValueType Z_inv_squared = Z_inv.squared();
+
+                        element.X = element.X * Z_inv_squared;
+                        element.Y = element.Y * Z_inv_squared * Z_inv;
+                        element.Z = FieldValueType::one();
+                    }
+                };
+
+                struct batch_normalize_projective_policy {
+                    constexpr static const bool is_normalized = false;
+
+                    template<typename ElementType, typename FieldValueType>
+                    static inline void process(ElementType &element, const FieldValueType &Z_inv) {
+                        element.X = element.X * Z_inv;
+                        element.Y = element.Y * Z_inv;
+                        element.Z = FieldValueType::one();
+                    }
+                };
+
+                struct batch_normalize_extended_policy {
+                    constexpr static const bool is_normalized = false;
+
+                    template<typename ElementType, typename FieldValueType>
+                    static inline void process(ElementType &element, const FieldValueType &Z_inv) {
+                        element.X = element.X * Z_inv;
+                        element.Y = element.Y * Z_inv;
+                        element.T = element.T * Z_inv;
+                        element.Z = FieldValueType::one();
+                    }
+                };
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::jacobian> : batch_normalize_jacobian_policy { };
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::jacobian_with_a4_0>
+                    : batch_normalize_jacobian_policy { };
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::jacobian_with_a4_minus_3>
+                    : batch_normalize_jacobian_policy { };
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::projective> : batch_normalize_projective_policy { };
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::projective_with_a4_minus_3>
+                    : batch_normalize_projective_policy { };
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::inverted> : batch_normalize_projective_policy { };
+
+                template<>
+                struct batch_normalize_policy<curves::coordinates::extended_with_a_minus_1>
+                    : batch_normalize_extended_policy { };
+
+                template<typename Iterator>
+                void batch_normalize_impl(Iterator first, Iterator last, std::size_t chunks_count,
+                                          std::true_type /* is_normalized */) {
+                }
+
+                template<typename Iterator>
+                void batch_normalize_impl(Iterator first, Iterator last, std::size_t chunks_count,
+                                          std::false_type /* is_normalized */) {
+                    typedef typename std::iterator_traits<Iterator>::value_type element_type;
+                    typedef typename std::remove_cv<decltype(element_type::zero().Z)>::type field_value_type;
+                    typedef batch_normalize_policy<typename element_type::coordinates> policy_type;
+
+                    const std::size_t size = std::distance(first, last);
+
+                    std::vector<field_value_type> Z_inv(size);
+                    parallelization::parallel_for(0, size, [&](std::size_t i) {
+                        Z_inv[i] = first[i].Z;
+                    });
+
+                    batch_inverse(Z_inv, chunks_count);
+
+                    parallelization::parallel_for(0, size, [&](std::size_t i) {
+                        // Z = 0 marks the point at infinity (or an exceptional point of inverted
+                        // coordinates), which has no Z = 1 representative and is left untouched.
+                        if (!Z_inv[i].is_zero()) {
+                            policy_type::process(first[i], Z_inv[i]);
+                        }
+                    });
+                }
+            }    // namespace detail
+
+            /** @brief Brings every curve element of [first, last) to Z = 1 in place.
+             *
+             * All Z coordinates are inverted at once through batch_inverse, so a range of n points
+             * costs chunks_count field inversions instead of n. Points with Z = 0 are kept as is.
+             * Affine elements are already normalized and are not touched.
+             */
+            template<typename Iterator>
+            void batch_normalize(Iterator first, Iterator last,
+                                 std::size_t chunks_count = detail::batch_default_chunks_count()) {
+                typedef typename std::iterator_traits<Iterator>::value_type element_type;
+                typedef detail::batch_normalize_policy<typename element_type::coordinates> policy_type;
+
+                detail::batch_normalize_impl(first, last, chunks_count,
+                                             std::integral_constant<bool, policy_type::is_normalized>());
+            }
+
+            template<typename InputRange>
+            void batch_normalize(InputRange &range, std::size_t chunks_count = detail::batch_default_chunks_count()) {
+                batch_normalize(std::begin(range), std::end(range), chunks_count);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_NORMALIZE_HPP
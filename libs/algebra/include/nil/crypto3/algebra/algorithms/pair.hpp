@@ -26,6 +26,11 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -100,6 +105,30 @@ namespace nil {
                 return PairingPolicy::final_exponentiation::process(f);
             }
 
+            /** @brief Pairing with a G2 argument precomputed once by precompute_g2.
+             *
+             * Fixed G2 points, such as verifying key elements or the generator, keep their line
+             * coefficients across calls, so only the G1 side is precomputed here.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                pair(const typename PairingCurveType::template g1_type<>::value_type &v1,
+                     const typename PairingPolicy::g2_precomputed_type &prec_Q) {
+                typename PairingPolicy::g1_precomputed_type prec_P = PairingPolicy::precompute_g1::process(v1);
+
+                return PairingPolicy::miller_loop::process(prec_P, prec_Q);
+            }
+
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                pair_reduced(const typename PairingCurveType::template g1_type<>::value_type &v1,
+                             const typename PairingPolicy::g2_precomputed_type &prec_Q) {
+                typename PairingPolicy::g1_precomputed_type prec_P = PairingPolicy::precompute_g1::process(v1);
+
+                typename PairingCurveType::gt_type::value_type f = PairingPolicy::miller_loop::process(prec_P, prec_Q);
+                return PairingPolicy::final_exponentiation::process(f);
+            }
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingCurveType::gt_type::value_type
                 double_miller_loop(const typename PairingPolicy::g1_precomputed_type &prec_P1,
@@ -124,6 +153,60 @@ namespace nil {
 
                 return PairingPolicy::miller_loop::process(prec_P, prec_Q);
             }
+
+            namespace detail {
+                template<typename PairingPolicy, typename = void>
+                struct has_multi_miller_loop : std::false_type { };
+
+                template<typename PairingPolicy>
+                struct has_multi_miller_loop<
+                    PairingPolicy,
+                    typename std::enable_if<!std::is_void<typename PairingPolicy::multi_miller_loop>::value>::type>
+                    : std::true_type { };
+
+                template<typename PairingCurveType, typename PairingPolicy>
+                typename PairingCurveType::gt_type::value_type
+                    multi_miller_loop_impl(const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                                           const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q,
+                                           std::true_type /* has_multi_miller_loop */) {
+                    return PairingPolicy::multi_miller_loop::process(prec_P, prec_Q);
+                }
+
+                template<typename PairingCurveType, typename PairingPolicy>
+                typename PairingCurveType::gt_type::value_type
+                    multi_miller_loop_impl(const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                                           const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q,
+                                           std::false_type /* has_multi_miller_loop */) {
+                    typename PairingCurveType::gt_type::value_type f =
+                        PairingCurveType::gt_type::value_type::one();
+
+                    std::size_t i = 0;
+                    for (; i + 1 < prec_P.size(); i += 2) {
+                        f = f * PairingPolicy::double_miller_loop::process(prec_P[i], prec_Q[i], prec_P[i + 1],
+                                                                           prec_Q[i + 1]);
+                    }
+                    if (i < prec_P.size()) {
+                        f = f * PairingPolicy::miller_loop::process(prec_P[i], prec_Q[i]);
+                    }
+
+                    return f;
+                }
+            }    // namespace detail
+
+            /** @brief Product of the Miller loops of (prec_P[i], prec_Q[i]) over all i.
+             *
+             * Curves whose pairing policy provides multi_miller_loop share a single accumulator
+             * between all pairs; the other ones multiply double Miller loops together.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                multi_miller_loop(const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                                  const std::vector<typename PairingPolicy::g2_precomputed_type> &prec_Q) {
+                BOOST_ASSERT(prec_P.size() == prec_Q.size());
+
+                return detail::multi_miller_loop_impl<PairingCurveType, PairingPolicy>(
+                    prec_P, prec_Q, detail::has_multi_miller_loop<PairingPolicy>());
+            }
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
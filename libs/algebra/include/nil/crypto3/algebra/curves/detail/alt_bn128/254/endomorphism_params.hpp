@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_ENDOMORPHISM_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_ENDOMORPHISM_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/254/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/psi.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief psi of the alt_bn128 D-type twist: x_coeff = xi^((p - 1) / 3), y_coeff = xi^((p - 1) / 2),
+                     * xi = 9 + u.
+                     */
+                    template<>
+                    struct psi_params<alt_bn128_g2_params<254, forms::short_weierstrass>> {
+                        using field_type = typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type;
+                        using underlying_type = typename field_type::value_type::underlying_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const bool has_cofactor_clearing = false;
+
+                        constexpr static const typename field_type::value_type x_coeff = typename field_type::value_type(
+                            underlying_type(0x2fb347984f7911f74c0bec3cf559b143b78cc310c2c3330c99e39557176f553d_cppui_modular254),
+                            underlying_type(0x16c9e55061ebae204ba4cc8bd75a079432ae2a1d0b7c9dce1665d51c640fcba2_cppui_modular254));
+                        constexpr static const typename field_type::value_type y_coeff = typename field_type::value_type(
+                            underlying_type(0x63cf305489af5dcdc5ec698b6e2f9b9dbaae0eda9c95998dc54014671a0135a_cppui_modular254),
+                            underlying_type(0x7c03cbcac41049a0704b5a7ec796f2b21807dc98fa25bd282d37f632623b0e3_cppui_modular254));
+                    };
+
+                    template<>
+                    struct subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>> {
+                        typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<128>>
+                            eigenvalue_type;
+
+                        constexpr static const bool is_enabled = true;
+
+                        // psi(P) = [6u^2]P on G2, u = 0x44e992b44a6909f1
+                        constexpr static const eigenvalue_type eigenvalue_abs = 0x6f4d8248eeb859fbf83e9682e87cfd46_cppui_modular128;
+                        constexpr static const bool eigenvalue_is_negative = false;
+
+                        template<typename GroupValueType>
+                        static GroupValueType endomorphism(const GroupValueType &point) {
+                            return psi_functions<GroupValueType>::process(point);
+                        }
+                    };
+
+                    constexpr bool const psi_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::is_enabled;
+                    constexpr bool const psi_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::has_cofactor_clearing;
+                    constexpr typename psi_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::field_type::value_type const
+                        psi_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::x_coeff;
+                    constexpr typename psi_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::field_type::value_type const
+                        psi_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::y_coeff;
+
+                    constexpr bool const subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::is_enabled;
+                    constexpr typename subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::eigenvalue_type const
+                        subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::eigenvalue_abs;
+                    constexpr bool const subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::eigenvalue_is_negative;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_ENDOMORPHISM_PARAMS_HPP
@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/254/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief GLV endomorphism of alt_bn128 G1.
+                     */
+                    template<>
+                    struct glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>> {
+                        using base_field_type = typename alt_bn128_types<254>::base_field_type;
+                        using scalar_field_type = typename alt_bn128_types<254>::scalar_field_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const std::size_t shift = 254;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x59e26bcea0d48bacd4f263f1acdb5c4f5763473177fffffe_cppui_modular254);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0xb3c4d79d41a917585bfc41088d8daaa78b17ea66b99c90dd_cppui_modular254);
+
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x6f4d8248eeb859fc8211bbeb7d4f1128_cppui_modular254);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0x30644e72e131a029b85045b68181585d2833e84879b97090ba0ed02b5b2dec1e_cppui_modular254);
+
+                        constexpr static const typename scalar_field_type::integral_type g1 =
+                            0xb64748cbb1f82cf6_cppui_modular254;
+                        constexpr static const typename scalar_field_type::integral_type g2 =
+                            0x9333bc0529dcf4b3de9ef6750e47ac63_cppui_modular254;
+                    };
+
+                    /**
+                     * @brief GLV endomorphism of alt_bn128 G2. The twist has j-invariant 0 as well, beta lies in Fp.
+                     */
+                    template<>
+                    struct glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>> {
+                        using base_field_type = typename alt_bn128_types<254>::base_field_type;
+                        using scalar_field_type = typename alt_bn128_types<254>::scalar_field_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const std::size_t shift = 254;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x59e26bcea0d48bacd4f263f1acdb5c4f5763473177fffffe_cppui_modular254);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0x30644e72e131a029048b6e193fd84104cc37a73fec2bc5e9b8ca0b2d36636f23_cppui_modular254);
+
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x89d3256894d213e3_cppui_modular254);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0x30644e72e131a029b85045b68181585cb8e665ff8b01169437fd143fdddedaf6_cppui_modular254);
+
+                        constexpr static const typename scalar_field_type::integral_type g1 =
+                            0x9333bc0529dcf4b494e63f40c03fd959_cppui_modular254;
+                        constexpr static const typename scalar_field_type::integral_type g2 =
+                            0xb64748cbb1f82cf6_cppui_modular254;
+                    };
+
+                    constexpr bool const glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::is_enabled;
+                    constexpr std::size_t const glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::lambda;
+                    constexpr typename glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::minus_b2;
+                    constexpr typename glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::g2;
+
+                    constexpr bool const glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::is_enabled;
+                    constexpr std::size_t const glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::lambda;
+                    constexpr typename glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::minus_b2;
+                    constexpr typename glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::g2;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_GLV_PARAMS_HPP
@@ -28,6 +28,7 @@
 #define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_G1_HPP
 
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/254/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/254/glv_params.hpp>
 
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/element_g1.hpp>
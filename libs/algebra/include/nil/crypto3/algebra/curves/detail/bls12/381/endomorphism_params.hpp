@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_381_ENDOMORPHISM_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_381_ENDOMORPHISM_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/bls12/381/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/381/glv_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+#include <nil/crypto3/algebra/curves/detail/psi.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief psi of the BLS12-381 M-type twist: x_coeff = 1 / (1 + u)^((p - 1) / 3),
+                     * y_coeff = 1 / (1 + u)^((p - 1) / 2). z = -0xd201000000010000 is the curve parameter.
+                     */
+                    template<>
+                    struct psi_params<bls12_g2_params<381, forms::short_weierstrass>> {
+                        using field_type = typename bls12_g2_params<381, forms::short_weierstrass>::field_type;
+                        using underlying_type = typename field_type::value_type::underlying_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const bool has_cofactor_clearing = true;
+
+                        constexpr static const typename field_type::value_type x_coeff = typename field_type::value_type(
+                            underlying_type::zero(),
+                            underlying_type(0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaad_cppui_modular381));
+                        constexpr static const typename field_type::value_type y_coeff = typename field_type::value_type(
+                            underlying_type(0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2_cppui_modular381),
+                            underlying_type(0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09_cppui_modular381));
+
+                        constexpr static const boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<64>>
+                            z_abs = 0xd201000000010000_cppui_modular64;
+                        constexpr static const bool z_is_negative = true;
+                    };
+
+                    template<>
+                    struct subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>> {
+                        typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<128>>
+                            eigenvalue_type;
+
+                        constexpr static const bool is_enabled = true;
+
+                        // phi(P) = [-z^2]P on G1
+                        constexpr static const eigenvalue_type eigenvalue_abs = 0xac45a4010001a4020000000100000000_cppui_modular128;
+                        constexpr static const bool eigenvalue_is_negative = true;
+
+                        template<typename GroupValueType>
+                        static GroupValueType endomorphism(const GroupValueType &point) {
+                            return glv_functions<GroupValueType>::endomorphism(point);
+                        }
+                    };
+
+                    template<>
+                    struct subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>> {
+                        typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<64>>
+                            eigenvalue_type;
+
+                        constexpr static const bool is_enabled = true;
+
+                        // psi(P) = [z]P on G2
+                        constexpr static const eigenvalue_type eigenvalue_abs = 0xd201000000010000_cppui_modular64;
+                        constexpr static const bool eigenvalue_is_negative = true;
+
+                        template<typename GroupValueType>
+                        static GroupValueType endomorphism(const GroupValueType &point) {
+                            return psi_functions<GroupValueType>::process(point);
+                        }
+                    };
+
+                    constexpr bool const psi_params<bls12_g2_params<381, forms::short_weierstrass>>::is_enabled;
+                    constexpr bool const psi_params<bls12_g2_params<381, forms::short_weierstrass>>::has_cofactor_clearing;
+                    constexpr typename psi_params<bls12_g2_params<381, forms::short_weierstrass>>::field_type::value_type const
+                        psi_params<bls12_g2_params<381, forms::short_weierstrass>>::x_coeff;
+                    constexpr typename psi_params<bls12_g2_params<381, forms::short_weierstrass>>::field_type::value_type const
+                        psi_params<bls12_g2_params<381, forms::short_weierstrass>>::y_coeff;
+                    constexpr boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<64>> const
+                        psi_params<bls12_g2_params<381, forms::short_weierstrass>>::z_abs;
+                    constexpr bool const psi_params<bls12_g2_params<381, forms::short_weierstrass>>::z_is_negative;
+
+                    constexpr bool const subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::is_enabled;
+                    constexpr typename subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::eigenvalue_type const
+                        subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::eigenvalue_abs;
+                    constexpr bool const subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::eigenvalue_is_negative;
+
+                    constexpr bool const subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::is_enabled;
+                    constexpr typename subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::eigenvalue_type const
+                        subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::eigenvalue_abs;
+                    constexpr bool const subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::eigenvalue_is_negative;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_381_ENDOMORPHISM_PARAMS_HPP
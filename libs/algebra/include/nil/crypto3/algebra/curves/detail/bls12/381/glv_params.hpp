@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_381_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_381_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/bls12/381/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief GLV endomorphism of BLS12-381 G1.
+                     */
+                    template<>
+                    struct glv_params<bls12_g1_params<381, forms::short_weierstrass>> {
+                        using base_field_type = typename bls12_types<381>::base_field_type;
+                        using scalar_field_type = typename bls12_types<381>::scalar_field_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const std::size_t shift = 255;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe_cppui_modular381);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0x73eda753299d7d483339d80809a1d804a7780001fffcb7fcfffffffe00000001_cppui_modular255);
+
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0xac45a4010001a40200000000ffffffff_cppui_modular255);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000000_cppui_modular255);
+
+                        constexpr static const typename scalar_field_type::integral_type g1 =
+                            0x1_cppui_modular255;
+                        constexpr static const typename scalar_field_type::integral_type g2 =
+                            0xbe35f678f00fd56eb1fb72917b67f717_cppui_modular255;
+                    };
+
+                    /**
+                     * @brief GLV endomorphism of BLS12-381 G2. The twist has j-invariant 0 as well, beta lies in Fp.
+                     */
+                    template<>
+                    struct glv_params<bls12_g2_params<381, forms::short_weierstrass>> {
+                        using base_field_type = typename bls12_types<381>::base_field_type;
+                        using scalar_field_type = typename bls12_types<381>::scalar_field_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const std::size_t shift = 255;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe_cppui_modular381);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0xac45a4010001a40200000000ffffffff_cppui_modular255);
+
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x1_cppui_modular255);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0x73eda753299d7d483339d80809a1d804a7780001fffcb7fcfffffffe00000001_cppui_modular255);
+
+                        constexpr static const typename scalar_field_type::integral_type g1 =
+                            0xbe35f678f00fd56eb1fb72917b67f718_cppui_modular255;
+                        constexpr static const typename scalar_field_type::integral_type g2 =
+                            0x1_cppui_modular255;
+                    };
+
+                    constexpr bool const glv_params<bls12_g1_params<381, forms::short_weierstrass>>::is_enabled;
+                    constexpr std::size_t const glv_params<bls12_g1_params<381, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<bls12_g1_params<381, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::lambda;
+                    constexpr typename glv_params<bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::minus_b2;
+                    constexpr typename glv_params<bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::g2;
+
+                    constexpr bool const glv_params<bls12_g2_params<381, forms::short_weierstrass>>::is_enabled;
+                    constexpr std::size_t const glv_params<bls12_g2_params<381, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<bls12_g2_params<381, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<bls12_g2_params<381, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<bls12_g2_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g2_params<381, forms::short_weierstrass>>::lambda;
+                    constexpr typename glv_params<bls12_g2_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g2_params<381, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<bls12_g2_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g2_params<381, forms::short_weierstrass>>::minus_b2;
+                    constexpr typename glv_params<bls12_g2_params<381, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<bls12_g2_params<381, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<bls12_g2_params<381, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<bls12_g2_params<381, forms::short_weierstrass>>::g2;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_381_GLV_PARAMS_HPP
@@ -30,6 +30,8 @@
 #ifndef __ZKLLVM__
 #include <nil/crypto3/algebra/curves/detail/bls12/377/short_weierstrass_params.hpp>
 #include <nil/crypto3/algebra/curves/detail/bls12/381/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/381/glv_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/381/endomorphism_params.hpp>
 
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/element_g1.hpp>
@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+#define CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief Constants of the GLV endomorphism of a curve group.
+                     *    @tparam CurveParams group params the endomorphism belongs to
+                     *
+                     * Curves with j-invariant 0 have the endomorphism phi(x, y) = (beta * x, y), where beta
+                     * is a cube root of unity of the base field. On the prime order subgroup it acts as
+                     * multiplication by lambda, a cube root of unity of the scalar field.
+                     * Specializations provide beta, lambda, the negated second coordinates minus_b1, minus_b2
+                     * of a reduced basis (a1, b1), (a2, b2) of the lattice {(x, y) : x + y * lambda = 0 mod r}
+                     * with b1 < 0 < b2, and g1 = round(2^shift * b2 / r), g2 = round(2^shift * (-b1) / r).
+                     * With shift = log2(r) the rounded quotients c1, c2 are off by at most one, which makes
+                     * k1, k2 at most a couple of bits longer than sqrt(r).
+                     */
+                    template<typename CurveParams>
+                    struct glv_params {
+                        constexpr static const bool is_enabled = false;
+                    };
+
+                    template<typename ScalarFieldType>
+                    using glv_wide_integral_type = boost::multiprecision::number<
+                        boost::multiprecision::backends::cpp_int_modular_backend<2 * ScalarFieldType::modulus_bits>>;
+
+                    /** @brief True if GroupValueType has GLV params and ScalarValueType is its scalar field element.
+                     *
+                     * Integral scalars are not decomposed: they are used for cofactor clearing and subgroup
+                     * checks, where the point is not assumed to belong to the prime order subgroup.
+                     */
+                    template<typename GroupValueType, typename ScalarValueType, typename = void>
+                    struct is_glv_scalar_mul_enabled : std::false_type { };
+
+                    template<typename GroupValueType, typename ScalarValueType>
+                    struct is_glv_scalar_mul_enabled<
+                        GroupValueType, ScalarValueType,
+                        typename std::enable_if<
+                            glv_params<typename GroupValueType::params_type>::is_enabled &&
+                            std::is_same<typename ScalarValueType::field_type,
+                                         typename glv_params<
+                                             typename GroupValueType::params_type>::scalar_field_type>::value>::type>
+                        : std::true_type { };
+
+                    /** @brief Scalar multiplication through the GLV decomposition.
+                     *
+                     * The scalar k is split into k1 + k2 * lambda with |k1|, |k2| about sqrt(r), and
+                     * k1 * P + k2 * phi(P) is computed with interleaved wNAF: both halves share one
+                     * sequence of doublings, which is half as long as for k itself. The table for phi(P)
+                     * is the image of the table for P, so it costs one base field multiplication per entry.
+                     */
+                    template<typename GroupValueType>
+                    struct glv_functions {
+                        typedef glv_params<typename GroupValueType::params_type> glv_params_type;
+                        typedef typename glv_params_type::scalar_field_type scalar_field_type;
+                        typedef typename scalar_field_type::value_type scalar_value_type;
+                        typedef typename scalar_field_type::integral_type integral_type;
+                        typedef glv_wide_integral_type<scalar_field_type> wide_integral_type;
+
+                        constexpr static const std::size_t window_size = 4;
+
+                        static GroupValueType endomorphism(const GroupValueType &point) {
+                            // x is X / Z^2 in jacobian and X / Z in projective coordinates,
+                            // so scaling X scales x in both
+                            GroupValueType result = point;
+                            result.X = result.X * glv_params_type::beta;
+                            return result;
+                        }
+
+                        /** @brief Finds k1, k2 with k = k1 + k2 * lambda mod r.
+                         *
+                         * Returns absolute values, the signs are reported through k1_negative and k2_negative.
+                         */
+                        static void decompose(const scalar_value_type &k,
+                                              integral_type &k1, bool &k1_negative,
+                                              integral_type &k2, bool &k2_negative) {
+                            const wide_integral_type wide_k = wide_integral_type(integral_type(k.data));
+                            const wide_integral_type half = wide_integral_type(1u) << (glv_params_type::shift - 1);
+
+                            const wide_integral_type c1 =
+                                (wide_k * wide_integral_type(glv_params_type::g1) + half) >> glv_params_type::shift;
+                            const wide_integral_type c2 =
+                                (wide_k * wide_integral_type(glv_params_type::g2) + half) >> glv_params_type::shift;
+
+                            const scalar_value_type r2 = scalar_value_type(integral_type(c1)) * glv_params_type::minus_b1 +
+                                                         scalar_value_type(integral_type(c2)) * glv_params_type::minus_b2;
+                            const scalar_value_type r1 = k - r2 * glv_params_type::lambda;
+
+                            to_signed(r1, k1, k1_negative);
+                            to_signed(r2, k2, k2_negative);
+                        }
+
+                        static GroupValueType process(const GroupValueType &point, const scalar_value_type &scalar) {
+                            if (scalar.is_zero() || point.is_zero()) {
+                                return GroupValueType::zero();
+                            }
+
+                            integral_type k1, k2;
+                            bool k1_negative, k2_negative;
+                            decompose(scalar, k1, k1_negative, k2, k2_negative);
+
+                            const std::vector<long> naf1 = boost::multiprecision::find_wnaf(window_size, k1);
+                            const std::vector<long> naf2 = boost::multiprecision::find_wnaf(window_size, k2);
+
+                            // table1[i] = (2i + 1) * (+-P), table2[i] = (2i + 1) * (+-phi(P))
+                            const std::size_t table_size = 1ul << (window_size - 1);
+                            std::vector<GroupValueType> table1(table_size), table2(table_size);
+
+                            table1[0] = k1_negative ? -point : point;
+                            GroupValueType dbl = table1[0];
+                            dbl.double_inplace();
+                            for (std::size_t i = 1; i < table_size; ++i) {
+                                table1[i] = table1[i - 1] + dbl;
+                            }
+                            for (std::size_t i = 0; i < table_size; ++i) {
+                                table2[i] = endomorphism(k1_negative != k2_negative ? -table1[i] : table1[i]);
+                            }
+
+                            GroupValueType result = GroupValueType::zero();
+                            bool found_nonzero = false;
+                            for (std::size_t i = std::max(naf1.size(), naf2.size()); i-- > 0;) {
+                                if (found_nonzero) {
+                                    result.double_inplace();
+                                }
+
+                                found_nonzero |= add_digit(result, table1, i < naf1.size() ? naf1[i] : 0);
+                                found_nonzero |= add_digit(result, table2, i < naf2.size() ? naf2[i] : 0);
+                            }
+
+                            return result;
+                        }
+
+                    private:
+                        static void to_signed(const scalar_value_type &r, integral_type &value, bool &negative) {
+                            value = integral_type(r.data);
+                            negative = value > (scalar_field_type::modulus >> 1u);
+                            if (negative) {
+                                value = scalar_field_type::modulus - value;
+                            }
+                        }
+
+                        static bool add_digit(GroupValueType &result, const std::vector<GroupValueType> &table,
+                                              long digit) {
+                            if (digit > 0) {
+                                result = result + table[digit / 2];
+                            } else if (digit < 0) {
+                                result = result - table[(-digit) / 2];
+                            }
+                            return digit != 0;
+                        }
+                    };
+
+                    template<typename GroupValueType>
+                    constexpr std::size_t const glv_functions<GroupValueType>::window_size;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_GLV_HPP
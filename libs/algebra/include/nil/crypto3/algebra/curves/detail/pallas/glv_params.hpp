@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_PALLAS_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_PALLAS_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/pallas/params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+#ifndef __ZKLLVM__
+                    /**
+                     * @brief GLV endomorphism of Pallas.
+                     */
+                    template<>
+                    struct glv_params<pallas_g1_params<forms::short_weierstrass>> {
+                        using base_field_type = typename pallas_types::base_field_type;
+                        using scalar_field_type = typename pallas_types::scalar_field_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const std::size_t shift = 255;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x12ccca834acdba712caad5dc57aab1b01d1f8bd237ad31491dad5ebdfdfe4ab9_cppui_modular255);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0x6819a58283e528e511db4d81cf70f5a0fed467d47c033af2aa9d2e050aa0e4f_cppui_modular255);
+
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x49e69d1640a899538cb1279300000000_cppui_modular255);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0x3fffffffffffffffffffffffffffffff8e795ecf87fbc6747fcae1c700000000_cppui_modular255);
+
+                        constexpr static const typename scalar_field_type::integral_type g1 =
+                            0x1279a74590331c4d218f812b400000001_cppui_modular255;
+                        constexpr static const typename scalar_field_type::integral_type g2 =
+                            0x93cd3a2c815132a719624f2600000000_cppui_modular255;
+                    };
+
+                    constexpr bool const glv_params<pallas_g1_params<forms::short_weierstrass>>::is_enabled;
+                    constexpr std::size_t const glv_params<pallas_g1_params<forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<pallas_g1_params<forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<pallas_g1_params<forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<pallas_g1_params<forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<pallas_g1_params<forms::short_weierstrass>>::lambda;
+                    constexpr typename glv_params<pallas_g1_params<forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<pallas_g1_params<forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<pallas_g1_params<forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<pallas_g1_params<forms::short_weierstrass>>::minus_b2;
+                    constexpr typename glv_params<pallas_g1_params<forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<pallas_g1_params<forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<pallas_g1_params<forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<pallas_g1_params<forms::short_weierstrass>>::g2;
+#endif
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_PALLAS_GLV_PARAMS_HPP
@@ -0,0 +1,115 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_PSI_HPP
+#define CRYPTO3_ALGEBRA_CURVES_PSI_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief Constants of the untwist-Frobenius-twist endomorphism psi of a G2 group.
+                     *    @tparam CurveParams G2 group params
+                     *
+                     * psi(x, y) = (x^p * x_coeff, y^p * y_coeff) maps the sextic twist to itself and acts
+                     * on G2 as multiplication by p. Specializations of BLS12 curves also provide the absolute
+                     * value and the sign of the curve parameter z for the cofactor clearing.
+                     */
+                    template<typename CurveParams>
+                    struct psi_params {
+                        constexpr static const bool is_enabled = false;
+                        constexpr static const bool has_cofactor_clearing = false;
+                    };
+
+                    template<typename GroupValueType, typename = void>
+                    struct is_psi_enabled : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct is_psi_enabled<
+                        GroupValueType,
+                        typename std::enable_if<psi_params<typename GroupValueType::params_type>::is_enabled &&
+                                                !std::is_same<typename GroupValueType::coordinates,
+                                                              curves::coordinates::affine>::value>::type>
+                        : std::true_type { };
+
+                    template<typename GroupValueType, typename = void>
+                    struct is_psi_cofactor_clearing_enabled : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct is_psi_cofactor_clearing_enabled<
+                        GroupValueType,
+                        typename std::enable_if<
+                            is_psi_enabled<GroupValueType>::value &&
+                            psi_params<typename GroupValueType::params_type>::has_cofactor_clearing>::type>
+                        : std::true_type { };
+
+                    template<typename GroupValueType>
+                    struct psi_functions {
+                        typedef psi_params<typename GroupValueType::params_type> psi_params_type;
+
+                        static GroupValueType process(const GroupValueType &point) {
+                            // Frobenius is a field automorphism, so it commutes with the division by Z
+                            GroupValueType result = point;
+                            result.X = point.X.Frobenius_map(1u) * psi_params_type::x_coeff;
+                            result.Y = point.Y.Frobenius_map(1u) * psi_params_type::y_coeff;
+                            result.Z = point.Z.Frobenius_map(1u);
+                            return result;
+                        }
+
+                        /** @brief Computes h_eff * P on BLS12 G2 as in Budroni and Pintore,
+                         * "Efficient hash maps to G2 on BLS curves" (RFC 9380, section G.3):
+                         * [z^2 - z - 1]P + [z - 1]psi(P) + psi^2(2P), two multiplications by the 64-bit z
+                         * instead of one by the 636-bit h_eff.
+                         */
+                        static GroupValueType clear_cofactor(const GroupValueType &point) {
+                            GroupValueType t1 = mul_by_z(point);
+                            GroupValueType t2 = process(point);
+                            GroupValueType t3 = point;
+                            t3.double_inplace();
+                            t3 = process(process(t3));
+                            t3 = t3 - t2;
+                            t2 = mul_by_z(t1 + t2);
+                            t3 = t3 + t2;
+                            t3 = t3 - t1;
+                            return t3 - point;
+                        }
+
+                    private:
+                        static GroupValueType mul_by_z(const GroupValueType &point) {
+                            const GroupValueType result = point * psi_params_type::z_abs;
+                            return psi_params_type::z_is_negative ? -result : result;
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_PSI_HPP
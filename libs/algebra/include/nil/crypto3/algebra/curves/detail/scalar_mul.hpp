@@ -28,6 +28,7 @@
 #define CRYPTO3_ALGEBRA_CURVES_SCALAR_MUL_HPP
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
 
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
@@ -100,7 +101,19 @@ namespace nil {
 
                     template<typename curve_element_type, typename scalar_value_type>
                     typename std::enable_if<
-                    has_mixed_add<curve_element_type>::value, curve_element_type>::type
+                    is_glv_scalar_mul_enabled<curve_element_type, scalar_value_type>::value, curve_element_type>::type
+                    & operator *= (
+                            curve_element_type& point,
+                            scalar_value_type const& scalar)
+                    {
+                        point = glv_functions<curve_element_type>::process(point, scalar);
+                        return point;
+                    }
+
+                    template<typename curve_element_type, typename scalar_value_type>
+                    typename std::enable_if<
+                    has_mixed_add<curve_element_type>::value &&
+                    !is_glv_scalar_mul_enabled<curve_element_type, scalar_value_type>::value, curve_element_type>::type
                     & operator *= (
                             curve_element_type& point,
                             scalar_value_type const& scalar)
@@ -136,7 +149,8 @@ namespace nil {
 
                     template<typename curve_element_type, typename scalar_value_type>
                     typename std::enable_if<
-                    !has_mixed_add<curve_element_type>::value, curve_element_type>::type
+                    !has_mixed_add<curve_element_type>::value &&
+                    !is_glv_scalar_mul_enabled<curve_element_type, scalar_value_type>::value, curve_element_type>::type
                     & operator *= (
                             curve_element_type& point,
                             scalar_value_type const& scalar)
@@ -197,6 +211,18 @@ namespace nil {
                         return scalar_mul(right, left);
                     }
 
+                    template<typename GroupValueType, typename FieldValueType>
+                    GroupValueType scalar_mul_field(const GroupValueType &left, const FieldValueType &right,
+                                                    std::true_type /* is_glv_scalar_mul_enabled */) {
+                        return glv_functions<GroupValueType>::process(left, right);
+                    }
+
+                    template<typename GroupValueType, typename FieldValueType>
+                    GroupValueType scalar_mul_field(const GroupValueType &left, const FieldValueType &right,
+                                                    std::false_type /* is_glv_scalar_mul_enabled */) {
+                        return left * right.data;
+                    }
+
                     template<typename GroupValueType, typename FieldValueType>
                     typename std::enable_if<is_curve_group<typename GroupValueType::group_type>::value &&
                                                 !is_field<typename GroupValueType::group_type>::value &&
@@ -205,7 +231,8 @@ namespace nil {
                                             GroupValueType>::type
                         operator*(const GroupValueType &left, const FieldValueType &right) {
 
-                        return left * right.data;
+                        return scalar_mul_field(left, right,
+                                                is_glv_scalar_mul_enabled<GroupValueType, FieldValueType>());
                     }
 
                     template<typename GroupValueType, typename FieldValueType>
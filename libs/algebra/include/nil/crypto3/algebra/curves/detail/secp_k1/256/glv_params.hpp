@@ -0,0 +1,87 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SECP_K1_256_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SECP_K1_256_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/secp_k1/256/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief GLV endomorphism of secp256k1.
+                     */
+                    template<>
+                    struct glv_params<secp_k1_g1_params<256, forms::short_weierstrass>> {
+                        using base_field_type = typename secp_k1_types<256>::base_field_type;
+                        using scalar_field_type = typename secp_k1_types<256>::scalar_field_type;
+
+                        constexpr static const bool is_enabled = true;
+                        constexpr static const std::size_t shift = 256;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x7ae96a2b657c07106e64479eac3434e99cf0497512f58995c1396c28719501ee_cppui_modular256);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0x5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72_cppui_modular256);
+
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0xe4437ed6010e88286f547fa90abfe4c3_cppui_modular256);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0xfffffffffffffffffffffffffffffffe8a280ac50774346dd765cda83db1562c_cppui_modular256);
+
+                        constexpr static const typename scalar_field_type::integral_type g1 =
+                            0x3086d221a7d46bcde86c90e49284eb15_cppui_modular256;
+                        constexpr static const typename scalar_field_type::integral_type g2 =
+                            0xe4437ed6010e88286f547fa90abfe4c4_cppui_modular256;
+                    };
+
+                    constexpr bool const glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::is_enabled;
+                    constexpr std::size_t const glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::lambda;
+                    constexpr typename glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::minus_b2;
+                    constexpr typename glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::integral_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::g2;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_SECP_K1_256_GLV_PARAMS_HPP
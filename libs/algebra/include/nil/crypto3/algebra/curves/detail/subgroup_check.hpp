@@ -26,20 +26,63 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 
+#include <type_traits>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /** @brief Parameters of an endomorphism based subgroup membership test.
+                     *    @tparam CurveParams group params
+                     *
+                     * Specializations provide an endomorphism and a short eigenvalue such that a point P
+                     * of the curve lies in the prime order subgroup iff endomorphism(P) = [eigenvalue]P
+                     * (M. Scott, "A note on group membership tests for G1, G2 and GT on BLS
+                     * pairing-friendly curves"). The eigenvalue is stored as absolute value and sign.
+                     */
+                    template<typename CurveParams>
+                    struct subgroup_check_params {
+                        constexpr static const bool is_enabled = false;
+                    };
+
+                    template<typename GroupValueType, typename = void>
+                    struct is_endomorphism_subgroup_check_enabled : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct is_endomorphism_subgroup_check_enabled<
+                        GroupValueType,
+                        typename std::enable_if<
+                            subgroup_check_params<typename GroupValueType::params_type>::is_enabled &&
+                            !std::is_same<typename GroupValueType::coordinates,
+                                          curves::coordinates::affine>::value>::type> : std::true_type { };
+
+                    template<typename GroupValueType>
+                    bool subgroup_check_impl(const GroupValueType &p, std::false_type) {
+                        return (p * GroupValueType::group_type::curve_type::q).is_zero();
+                    }
+
+                    template<typename GroupValueType>
+                    bool subgroup_check_impl(const GroupValueType &p, std::true_type) {
+                        typedef subgroup_check_params<typename GroupValueType::params_type> params_type;
+
+                        GroupValueType multiple = p * params_type::eigenvalue_abs;
+                        if (params_type::eigenvalue_is_negative) {
+                            multiple = -multiple;
+                        }
+                        return params_type::endomorphism(p) == multiple;
+                    }
+
                     // TODO: temporary implementation due to absence of GroupValueType type_trait
                     //  Should be implemented as class method
                     template<typename GroupValueType, typename = typename std::enable_if<
                                                           is_curve_group<typename GroupValueType::group_type>::value &&
                                                           !is_field<typename GroupValueType::group_type>::value>::type>
                     bool subgroup_check(const GroupValueType &p) {
-                        return (p * GroupValueType::group_type::curve_type::q).is_zero();
+                        return subgroup_check_impl(p, is_endomorphism_subgroup_check_enabled<GroupValueType>());
                     }
                 }    // namespace detail
             }        // namespace curves
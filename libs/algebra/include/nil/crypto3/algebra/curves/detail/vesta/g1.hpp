@@ -28,6 +28,7 @@
 #define CRYPTO3_ALGEBRA_CURVES_VESTA_G1_HPP
 
 #include <nil/crypto3/algebra/curves/detail/vesta/params.hpp>
+#include <nil/crypto3/algebra/curves/detail/vesta/glv_params.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/element_g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/element_g1_affine.hpp>
 
@@ -32,8 +32,10 @@
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
+#include <nil/crypto3/algebra/type_traits.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -234,7 +236,16 @@ namespace nil {
 
             template<typename GroupType, typename InputRange>
             typename std::enable_if<
-                    std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
+                    std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value &&
+                    has_type_coordinates<typename GroupType::value_type>::value, void>::type
+            batch_to_special(InputRange &vec) {
+                batch_normalize(vec);
+            }
+
+            template<typename GroupType, typename InputRange>
+            typename std::enable_if<
+                    std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value &&
+                    !has_type_coordinates<typename GroupType::value_type>::value, void>::type
             batch_to_special(InputRange &vec) {
 
                 std::vector<typename GroupType::value_type> non_zero_vec;
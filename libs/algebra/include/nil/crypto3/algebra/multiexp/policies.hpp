@@ -27,12 +27,16 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <type_traits>
 #include <vector>
 
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+#include <nil/crypto3/parallelization/parallel_for.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -107,6 +111,69 @@ namespace nil {
                         typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
                         typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
 
+                        return process_glv(
+                            bases, bases_end, exponents, exponents_end,
+                            curves::detail::is_glv_scalar_mul_enabled<base_value_type, field_value_type>());
+                    }
+
+                    /**
+                     * Replaces every pair (P, k) by (P, k1) and (phi(P), k2) with k = k1 + k2 * lambda,
+                     * so the buckets run over half as many windows of the twice as long input.
+                     * The endomorphism keeps Z, so bases in special form stay in special form.
+                     */
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process_glv(InputBaseIterator bases,
+                                    InputBaseIterator bases_end,
+                                    InputFieldIterator exponents,
+                                    InputFieldIterator exponents_end,
+                                    std::true_type /* is_glv_scalar_mul_enabled */) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                        typedef curves::detail::glv_functions<base_value_type> glv_type;
+
+                        const std::size_t length = std::distance(bases, bases_end);
+                        assert(length == std::distance(exponents, exponents_end));
+
+                        std::vector<base_value_type> split_bases(2 * length);
+                        std::vector<field_value_type> split_exponents(2 * length);
+
+                        parallelization::parallel_for(0, length, [&](std::size_t i) {
+                            typename glv_type::integral_type k1, k2;
+                            bool k1_negative, k2_negative;
+                            glv_type::decompose(exponents[i], k1, k1_negative, k2, k2_negative);
+
+                            split_bases[2 * i] = k1_negative ? -bases[i] : bases[i];
+                            split_bases[2 * i + 1] = glv_type::endomorphism(k2_negative ? -bases[i] : bases[i]);
+                            split_exponents[2 * i] = field_value_type(k1);
+                            split_exponents[2 * i + 1] = field_value_type(k2);
+                        });
+
+                        return process_buckets(split_bases.begin(), split_bases.end(), split_exponents.begin(),
+                                               split_exponents.end());
+                    }
+
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process_glv(InputBaseIterator bases,
+                                    InputBaseIterator bases_end,
+                                    InputFieldIterator exponents,
+                                    InputFieldIterator exponents_end,
+                                    std::false_type /* is_glv_scalar_mul_enabled */) {
+                        return process_buckets(bases, bases_end, exponents, exponents_end);
+                    }
+
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process_buckets(InputBaseIterator bases,
+                                        InputBaseIterator bases_end,
+                                        InputFieldIterator exponents,
+                                        InputFieldIterator exponents_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+
                         std::size_t length = std::distance(bases, bases_end);
                         assert(length == std::distance(exponents, exponents_end));
 
@@ -167,7 +234,7 @@ namespace nil {
                             }
 
 #ifdef USE_MIXED_ADDITION
-                            batch_to_special(buckets);
+                            batch_normalize(buckets);
 #endif
 
                             base_value_type running_sum;
@@ -110,6 +110,7 @@ namespace nil {
                             (typename base_field_type::value_type(0x02u).inversed());
 
                         g2_precomputed_type result;
+                        result.is_zero = Q.is_zero();
                         result.QX = Qcopy.X;
                         result.QY = Qcopy.Y;
 
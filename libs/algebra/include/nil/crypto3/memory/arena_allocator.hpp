@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MEMORY_ARENA_ALLOCATOR_HPP
+#define CRYPTO3_MEMORY_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include <nil/crypto3/memory/memory_arena.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace memory {
+            /** @brief Standard allocator drawing from a memory_arena.
+             *
+             * A default constructed allocator uses the current arena of the constructing thread, and plain
+             * operator new if there is none. Containers keep their allocator, so a vector created inside a
+             * scoped_memory_arena returns its memory to that arena wherever it is freed. The allocator
+             * propagates on assignment and swap, so that the memory always goes back where it came from.
+             */
+            template<typename T>
+            class arena_allocator {
+            public:
+                typedef T value_type;
+                typedef std::true_type propagate_on_container_copy_assignment;
+                typedef std::true_type propagate_on_container_move_assignment;
+                typedef std::true_type propagate_on_container_swap;
+
+                static_assert(alignof(T) <= memory_arena::cache_line_size, "over-aligned types are not supported");
+
+                arena_allocator() noexcept : _arena(current_arena()) {
+                }
+
+                explicit arena_allocator(memory_arena *arena) noexcept : _arena(arena) {
+                }
+
+                template<typename U>
+                arena_allocator(const arena_allocator<U> &other) noexcept : _arena(other.arena()) {
+                }
+
+                T *allocate(std::size_t n) {
+                    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+                        throw std::bad_array_new_length();
+                    }
+                    if (_arena == nullptr) {
+                        return static_cast<T *>(::operator new(n * sizeof(T)));
+                    }
+                    return static_cast<T *>(_arena->allocate(n * sizeof(T)));
+                }
+
+                void deallocate(T *p, std::size_t n) noexcept {
+                    if (_arena == nullptr) {
+                        ::operator delete(p);
+                    } else {
+                        _arena->deallocate(p, n * sizeof(T));
+                    }
+                }
+
+                memory_arena *arena() const noexcept {
+                    return _arena;
+                }
+
+            private:
+                memory_arena *_arena;
+            };
+
+            template<typename T, typename U>
+            bool operator==(const arena_allocator<T> &a, const arena_allocator<U> &b) noexcept {
+                return a.arena() == b.arena();
+            }
+
+            template<typename T, typename U>
+            bool operator!=(const arena_allocator<T> &a, const arena_allocator<U> &b) noexcept {
+                return !(a == b);
+            }
+        }    // namespace memory
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MEMORY_ARENA_ALLOCATOR_HPP
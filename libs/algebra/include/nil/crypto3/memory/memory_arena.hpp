@@ -0,0 +1,250 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MEMORY_MEMORY_ARENA_HPP
+#define CRYPTO3_MEMORY_MEMORY_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace memory {
+            /** @brief Counters of a memory_arena, all sizes are in bytes of rounded up blocks. */
+            struct arena_statistics {
+                // Obtained from the system over the lifetime of the arena
+                std::size_t bytes_allocated = 0;
+                std::size_t bytes_in_use = 0;
+                std::size_t peak_bytes_in_use = 0;
+                // Freed blocks kept for reuse
+                std::size_t bytes_cached = 0;
+                std::size_t allocations = 0;
+                // Allocations served with a cached block
+                std::size_t reuses = 0;
+
+                double reuse_rate() const {
+                    return allocations == 0 ? 0. : static_cast<double>(reuses) / static_cast<double>(allocations);
+                }
+            };
+
+            /** @brief Keeps freed blocks by size, so that equally sized allocations reuse them.
+             *
+             * Requests are rounded up to a multiple of cache_line_size, or of huge_page_size for large ones, and
+             * a freed block waits on the free list of its rounded size for the next request of that size. Large
+             * blocks are mapped directly and aligned to a huge page, with a hint to back them with transparent
+             * huge pages (Linux only). Smaller blocks come from aligned operator new.
+             *
+             * Pages land on the NUMA node of the thread that first writes them and cached blocks keep their
+             * pages, so an arena used by a thread_pool pinned to the CPUs of one node keeps its memory there.
+             *
+             * A freed block that would grow the cache beyond max_cached_bytes is returned to the system at once.
+             * release() and the destructor return all cached blocks. Blocks must not outlive the arena.
+             * Thread-safe.
+             */
+            class memory_arena {
+            public:
+                constexpr static const std::size_t cache_line_size = 64;
+                constexpr static const std::size_t huge_page_size = std::size_t(1) << 21;
+
+                explicit memory_arena(std::size_t max_cached_bytes = std::numeric_limits<std::size_t>::max()) :
+                    _max_cached_bytes(max_cached_bytes) {
+                }
+
+                memory_arena(const memory_arena &) = delete;
+                memory_arena &operator=(const memory_arena &) = delete;
+
+                ~memory_arena() {
+                    release();
+                }
+
+                void *allocate(std::size_t bytes) {
+                    const std::size_t size = block_size(bytes);
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        auto it = _free_blocks.find(size);
+                        if (it != _free_blocks.end() && !it->second.empty()) {
+                            void *block = it->second.back();
+                            it->second.pop_back();
+                            _statistics.bytes_cached -= size;
+                            ++_statistics.reuses;
+                            count_allocation(size);
+                            return block;
+                        }
+                    }
+
+                    // Mapping a large block can take a while, other threads need not wait for it
+                    void *block = system_allocate(size);
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _statistics.bytes_allocated += size;
+                    count_allocation(size);
+                    return block;
+                }
+
+                void deallocate(void *block, std::size_t bytes) noexcept {
+                    const std::size_t size = block_size(bytes);
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _statistics.bytes_in_use -= size;
+                        if (size <= _max_cached_bytes - _statistics.bytes_cached) {
+                            try {
+                                _free_blocks[size].push_back(block);
+                                _statistics.bytes_cached += size;
+                                return;
+                            } catch (const std::bad_alloc &) {
+                                // No room to remember the block, give it back instead
+                            }
+                        }
+                    }
+                    system_deallocate(block, size);
+                }
+
+                /** @brief Returns all cached blocks to the system. */
+                void release() noexcept {
+                    std::unordered_map<std::size_t, std::vector<void *>> free_blocks;
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        free_blocks.swap(_free_blocks);
+                        _statistics.bytes_cached = 0;
+                    }
+                    for (const auto &[size, blocks] : free_blocks) {
+                        for (void *block : blocks) {
+                            system_deallocate(block, size);
+                        }
+                    }
+                }
+
+                arena_statistics statistics() const {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    return _statistics;
+                }
+
+            private:
+                static std::size_t block_size(std::size_t bytes) {
+                    const std::size_t granularity = bytes >= huge_page_size ? huge_page_size : cache_line_size;
+                    if (bytes > std::numeric_limits<std::size_t>::max() - granularity) {
+                        throw std::bad_alloc();
+                    }
+                    return (std::max<std::size_t>(bytes, 1) + granularity - 1) / granularity * granularity;
+                }
+
+                static void *system_allocate(std::size_t size) {
+#ifdef __linux__
+                    if (size >= huge_page_size) {
+                        // Map one huge page more and trim both ends, so that the block starts on a huge page
+                        const std::size_t mapped_size = size + huge_page_size;
+                        void *mapped =
+                            mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                        if (mapped == MAP_FAILED) {
+                            throw std::bad_alloc();
+                        }
+                        const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(mapped);
+                        const std::uintptr_t aligned = (begin + huge_page_size - 1) / huge_page_size * huge_page_size;
+                        if (aligned != begin) {
+                            munmap(mapped, aligned - begin);
+                        }
+                        if (begin + mapped_size != aligned + size) {
+                            munmap(reinterpret_cast<void *>(aligned + size), begin + mapped_size - aligned - size);
+                        }
+#ifdef MADV_HUGEPAGE
+                        madvise(reinterpret_cast<void *>(aligned), size, MADV_HUGEPAGE);
+#endif
+                        return reinterpret_cast<void *>(aligned);
+                    }
+#endif
+                    return ::operator new(size, std::align_val_t(cache_line_size));
+                }
+
+                static void system_deallocate(void *block, std::size_t size) noexcept {
+#ifdef __linux__
+                    if (size >= huge_page_size) {
+                        munmap(block, size);
+                        return;
+                    }
+#endif
+                    ::operator delete(block, size, std::align_val_t(cache_line_size));
+                }
+
+                void count_allocation(std::size_t size) {
+                    ++_statistics.allocations;
+                    _statistics.bytes_in_use += size;
+                    _statistics.peak_bytes_in_use = std::max(_statistics.peak_bytes_in_use, _statistics.bytes_in_use);
+                }
+
+                const std::size_t _max_cached_bytes;
+
+                mutable std::mutex _mutex;
+                std::unordered_map<std::size_t, std::vector<void *>> _free_blocks;
+                arena_statistics _statistics;
+            };
+
+            namespace detail {
+                inline memory_arena *&current_arena_slot() {
+                    static thread_local memory_arena *current = nullptr;
+                    return current;
+                }
+            }    // namespace detail
+
+            /** @brief Arena installed with scoped_memory_arena on the calling thread, nullptr if there is none. */
+            inline memory_arena *current_arena() {
+                return detail::current_arena_slot();
+            }
+
+            /** @brief Makes arena the current arena of the calling thread for the lifetime of the object.
+             *
+             * Like scoped_executor, this binds a prover instance to its own arena without passing it through
+             * every call. Worker threads do not inherit it.
+             */
+            class scoped_memory_arena {
+            public:
+                explicit scoped_memory_arena(memory_arena &arena) : _previous(detail::current_arena_slot()) {
+                    detail::current_arena_slot() = &arena;
+                }
+
+                scoped_memory_arena(const scoped_memory_arena &) = delete;
+                scoped_memory_arena &operator=(const scoped_memory_arena &) = delete;
+
+                ~scoped_memory_arena() {
+                    detail::current_arena_slot() = _previous;
+                }
+
+            private:
+                memory_arena *_previous;
+            };
+        }    // namespace memory
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MEMORY_MEMORY_ARENA_HPP
@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_batch_inverse_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/algorithms/batch_inverse.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+#include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/parallelization/executor.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename FieldType>
+void check_batch_inverse(std::size_t size, std::size_t chunks_count) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> elements;
+    for (std::size_t i = 0; i < size; ++i) {
+        // sprinkle zeros, they must survive the inversion unchanged
+        elements.emplace_back(i % 7 == 3 ? value_type::zero() : random_element<FieldType>());
+    }
+
+    std::vector<value_type> inverses = elements;
+    batch_inverse(inverses, chunks_count);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        if (elements[i].is_zero()) {
+            BOOST_CHECK(inverses[i].is_zero());
+        } else {
+            BOOST_CHECK(inverses[i] == elements[i].inversed());
+        }
+    }
+}
+
+template<typename GroupType>
+void check_batch_normalize(std::size_t size, std::size_t chunks_count) {
+    typedef typename GroupType::value_type value_type;
+
+    std::vector<value_type> points;
+    for (std::size_t i = 0; i < size; ++i) {
+        points.emplace_back(i % 5 == 1 ? value_type::zero() : random_element<GroupType>());
+    }
+
+    std::vector<value_type> normalized = points;
+    batch_normalize(normalized, chunks_count);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK(normalized[i] == points[i]);
+        BOOST_CHECK(normalized[i].to_affine() == points[i].to_affine());
+        if (!points[i].is_zero()) {
+            BOOST_CHECK(normalized[i].Z == decltype(normalized[i].Z)::one());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(batch_inverse_test_suite)
+
+BOOST_AUTO_TEST_CASE(batch_inverse_fields) {
+    check_batch_inverse<fields::bls12_fr<381>>(0, 1);
+    check_batch_inverse<fields::bls12_fr<381>>(1, 1);
+    check_batch_inverse<fields::bls12_fr<381>>(100, 1);
+    check_batch_inverse<fields::bls12_fr<381>>(100, 3);
+    check_batch_inverse<fields::bls12_fq<381>>(64, 4);
+    check_batch_inverse<curves::bls12<381>::g2_type<>::field_type>(32, 2);
+    check_batch_inverse<curves::bls12<381>::gt_type>(8, 2);
+}
+
+BOOST_AUTO_TEST_CASE(batch_inverse_all_zeros) {
+    typedef fields::bls12_fr<381>::value_type value_type;
+
+    std::vector<value_type> elements(10, value_type::zero());
+    batch_inverse(elements);
+
+    for (const auto &e : elements) {
+        BOOST_CHECK(e.is_zero());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batch_normalize_curves) {
+    check_batch_normalize<curves::bls12<381>::g1_type<>>(50, 1);
+    check_batch_normalize<curves::bls12<381>::g1_type<>>(50, 4);
+    check_batch_normalize<curves::bls12<381>::g2_type<>>(20, 2);
+    check_batch_normalize<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>(20, 2);
+    check_batch_normalize<curves::secp_r1<256>::g1_type<curves::coordinates::projective_with_a4_minus_3>>(20, 2);
+    check_batch_normalize<curves::curve25519::g1_type<>>(20, 2);
+}
+
+BOOST_AUTO_TEST_CASE(scoped_executor_drives_batch_inverse) {
+    typedef fields::bls12_scalar_field<381> field_type;
+    typedef typename field_type::value_type value_type;
+
+    nil::crypto3::parallelization::thread_pool pool(4);
+    nil::crypto3::parallelization::scoped_executor scope(pool);
+    BOOST_CHECK_EQUAL(detail::batch_default_chunks_count(), 4);
+
+    std::vector<value_type> elements(1000);
+    for (auto &element : elements) {
+        element = random_element<field_type>();
+    }
+
+    std::vector<value_type> inverses = elements;
+    batch_inverse(inverses);
+
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+        BOOST_CHECK(elements[i].is_zero() || elements[i] * inverses[i] == value_type::one());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
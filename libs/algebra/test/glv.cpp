@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_glv_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType>
+void check_glv(std::size_t samples_count) {
+    typedef typename GroupType::value_type value_type;
+    typedef curves::detail::glv_functions<value_type> glv_type;
+    typedef typename glv_type::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_value_type;
+    typedef typename scalar_field_type::integral_type integral_type;
+
+    static_assert(curves::detail::is_glv_scalar_mul_enabled<value_type, scalar_value_type>::value,
+                  "GLV params are expected for the group");
+
+    const value_type one = value_type::one();
+
+    // phi acts as lambda on the prime order subgroup
+    BOOST_CHECK(glv_type::endomorphism(one) == one * integral_type(glv_type::glv_params_type::lambda.data));
+
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(), scalar_value_type::one(),
+                                              -scalar_value_type::one(),
+                                              scalar_value_type(scalar_field_type::modulus >> 1u),
+                                              glv_type::glv_params_type::lambda};
+    for (std::size_t i = 0; i < samples_count; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    for (const scalar_value_type &k : scalars) {
+        integral_type k1, k2;
+        bool k1_negative, k2_negative;
+        glv_type::decompose(k, k1, k1_negative, k2, k2_negative);
+
+        const scalar_value_type k1_value = k1_negative ? -scalar_value_type(k1) : scalar_value_type(k1);
+        const scalar_value_type k2_value = k2_negative ? -scalar_value_type(k2) : scalar_value_type(k2);
+        BOOST_CHECK(k1_value + k2_value * glv_type::glv_params_type::lambda == k);
+        BOOST_CHECK(k1.is_zero() || boost::multiprecision::msb(k1) <= scalar_field_type::modulus_bits / 2 + 2);
+        BOOST_CHECK(k2.is_zero() || boost::multiprecision::msb(k2) <= scalar_field_type::modulus_bits / 2 + 2);
+
+        const value_type p = random_element<GroupType>();
+        // integral scalars keep the plain double-and-add path
+        const value_type expected = p * integral_type(k.data);
+
+        BOOST_CHECK(p * k == expected);
+        BOOST_CHECK(k * p == expected);
+
+        value_type q = p;
+        q *= k;
+        BOOST_CHECK(q == expected);
+    }
+}
+
+template<typename GroupType>
+void check_glv_multiexp(std::size_t size) {
+    typedef typename GroupType::value_type value_type;
+    typedef typename curves::detail::glv_functions<value_type>::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_value_type;
+    typedef typename scalar_field_type::integral_type integral_type;
+
+    std::vector<value_type> bases;
+    std::vector<scalar_value_type> scalars;
+    value_type expected = value_type::zero();
+    for (std::size_t i = 0; i < size; ++i) {
+        bases.emplace_back(random_element<GroupType>());
+        scalars.emplace_back(random_element<scalar_field_type>());
+        expected = expected + bases.back() * integral_type(scalars.back().data);
+    }
+
+    BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                           scalars.cend(), 1) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE(glv_test_suite)
+
+BOOST_AUTO_TEST_CASE(glv_scalar_mul) {
+    check_glv<curves::secp_k1<256>::g1_type<>>(20);
+    check_glv<curves::alt_bn128<254>::g1_type<>>(20);
+    check_glv<curves::alt_bn128<254>::g2_type<>>(10);
+    check_glv<curves::bls12<381>::g1_type<>>(20);
+    check_glv<curves::bls12<381>::g2_type<>>(10);
+    check_glv<curves::pallas::g1_type<>>(20);
+    check_glv<curves::vesta::g1_type<>>(20);
+}
+
+BOOST_AUTO_TEST_CASE(glv_multiexp) {
+    check_glv_multiexp<curves::secp_k1<256>::g1_type<>>(64);
+    check_glv_multiexp<curves::bls12<381>::g1_type<>>(64);
+    check_glv_multiexp<curves::bls12<381>::g2_type<>>(16);
+    check_glv_multiexp<curves::pallas::g1_type<>>(64);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,68 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_TEST_TOOLS_CURVE_POINTS_HPP
+#define CRYPTO3_ALGEBRA_TEST_TOOLS_CURVE_POINTS_HPP
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace test_tools {
+                /// Random point of the whole curve group y^2 = x^3 + b. It lies outside of the prime order
+                /// subgroup with overwhelming probability when the cofactor is non-trivial.
+                template<typename GroupType>
+                typename GroupType::value_type random_curve_point() {
+                    typedef typename GroupType::value_type value_type;
+                    typedef typename GroupType::field_type::value_type field_value_type;
+                    typedef typename value_type::params_type params_type;
+
+                    while (true) {
+                        const field_value_type x = random_element<typename GroupType::field_type>();
+                        const field_value_type y2 = x.pow(3u) + field_value_type(params_type::b);
+                        if (y2.is_square()) {
+                            return value_type(x, y2.sqrt(), field_value_type::one());
+                        }
+                    }
+                }
+
+                /// Non-zero point whose order divides the cofactor: a random curve point multiplied by the
+                /// subgroup order. It is on the curve but not in the prime order subgroup.
+                template<typename GroupType>
+                typename GroupType::value_type small_order_point() {
+                    while (true) {
+                        const typename GroupType::value_type p =
+                            random_curve_point<GroupType>() * GroupType::curve_type::q;
+                        if (!p.is_zero()) {
+                            return p;
+                        }
+                    }
+                }
+            }    // namespace test_tools
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_TEST_TOOLS_CURVE_POINTS_HPP
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE algebra_memory_arena_test
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/memory/arena_allocator.hpp>
+#include <nil/crypto3/memory/memory_arena.hpp>
+
+using namespace nil::crypto3::memory;
+
+BOOST_AUTO_TEST_SUITE(memory_arena_test_suite)
+
+BOOST_AUTO_TEST_CASE(freed_blocks_are_reused) {
+    memory_arena arena;
+
+    void *first = arena.allocate(1000);
+    arena.deallocate(first, 1000);
+    // Rounded up to the same size class
+    void *second = arena.allocate(1010);
+    BOOST_CHECK(first == second);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(second) % memory_arena::cache_line_size, 0);
+
+    void *third = arena.allocate(1000);
+    BOOST_CHECK(third != second);
+
+    arena_statistics stats = arena.statistics();
+    BOOST_CHECK_EQUAL(stats.allocations, 3);
+    BOOST_CHECK_EQUAL(stats.reuses, 1);
+    BOOST_CHECK_EQUAL(stats.bytes_allocated, 2 * 1024);
+    BOOST_CHECK_EQUAL(stats.bytes_in_use, 2 * 1024);
+    BOOST_CHECK_EQUAL(stats.peak_bytes_in_use, 2 * 1024);
+
+    arena.deallocate(second, 1010);
+    arena.deallocate(third, 1000);
+    stats = arena.statistics();
+    BOOST_CHECK_EQUAL(stats.bytes_in_use, 0);
+    BOOST_CHECK_EQUAL(stats.bytes_cached, 2 * 1024);
+    BOOST_CHECK_CLOSE(stats.reuse_rate(), 1. / 3, 1e-9);
+
+    arena.release();
+    BOOST_CHECK_EQUAL(arena.statistics().bytes_cached, 0);
+}
+
+BOOST_AUTO_TEST_CASE(large_blocks_are_huge_page_aligned) {
+    memory_arena arena;
+
+    const std::size_t bytes = memory_arena::huge_page_size + 1;
+    char *block = static_cast<char *>(arena.allocate(bytes));
+#ifdef __linux__
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(block) % memory_arena::huge_page_size, 0);
+#endif
+    block[0] = 1;
+    block[bytes - 1] = 2;
+    arena.deallocate(block, bytes);
+
+    BOOST_CHECK_EQUAL(arena.statistics().bytes_cached, 2 * memory_arena::huge_page_size);
+}
+
+BOOST_AUTO_TEST_CASE(cache_is_bounded) {
+    memory_arena arena(4096);
+
+    void *a = arena.allocate(4096);
+    void *b = arena.allocate(4096);
+    arena.deallocate(a, 4096);
+    arena.deallocate(b, 4096);
+
+    BOOST_CHECK_EQUAL(arena.statistics().bytes_cached, 4096);
+}
+
+BOOST_AUTO_TEST_CASE(allocator_follows_scoped_arena) {
+    memory_arena arena;
+
+    std::vector<std::uint64_t, arena_allocator<std::uint64_t>> outside(16);
+    BOOST_CHECK(outside.get_allocator().arena() == nullptr);
+
+    {
+        scoped_memory_arena scope(arena);
+        BOOST_CHECK(current_arena() == &arena);
+
+        std::vector<std::uint64_t, arena_allocator<std::uint64_t>> inside(16, 7);
+        BOOST_CHECK(inside.get_allocator().arena() == &arena);
+        BOOST_CHECK_EQUAL(arena.statistics().bytes_in_use, 128);
+
+        // The allocator moves along, so the arena gets its block back
+        outside = std::move(inside);
+        BOOST_CHECK(outside.get_allocator().arena() == &arena);
+    }
+    BOOST_CHECK(current_arena() == nullptr);
+
+    BOOST_CHECK_EQUAL(outside[15], 7);
+    outside = std::vector<std::uint64_t, arena_allocator<std::uint64_t>>();
+    BOOST_CHECK_EQUAL(arena.statistics().bytes_in_use, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -145,6 +145,10 @@ void check_pairing_operations(std::vector<Fr_value_type> const& Fr_elements,
     BOOST_CHECK_EQUAL(precompute_g2<CurveType>(G2_elements[B2]), G2_prec_elements[prec_B2]);
     BOOST_CHECK_EQUAL(pair<CurveType>(G1_elements[A1], G2_elements[B1]), GT_elements[pairing_A1_B1]);
     BOOST_CHECK_EQUAL(pair<CurveType>(G1_elements[A2], G2_elements[B2]), GT_elements[pairing_A2_B2]);
+    BOOST_CHECK_EQUAL(pair<CurveType>(G1_elements[A1], G2_prec_elements[prec_B1]), GT_elements[pairing_A1_B1]);
+    BOOST_CHECK_EQUAL(pair<CurveType>(G1_elements[A2], G2_prec_elements[prec_B2]), GT_elements[pairing_A2_B2]);
+    BOOST_CHECK_EQUAL(pair_reduced<CurveType>(G1_elements[A1], G2_prec_elements[prec_B1]),
+                      pair_reduced<CurveType>(G1_elements[A1], G2_elements[B1]));
     std::cout << " * Precomputing and pairing tests finished." << std::endl << std::endl;
 
     // TODO: activate after pair_reduceding->cyclotomic_exp fixed. Bugs in final_exponentiation_last_chunk
@@ -194,6 +198,15 @@ void check_pairing_operations(std::vector<Fr_value_type> const& Fr_elements,
                           miller_loop<CurveType>(G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]),
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(G1_prec_elements, G2_prec_elements),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(
+                          std::vector<g1_precomp_value_type>({G1_prec_elements[prec_A1], G1_prec_elements[prec_A2],
+                                                              G1_prec_elements[prec_A1]}),
+                          std::vector<g2_precomp_value_type>({G2_prec_elements[prec_B1], G2_prec_elements[prec_B2],
+                                                              G2_prec_elements[prec_B2]})),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2] *
+                          miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B2]));
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
 }
 
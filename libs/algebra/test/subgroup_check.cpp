@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_subgroup_check_test
+
+#include <type_traits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/psi.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/test_tools/curve_points.hpp>
+
+using namespace nil::crypto3::algebra;
+using nil::crypto3::algebra::test_tools::random_curve_point;
+
+template<typename GroupType>
+bool generic_subgroup_check(const typename GroupType::value_type &p) {
+    return curves::detail::subgroup_check_impl(p, std::false_type());
+}
+
+template<typename GroupType>
+void check_subgroup_check(std::size_t samples_count) {
+    typedef typename GroupType::value_type value_type;
+
+    static_assert(curves::detail::is_endomorphism_subgroup_check_enabled<value_type>::value,
+                  "endomorphism subgroup check is expected for the group");
+
+    BOOST_CHECK(curves::detail::subgroup_check(value_type::zero()));
+    BOOST_CHECK(curves::detail::subgroup_check(value_type::one()));
+
+    for (std::size_t i = 0; i < samples_count; ++i) {
+        BOOST_CHECK(curves::detail::subgroup_check(random_element<GroupType>()));
+
+        const value_type p = random_curve_point<GroupType>();
+        BOOST_CHECK(p.is_well_formed());
+        BOOST_CHECK_EQUAL(curves::detail::subgroup_check(p), generic_subgroup_check<GroupType>(p));
+        BOOST_CHECK(!curves::detail::subgroup_check(p));
+    }
+}
+
+template<typename GroupType>
+void check_psi(std::size_t samples_count) {
+    typedef typename GroupType::value_type value_type;
+    typedef curves::detail::psi_functions<value_type> psi_type;
+
+    for (std::size_t i = 0; i < samples_count; ++i) {
+        const value_type p = random_element<GroupType>();
+        // psi acts as multiplication by the base field characteristic on G2
+        BOOST_CHECK(psi_type::process(p) == p * GroupType::curve_type::base_field_type::modulus);
+        BOOST_CHECK(psi_type::process(p).is_well_formed());
+    }
+}
+
+// h_eff of the BLS12-381 G2 hash-to-curve suites, RFC 9380 section 8.8.2
+constexpr static const auto bls12_381_g2_h_eff =
+    0xbc69f08f2ee75b3584c6a0ea91b352888e2a8e9145ad7689986ff031508ffe1329c2f178731db956d82bf015d1212b02ec0ec69d7477c1ae954cbc06689f6a359894c0adebbf6b4e8020005aaa95551_cppui_modular636;
+
+template<typename GroupType, typename EffectiveCofactor>
+void check_psi_cofactor_clearing(std::size_t samples_count, const EffectiveCofactor &h_eff) {
+    typedef typename GroupType::value_type value_type;
+    typedef curves::detail::psi_functions<value_type> psi_type;
+
+    static_assert(curves::detail::is_psi_cofactor_clearing_enabled<value_type>::value,
+                  "psi cofactor clearing is expected for the group");
+
+    BOOST_CHECK(psi_type::clear_cofactor(value_type::zero()).is_zero());
+
+    for (std::size_t i = 0; i < samples_count; ++i) {
+        const value_type p = random_curve_point<GroupType>();
+        const value_type q = random_curve_point<GroupType>();
+
+        const value_type cleared = psi_type::clear_cofactor(p);
+        BOOST_CHECK(cleared.is_well_formed());
+        BOOST_CHECK(generic_subgroup_check<GroupType>(cleared));
+        BOOST_CHECK(cleared == p * h_eff);
+        BOOST_CHECK(psi_type::clear_cofactor(p + q) == cleared + psi_type::clear_cofactor(q));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(subgroup_check_test_suite)
+
+BOOST_AUTO_TEST_CASE(endomorphism_subgroup_check) {
+    check_subgroup_check<curves::bls12<381>::g1_type<>>(10);
+    check_subgroup_check<curves::bls12<381>::g2_type<>>(10);
+    check_subgroup_check<curves::alt_bn128<254>::g2_type<>>(10);
+}
+
+BOOST_AUTO_TEST_CASE(psi_endomorphism) {
+    check_psi<curves::bls12<381>::g2_type<>>(10);
+    check_psi<curves::alt_bn128<254>::g2_type<>>(10);
+}
+
+BOOST_AUTO_TEST_CASE(psi_cofactor_clearing) {
+    check_psi_cofactor_clearing<curves::bls12<381>::g2_type<>>(10, bls12_381_g2_h_eff);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
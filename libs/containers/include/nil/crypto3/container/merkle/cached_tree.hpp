@@ -0,0 +1,385 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MERKLE_CACHED_TREE_HPP
+#define CRYPTO3_MERKLE_CACHED_TREE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CRYPTO3_CONTAINERS_HAS_MMAP
+#endif
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+#include <nil/crypto3/container/raw_storable.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace containers {
+            namespace detail {
+                /** @brief Leaf hashes of a cached Merkle tree.
+                 *
+                 * Hashes are kept in memory if no path is given. Otherwise they are written to the file at path,
+                 * which is mapped back once all of them are appended, so pages are read only for the leaves
+                 * that are opened. The file is removed right after it is mapped. Only raw storable hashes
+                 * can go to a file, as their bytes are written and mapped back as they are.
+                 */
+                template<typename ValueType>
+                class merkle_leaves_storage {
+                public:
+                    typedef ValueType value_type;
+
+                    constexpr static const bool is_file_storable = is_raw_storable<value_type>::value;
+
+                    merkle_leaves_storage() = default;
+
+                    explicit merkle_leaves_storage(const std::string &path) : _path(path) {
+                        if (!_path.empty()) {
+                            if (!is_file_storable) {
+                                throw std::invalid_argument("Leaf hashes of this type cannot be stored in a file");
+                            }
+                            _out.open(_path, std::ios::binary | std::ios::trunc);
+                            if (!_out) {
+                                throw std::runtime_error("Cannot create " + _path);
+                            }
+                        }
+                    }
+
+                    merkle_leaves_storage(const merkle_leaves_storage &) = delete;
+                    merkle_leaves_storage &operator=(const merkle_leaves_storage &) = delete;
+
+                    merkle_leaves_storage(merkle_leaves_storage &&other) noexcept {
+                        swap(other);
+                    }
+
+                    merkle_leaves_storage &operator=(merkle_leaves_storage &&other) noexcept {
+                        merkle_leaves_storage tmp(std::move(other));
+                        swap(tmp);
+                        return *this;
+                    }
+
+                    ~merkle_leaves_storage() {
+#ifdef CRYPTO3_CONTAINERS_HAS_MMAP
+                        if (_mapping != nullptr) {
+                            ::munmap(_mapping, _size * sizeof(value_type));
+                        }
+#endif
+                    }
+
+                    void append(const value_type *values, std::size_t count) {
+                        if (_path.empty()) {
+                            _values.insert(_values.end(), values, values + count);
+                        } else if constexpr (is_file_storable) {
+                            write_file(values, count);
+                        }
+                        _size += count;
+                    }
+
+                    void finalize() {
+                        if (_path.empty()) {
+                            _data = _values.data();
+                        } else if constexpr (is_file_storable) {
+                            read_file();
+                        }
+                    }
+
+                    const value_type &operator[](std::size_t i) const {
+                        return _data[i];
+                    }
+
+                    const value_type *data() const {
+                        return _data;
+                    }
+
+                    std::size_t size() const {
+                        return _size;
+                    }
+
+                    bool is_mapped() const {
+                        return !_path.empty();
+                    }
+
+                    void swap(merkle_leaves_storage &other) noexcept {
+                        std::swap(_path, other._path);
+                        std::swap(_out, other._out);
+                        std::swap(_values, other._values);
+                        std::swap(_data, other._data);
+                        std::swap(_size, other._size);
+                        std::swap(_mapping, other._mapping);
+                    }
+
+                private:
+                    void write_file(const value_type *values, std::size_t count) {
+                        static_assert(is_raw_storable<value_type>::value,
+                                      "leaf hashes are written as raw bytes");
+                        // Hashes are written in their in-memory form, the file is never read by another
+                        // process or build.
+                        _out.write(reinterpret_cast<const char *>(values), count * sizeof(value_type));
+                        if (!_out) {
+                            throw std::runtime_error("Cannot write " + _path);
+                        }
+                    }
+
+                    void read_file() {
+                        static_assert(is_raw_storable<value_type>::value,
+                                      "leaf hashes are mapped back from raw bytes");
+                        _out.close();
+#ifdef CRYPTO3_CONTAINERS_HAS_MMAP
+                        int fd = ::open(_path.c_str(), O_RDONLY);
+                        if (fd < 0) {
+                            throw std::runtime_error("Cannot open " + _path);
+                        }
+                        if (_size > 0) {
+                            void *mapping = ::mmap(nullptr, _size * sizeof(value_type), PROT_READ, MAP_PRIVATE, fd, 0);
+                            if (mapping == MAP_FAILED) {
+                                ::close(fd);
+                                throw std::runtime_error("Cannot map " + _path);
+                            }
+                            _mapping = mapping;
+                            _data = static_cast<const value_type *>(mapping);
+                        }
+                        ::close(fd);
+#else
+                        std::ifstream in(_path, std::ios::binary);
+                        _values.resize(_size);
+                        in.read(reinterpret_cast<char *>(_values.data()), _size * sizeof(value_type));
+                        if (!in) {
+                            throw std::runtime_error("Cannot read " + _path);
+                        }
+                        _data = _values.data();
+#endif
+                        std::remove(_path.c_str());
+                    }
+
+                    std::string _path;
+                    std::ofstream _out;
+                    std::vector<value_type> _values;
+                    const value_type *_data = nullptr;
+                    std::size_t _size = 0;
+                    void *_mapping = nullptr;
+                };
+
+                /** @brief Merkle tree which keeps only its upper rows in memory.
+                 *
+                 * Rows are split in three parts:
+                 *  - the leaf hashes, kept in memory or in a mapped file (see merkle_leaves_storage);
+                 *  - rows_to_discard rows right above the leaves, which are not stored at all;
+                 *  - the rows above them up to the root, kept in memory in the layout of merkle_tree_impl.
+                 *    Their length is merkle_tree_cache_size(leaves, Arity, rows_to_discard).
+                 *
+                 * A path is read from the leaf hashes and the cached rows, the discarded part is rebuilt
+                 * from the Arity^(rows_to_discard + 1) leaves under the lowest cached node, so each
+                 * opening costs about that many hashes. The root and paths are the same as for
+                 * make_merkle_tree over the same leaves.
+                 */
+                template<typename NodeType, std::size_t Arity = 2>
+                class cached_merkle_tree_impl {
+                public:
+                    typedef NodeType node_type;
+                    typedef typename node_type::hash_type hash_type;
+
+                    typedef typename node_type::value_type value_type;
+                    constexpr static const std::size_t value_bits = node_type::value_bits;
+                    constexpr static const std::size_t arity = Arity;
+
+                    typedef std::vector<value_type> container_type;
+                    typedef merkle_leaves_storage<value_type> storage_type;
+
+                    /*!
+                     * @param rows_to_discard rows above the leaves which are rebuilt on demand, the root row is
+                     * always cached
+                     * @param leaves_path file for the leaf hashes, they are kept in memory if it is empty
+                     */
+                    template<typename LeafIterator>
+                    cached_merkle_tree_impl(LeafIterator first, LeafIterator last, std::size_t rows_to_discard,
+                                            const std::string &leaves_path = std::string()) :
+                        _leaves(std::distance(first, last)),
+                        _rc(detail::merkle_tree_row_count(_leaves, Arity)), _rows_to_discard(rows_to_discard),
+                        _storage(leaves_path) {
+                        BOOST_ASSERT_MSG(pow(Arity, round(std::log(_leaves) / std::log(Arity))) == _leaves,
+                                         "Wrong leaves number, it must be a power of Arity.");
+                        if (_rows_to_discard > 0 && _rows_to_discard + 1 >= _rc) {
+                            throw std::invalid_argument("Merkle tree has not enough rows to discard");
+                        }
+
+                        _cache.reserve(detail::merkle_tree_cache_size(_leaves, Arity, _rows_to_discard));
+
+                        const std::size_t block_size = std::min(_leaves, subtree_size());
+                        container_type row;
+                        row.reserve(block_size);
+                        while (first != last) {
+                            row.clear();
+                            for (std::size_t i = 0; i < block_size; ++i) {
+                                row.emplace_back(crypto3::hash<hash_type>(*first++));
+                            }
+                            _storage.append(row.data(), row.size());
+                            if (_rc > 1) {
+                                for (std::size_t i = 0; i <= _rows_to_discard; ++i) {
+                                    reduce_row(row);
+                                }
+                                _cache.emplace_back(row.front());
+                            }
+                        }
+                        _storage.finalize();
+
+                        std::size_t row_begin = 0;
+                        for (std::size_t row_size = _cache.size(); row_size > 1; row_size /= Arity) {
+                            for (std::size_t i = 0; i < row_size; i += Arity) {
+                                auto it = _cache.cbegin() + row_begin + i;
+                                _cache.emplace_back(generate_hash<hash_type>(it, it + Arity));
+                            }
+                            row_begin += row_size;
+                        }
+                        BOOST_ASSERT(_cache.size() == detail::merkle_tree_cache_size(_leaves, Arity, _rows_to_discard));
+                    }
+
+                    cached_merkle_tree_impl(cached_merkle_tree_impl &&) = default;
+                    cached_merkle_tree_impl &operator=(cached_merkle_tree_impl &&) = default;
+
+                    value_type root() const {
+                        return _rc == 1 ? _storage[0] : _cache.back();
+                    }
+
+                    const value_type &leaf(std::size_t leaf_idx) const {
+                        return _storage[leaf_idx];
+                    }
+
+                    /*!
+                     * @brief Children of every node on the path from the leaf to the root, Arity values per
+                     * row starting from the leaf row. Used to build merkle_proof.
+                     */
+                    container_type path_hashes(std::size_t leaf_idx) const {
+                        if (leaf_idx >= _leaves) {
+                            throw std::out_of_range("Merkle tree leaf index is out of range");
+                        }
+                        container_type result;
+                        if (_rc == 1) {
+                            return result;
+                        }
+                        result.reserve((_rc - 1) * Arity);
+
+                        const std::size_t block_size = subtree_size();
+                        const std::size_t block = leaf_idx / block_size;
+                        container_type row(_storage.data() + block * block_size,
+                                           _storage.data() + (block + 1) * block_size);
+                        std::size_t idx = leaf_idx % block_size;
+                        for (std::size_t i = 0; i <= _rows_to_discard; ++i, idx /= Arity) {
+                            auto it = row.cbegin() + (idx - idx % Arity);
+                            result.insert(result.end(), it, it + Arity);
+                            reduce_row(row);
+                        }
+                        BOOST_ASSERT(row.front() == _cache[block]);
+
+                        idx = block;
+                        std::size_t row_begin = 0;
+                        for (std::size_t row_size = _leaves / block_size; row_size > 1;
+                             row_begin += row_size, row_size /= Arity, idx /= Arity) {
+                            auto it = _cache.cbegin() + row_begin + (idx - idx % Arity);
+                            result.insert(result.end(), it, it + Arity);
+                        }
+                        return result;
+                    }
+
+                    std::size_t row_count() const {
+                        return _rc;
+                    }
+
+                    std::size_t leaves() const {
+                        return _leaves;
+                    }
+
+                    std::size_t rows_to_discard() const {
+                        return _rows_to_discard;
+                    }
+
+                    // Number of hashes held in memory besides the leaves
+                    std::size_t cache_size() const {
+                        return _cache.size();
+                    }
+
+                    bool is_leaves_mapped() const {
+                        return _storage.is_mapped();
+                    }
+
+                private:
+                    // Leaves under one node of the lowest cached row
+                    std::size_t subtree_size() const {
+                        std::size_t result = Arity;
+                        for (std::size_t i = 0; i < _rows_to_discard; ++i) {
+                            result *= Arity;
+                        }
+                        return result;
+                    }
+
+                    // Replaces a row by its parent row
+                    static void reduce_row(container_type &row) {
+                        const std::size_t parents = row.size() / Arity;
+                        for (std::size_t i = 0; i < parents; ++i) {
+                            row[i] = generate_hash<hash_type>(row.cbegin() + i * Arity, row.cbegin() + (i + 1) * Arity);
+                        }
+                        row.resize(parents);
+                    }
+
+                    std::size_t _leaves;
+                    std::size_t _rc;
+                    std::size_t _rows_to_discard;
+                    storage_type _storage;
+                    container_type _cache;
+                };
+            }    // namespace detail
+
+            template<typename T, std::size_t Arity>
+            using cached_merkle_tree = typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                    detail::cached_merkle_tree_impl<detail::merkle_tree_node<T>, Arity>,
+                    detail::cached_merkle_tree_impl<T, Arity>>::type;
+
+            /*!
+             * @brief Builds a Merkle tree which caches only the rows above the lowest rows_to_discard + 1 rows.
+             * Leaf hashes are written to leaves_path and mapped if it is not empty.
+             */
+            template<typename T, std::size_t Arity, typename LeafIterator>
+            cached_merkle_tree<T, Arity> make_cached_merkle_tree(LeafIterator first, LeafIterator last,
+                                                                 std::size_t rows_to_discard,
+                                                                 const std::string &leaves_path = std::string()) {
+                return cached_merkle_tree<T, Arity>(first, last, rows_to_discard, leaves_path);
+            }
+        }    // namespace containers
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MERKLE_CACHED_TREE_HPP
@@ -0,0 +1,229 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MERKLE_MULTIPROOF_HPP
+#define CRYPTO3_MERKLE_MULTIPROOF_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/hash/type_traits.hpp>
+#include <nil/crypto3/container/merkle/tree.hpp>
+#include <nil/crypto3/container/merkle/cached_tree.hpp>
+
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace containers {
+            namespace detail {
+                /** @brief Opening of several leaves of one Merkle tree.
+                 *
+                 * Holds the union of the nodes the paths of all leaves need, without the nodes that can be
+                 * computed from the opened leaves. Nodes go row by row from the leaves to the root and by
+                 * index inside a row. Leaves are sorted and distinct, the opened values are passed to
+                 * validate() in the order of leaf_indices().
+                 *
+                 * validate() hashes a whole row at once: the parents of a row are independent messages of
+                 * the same length, so they are hashed in parallel (and suit multi-buffer hash backends).
+                 */
+                template<typename NodeType, std::size_t Arity = 2>
+                class merkle_multiproof_impl {
+                public:
+                    typedef NodeType node_type;
+                    typedef typename node_type::hash_type hash_type;
+
+                    constexpr static const std::size_t arity = Arity;
+
+                    constexpr static const std::size_t value_bits = node_type::value_bits;
+                    typedef typename node_type::value_type value_type;
+
+                    merkle_multiproof_impl() : _row_count(0), _root(value_type()) {};
+
+                    merkle_multiproof_impl(std::size_t row_count, value_type root, std::vector<std::size_t> leaf_idxs,
+                                           std::vector<value_type> nodes) :
+                        _row_count(row_count), _root(root), _leaf_idxs(leaf_idxs), _nodes(nodes) {};
+
+                    merkle_multiproof_impl(const merkle_tree_impl<NodeType, Arity> &tree,
+                                           const std::vector<std::size_t> &leaf_idxs) :
+                        _row_count(tree.row_count()), _root(tree.root()), _leaf_idxs(sorted_leaves(tree, leaf_idxs)) {
+                        std::vector<std::size_t> row_begins(1, 0);
+                        for (std::size_t row_len = tree.leaves(); row_len > 1; row_len /= Arity) {
+                            row_begins.push_back(row_begins.back() + row_len);
+                        }
+                        collect_nodes([&tree, &row_begins](std::size_t row, std::size_t idx, std::size_t) {
+                            return tree[row_begins[row] + idx];
+                        });
+                    }
+
+                    merkle_multiproof_impl(const cached_merkle_tree_impl<NodeType, Arity> &tree,
+                                           const std::vector<std::size_t> &leaf_idxs) :
+                        _row_count(tree.row_count()), _root(tree.root()), _leaf_idxs(sorted_leaves(tree, leaf_idxs)) {
+                        // Every needed node is a sibling on the path of some opened leaf
+                        std::vector<std::vector<value_type>> paths(_leaf_idxs.size());
+                        parallelization::parallel_for(0, _leaf_idxs.size(), [this, &tree, &paths](std::size_t i) {
+                            paths[i] = tree.path_hashes(_leaf_idxs[i]);
+                        });
+                        collect_nodes([&paths](std::size_t row, std::size_t idx, std::size_t leaf) {
+                            return paths[leaf][row * Arity + idx % Arity];
+                        });
+                    }
+
+                    template<typename Hashable>
+                    bool validate(const std::vector<Hashable> &a) const {
+                        if (a.size() != _leaf_idxs.size() || a.empty()) {
+                            return false;
+                        }
+
+                        std::vector<value_type> values(a.size());
+                        parallelization::parallel_for(0, a.size(), [&values, &a](std::size_t i) {
+                            values[i] = crypto3::hash<hash_type>(a[i]);
+                        });
+
+                        std::vector<std::size_t> known = _leaf_idxs;
+                        std::vector<std::size_t> parents;
+                        std::vector<const value_type *> inputs;
+                        std::size_t node_idx = 0;
+                        for (std::size_t row = 0; row + 1 < _row_count; ++row) {
+                            parents.clear();
+                            inputs.clear();
+                            for (std::size_t i = 0; i < known.size();) {
+                                const std::size_t parent = known[i] / Arity;
+                                for (std::size_t child = parent * Arity; child < (parent + 1) * Arity; ++child) {
+                                    if (i < known.size() && known[i] == child) {
+                                        inputs.push_back(&values[i++]);
+                                    } else if (node_idx < _nodes.size()) {
+                                        inputs.push_back(&_nodes[node_idx++]);
+                                    } else {
+                                        return false;
+                                    }
+                                }
+                                parents.push_back(parent);
+                            }
+
+                            std::vector<value_type> parent_values(parents.size());
+                            parallelization::parallel_for(0, parents.size(), [&parent_values, &inputs](std::size_t i) {
+                                accumulator_set<hash_type> acc;
+                                for (std::size_t j = 0; j < Arity; ++j) {
+                                    crypto3::hash<hash_type>(*inputs[i * Arity + j], acc);
+                                }
+                                parent_values[i] = accumulators::extract::hash<hash_type>(acc);
+                            });
+                            values = std::move(parent_values);
+                            std::swap(known, parents);
+                        }
+                        return node_idx == _nodes.size() && known.size() == 1 && known[0] == 0 && values[0] == _root;
+                    }
+
+                    bool operator==(const merkle_multiproof_impl &rhs) const {
+                        return _row_count == rhs._row_count && _root == rhs._root && _leaf_idxs == rhs._leaf_idxs &&
+                               _nodes == rhs._nodes;
+                    }
+                    bool operator!=(const merkle_multiproof_impl &rhs) const {
+                        return !(rhs == *this);
+                    }
+
+                    std::size_t row_count() const {
+                        return _row_count;
+                    }
+
+                    const value_type &root() const {
+                        return _root;
+                    }
+
+                    const std::vector<std::size_t> &leaf_indices() const {
+                        return _leaf_idxs;
+                    }
+
+                    const std::vector<value_type> &nodes() const {
+                        return _nodes;
+                    }
+
+                private:
+                    template<typename TreeType>
+                    static std::vector<std::size_t> sorted_leaves(const TreeType &tree,
+                                                                  std::vector<std::size_t> leaf_idxs) {
+                        if (leaf_idxs.empty()) {
+                            throw std::invalid_argument("Merkle multiproof needs at least one leaf");
+                        }
+                        std::sort(leaf_idxs.begin(), leaf_idxs.end());
+                        leaf_idxs.erase(std::unique(leaf_idxs.begin(), leaf_idxs.end()), leaf_idxs.end());
+                        if (leaf_idxs.back() >= tree.leaves()) {
+                            throw std::out_of_range("Merkle tree leaf index is out of range");
+                        }
+                        return leaf_idxs;
+                    }
+
+                    /*!
+                     * @brief Walks the rows in the order validate() consumes nodes.
+                     * @param get_node(row, idx, leaf) returns the node idx of the row, leaf is the position in
+                     * _leaf_idxs of an opened leaf below the node's parent
+                     */
+                    template<typename GetNode>
+                    void collect_nodes(GetNode get_node) {
+                        std::vector<std::size_t> known = _leaf_idxs;
+                        std::vector<std::size_t> origins(known.size());
+                        for (std::size_t i = 0; i < origins.size(); ++i) {
+                            origins[i] = i;
+                        }
+
+                        for (std::size_t row = 0; row + 1 < _row_count; ++row) {
+                            std::vector<std::size_t> parents, parent_origins;
+                            for (std::size_t i = 0; i < known.size();) {
+                                const std::size_t parent = known[i] / Arity;
+                                const std::size_t origin = origins[i];
+                                for (std::size_t child = parent * Arity; child < (parent + 1) * Arity; ++child) {
+                                    if (i < known.size() && known[i] == child) {
+                                        ++i;
+                                    } else {
+                                        _nodes.emplace_back(get_node(row, child, origin));
+                                    }
+                                }
+                                parents.push_back(parent);
+                                parent_origins.push_back(origin);
+                            }
+                            known = std::move(parents);
+                            origins = std::move(parent_origins);
+                        }
+                    }
+
+                    std::size_t _row_count;
+                    value_type _root;
+                    std::vector<std::size_t> _leaf_idxs;
+                    std::vector<value_type> _nodes;
+                };
+            }    // namespace detail
+
+            template<typename T, std::size_t Arity>
+            using merkle_multiproof =
+                typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                                          detail::merkle_multiproof_impl<detail::merkle_tree_node<T>, Arity>,
+                                          detail::merkle_multiproof_impl<T, Arity>>::type;
+        }    // namespace containers
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MERKLE_MULTIPROOF_HPP
@@ -36,6 +36,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/container/merkle/tree.hpp>
+#include <nil/crypto3/container/merkle/cached_tree.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -127,6 +128,21 @@ namespace nil {
                         }
                     }
 
+                    merkle_proof_impl(const cached_merkle_tree_impl<NodeType, Arity> &tree, const std::size_t leaf_idx) :
+                        _li(leaf_idx), _root(tree.root()), _path(tree.row_count() - 1) {
+                        const std::vector<value_type> hashes = tree.path_hashes(leaf_idx);
+                        std::size_t cur_leaf = leaf_idx;
+                        for (std::size_t row = 0; row < _path.size(); ++row, cur_leaf /= arity) {
+                            std::size_t cur_leaf_pos = cur_leaf % arity;
+                            typename layer_type::iterator a_itr = _path[row].begin();
+                            for (std::size_t i = 0; i < arity; ++i) {
+                                if (i != cur_leaf_pos) {
+                                    *a_itr++ = path_element_type(hashes[row * arity + i], i);
+                                }
+                            }
+                        }
+                    }
+
                     template<typename Hashable, typename HashType = typename NodeType::hash_type>
                     bool validate(const Hashable &a) const {
                         using hash_type = typename NodeType::hash_type;
@@ -27,8 +27,10 @@
 #ifndef CRYPTO3_MERKLE_TREE_HPP
 #define CRYPTO3_MERKLE_TREE_HPP
 
-#include <vector>
 #include <cmath>
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
@@ -39,6 +41,8 @@
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace containers {
@@ -46,12 +50,20 @@ namespace nil {
                 // returns next highest power of two from a given number if it is not
                 // already a power of two.
                 inline size_t next_pow2(size_t n) {
-                    return std::pow(2, std::ceil(std::log(n)));
+                    size_t result = 1;
+                    while (result < n) {
+                        result <<= 1;
+                    }
+                    return result;
                 }
 
                 // find power of 2 of a number which is power of 2
                 inline size_t log2_pow2(size_t n) {
-                    return next_pow2(n);
+                    size_t result = 0;
+                    while ((size_t(1) << result) < n) {
+                        ++result;
+                    }
+                    return result;
                 }
 
                 // Row_Count calculation given the number of _leaves in the tree and the branches.
@@ -101,7 +113,6 @@ namespace nil {
                 // Tree length calculation given the number of _leaves in the tree, the
                 // rows_to_discard, and the branches.
                 inline size_t merkle_tree_cache_size(size_t leafs, size_t branches, size_t rows_to_discard) {
-                    size_t shift = log2_pow2(branches);
                     size_t len = merkle_tree_length(leafs, branches);
                     size_t row_count = merkle_tree_row_count(leafs, branches);
 
@@ -114,7 +125,7 @@ namespace nil {
 
                     while (row_count > cache_base) {
                         cache_size -= cur_leafs;
-                        cur_leafs >>= shift;    // cur /= branches
+                        cur_leafs /= branches;
                         row_count -= 1;
                     }
 
@@ -478,25 +489,39 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
+                /**
+                 * Leaves are hashed in parallel when LeafIterator is random access, then every row is hashed
+                 * in parallel from the one below it, since the parents of a row are independent of each other.
+                 */
                 template<typename T, std::size_t Arity, typename LeafIterator>
                 merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
                     typedef T node_type;
                     typedef typename node_type::hash_type hash_type;
 
                     merkle_tree_impl<T, Arity> ret(std::distance(first, last));
-                    ret.reserve(ret.complete_size());
+                    ret.resize(ret.complete_size());
 
-                    while (first != last) {
-                        ret.emplace_back(crypto3::hash<hash_type>(*first++));
+                    typedef typename std::iterator_traits<LeafIterator>::iterator_category iterator_category;
+                    if constexpr (std::is_base_of<std::random_access_iterator_tag, iterator_category>::value) {
+                        parallelization::parallel_for(0, ret.leaves(), [&ret, first](std::size_t i) {
+                            ret[i] = crypto3::hash<hash_type>(first[i]);
+                        });
+                    } else {
+                        for (std::size_t i = 0; first != last; ++i) {
+                            ret[i] = crypto3::hash<hash_type>(*first++);
+                        }
                     }
 
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
-
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        for (size_t i = 0; i < row_size; ++i, it += Arity) {
-                            ret.emplace_back(generate_hash<hash_type>(it, it + Arity));
-                        }
+                    std::size_t row_begin = 0, row_size = ret.leaves();
+                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number) {
+                        const std::size_t parents_begin = row_begin + row_size;
+                        parallelization::parallel_for(
+                            0, row_size / Arity, [&ret, row_begin, parents_begin](std::size_t i) {
+                                typename merkle_tree_impl<T, Arity>::iterator it = ret.begin() + row_begin + i * Arity;
+                                ret[parents_begin + i] = generate_hash<hash_type>(it, it + Arity);
+                            });
+                        row_begin = parents_begin;
+                        row_size /= Arity;
                     }
                     return ret;
                 }
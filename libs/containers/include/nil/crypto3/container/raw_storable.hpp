@@ -0,0 +1,46 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_CONTAINER_RAW_STORABLE_HPP
+#define CRYPTO3_CONTAINER_RAW_STORABLE_HPP
+
+#include <type_traits>
+
+namespace nil {
+    namespace crypto3 {
+        namespace containers {
+            /** @brief Whether values of the type can be written as their in-memory bytes and used in place
+             * after they are mapped back from a file.
+             *
+             * Only trivially copyable types qualify. Every file-backed storage of the suite (cached Merkle
+             * trees, mapped assignment tables and preprocessed data) checks this trait, types that fail it
+             * have to be converted to a raw storable representation first.
+             */
+            template<typename T>
+            struct is_raw_storable : std::is_trivially_copyable<T> { };
+        }    // namespace containers
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_CONTAINER_RAW_STORABLE_HPP
@@ -38,6 +38,8 @@
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
+#include <nil/crypto3/container/merkle/cached_tree.hpp>
+#include <nil/crypto3/container/merkle/multiproof.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -253,6 +255,58 @@ void testing_hash_template(std::vector<Element> data, std::string result) {
     BOOST_CHECK(result == std::to_string(tree.root()));
 }
 
+template<typename Hash, size_t Arity, typename ValueType, std::size_t N>
+void testing_cached_tree_template_random_data(std::size_t leaf_number, std::size_t rows_to_discard,
+                                              const std::string &leaves_path) {
+    auto data = generate_random_data<ValueType, N>(leaf_number);
+    auto tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    auto cached_tree = make_cached_merkle_tree<Hash, Arity>(data.begin(), data.end(), rows_to_discard, leaves_path);
+
+    BOOST_CHECK(cached_tree.root() == tree.root());
+    BOOST_CHECK_EQUAL(cached_tree.row_count(), tree.row_count());
+    BOOST_CHECK_EQUAL(cached_tree.cache_size(),
+                      containers::detail::merkle_tree_cache_size(leaf_number, Arity, rows_to_discard));
+    for (std::size_t i = 0; i < leaf_number; ++i) {
+        merkle_proof<Hash, Arity> proof(tree, i);
+        merkle_proof<Hash, Arity> cached_proof(cached_tree, i);
+        BOOST_CHECK(cached_proof == proof);
+        BOOST_CHECK(cached_proof.validate(data[i]));
+    }
+}
+
+template<typename Hash, size_t Arity, typename ValueType, std::size_t N>
+void testing_validate_template_random_data_multiproof(std::size_t leaf_number, std::size_t opened_number) {
+    auto data = generate_random_data<ValueType, N>(leaf_number);
+    auto tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    auto cached_tree = make_cached_merkle_tree<Hash, Arity>(data.begin(), data.end(), 1);
+
+    std::vector<std::size_t> leaf_idxs;
+    for (std::size_t i = 0; i < opened_number; ++i) {
+        leaf_idxs.push_back(std::rand() % leaf_number);
+    }
+    merkle_multiproof<Hash, Arity> proof(tree, leaf_idxs);
+    BOOST_CHECK(proof == merkle_multiproof<Hash, Arity>(cached_tree, leaf_idxs));
+    BOOST_CHECK(std::is_sorted(proof.leaf_indices().begin(), proof.leaf_indices().end()));
+    BOOST_CHECK(proof.nodes().size() <= proof.leaf_indices().size() * (Arity - 1) * (tree.row_count() - 1));
+
+    std::vector<std::array<ValueType, N>> opened;
+    for (std::size_t leaf_idx : proof.leaf_indices()) {
+        opened.push_back(data[leaf_idx]);
+    }
+    BOOST_CHECK(proof.validate(opened));
+
+    auto wrong_opened = opened;
+    wrong_opened[0][0] = wrong_opened[0][0] + 1u;
+    BOOST_CHECK(!proof.validate(wrong_opened));
+
+    if (!proof.nodes().empty()) {
+        auto nodes = proof.nodes();
+        nodes.pop_back();
+        merkle_multiproof<Hash, Arity> short_proof(proof.row_count(), proof.root(), proof.leaf_indices(), nodes);
+        BOOST_CHECK(!short_proof.validate(opened));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(containers_merkltree_test)
 
 using curve_type = algebra::curves::pallas;
@@ -362,6 +416,33 @@ BOOST_AUTO_TEST_CASE(merkletree_validate_test_5) {
     testing_validate_template_random_data_compressed_proofs<hashes::blake2b<224>, 4, std::uint8_t, 1>(leaf_number);
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_cached_test) {
+    for (std::size_t rows_to_discard = 0; rows_to_discard < 5; ++rows_to_discard) {
+        testing_cached_tree_template_random_data<hashes::sha2<256>, 2, std::uint8_t, 1>(32, rows_to_discard, "");
+        testing_cached_tree_template_random_data<hashes::sha2<256>, 2, std::uint8_t, 1>(
+            32, rows_to_discard, "cached_merkle_tree_leaves.bin");
+    }
+    testing_cached_tree_template_random_data<hashes::blake2b<224>, 3, std::uint8_t, 1>(81, 2, "");
+    testing_cached_tree_template_random_data<poseidon_type, 2, poseidon_type::word_type, 1>(16, 1, "");
+    // Field elements are not trivially copyable, so their leaf hashes cannot go to a file
+    BOOST_CHECK_THROW((testing_cached_tree_template_random_data<poseidon_type, 2, poseidon_type::word_type, 1>(
+                          16, 1, "cached_merkle_tree_leaves.bin")),
+                      std::invalid_argument);
+
+    auto data = generate_random_data<std::uint8_t, 1>(8);
+    BOOST_CHECK_THROW((make_cached_merkle_tree<hashes::sha2<256>, 2>(data.begin(), data.end(), 3)),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_multiproof_test) {
+    testing_validate_template_random_data_multiproof<hashes::sha2<256>, 2, std::uint8_t, 1>(1024, 1);
+    testing_validate_template_random_data_multiproof<hashes::sha2<256>, 2, std::uint8_t, 1>(1024, 40);
+    testing_validate_template_random_data_multiproof<hashes::sha2<256>, 2, std::uint8_t, 1>(64, 64);
+    testing_validate_template_random_data_multiproof<hashes::blake2b<224>, 3, std::uint8_t, 1>(243, 20);
+    testing_validate_template_random_data_multiproof<hashes::md5, 4, std::uint8_t, 1>(256, 30);
+    testing_validate_template_random_data_multiproof<poseidon_type, 2, poseidon_type::word_type, 1>(64, 10);
+}
+
 BOOST_AUTO_TEST_CASE(merkletree_hash_test_1) {
     std::vector<std::array<char, 1>> v = {{'0'}, {'1'}, {'2'}, {'3'}, {'4'}, {'5'}, {'6'}, {'7'}};
     testing_hash_template<hashes::sha2<256>, 2>(v, "3b828c4f4b48c5d4cb5562a474ec9e2fd8d5546fae40e90732ef635892e42720");
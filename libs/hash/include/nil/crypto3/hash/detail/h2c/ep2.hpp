@@ -34,6 +34,8 @@
 
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
+#include <nil/crypto3/algebra/curves/detail/psi.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace hashes {
@@ -108,6 +110,18 @@ namespace nil {
                 }
 
                 static inline group_value_type clear_cofactor(const group_value_type &R) {
+                    return clear_cofactor(
+                        R, algebra::curves::detail::is_psi_cofactor_clearing_enabled<group_value_type>());
+                }
+
+            private:
+                static inline group_value_type clear_cofactor(const group_value_type &R,
+                                                              std::true_type /* psi cofactor clearing */) {
+                    return algebra::curves::detail::psi_functions<group_value_type>::clear_cofactor(R);
+                }
+
+                static inline group_value_type clear_cofactor(const group_value_type &R,
+                                                              std::false_type /* psi cofactor clearing */) {
                     return R * suite_type::h_eff;
                 }
             };
@@ -27,7 +27,9 @@
 #define CRYPTO3_HASH_DETAIL_H2C_FUNCTIONS_HPP
 
 #include <cstdint>
+#include <algorithm>
 #include <array>
+#include <utility>
 #include <vector>
 #include <iterator>
 #include <type_traits>
@@ -36,9 +38,13 @@
 #include <boost/static_assert.hpp>
 #include <boost/concept/assert.hpp>
 
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
 #include <nil/crypto3/hash/detail/h2c/h2c_suites.hpp>
 #include <nil/crypto3/hash/detail/h2c/h2c_policy.hpp>
 
+#include <nil/crypto3/algebra/curves/detail/psi.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace hashes {
@@ -62,7 +68,185 @@ namespace nil {
                     modular_type sign_0 = e.data[0].data % two;
                     bool zero_0 = e.data[0].data.is_zero();
                     modular_type sign_1 = e.data[1].data % two;
-                    return static_cast<bool>(sign_0) || (zero_0 && static_cast<bool>(sign_1));
+                    return static_cast<bool>(sign_0) | (zero_0 & static_cast<bool>(sign_1));
+                }
+
+                /** @brief Overwrites the limbs of r with those of b when c is set, without branching on c.
+                 */
+                template<typename Backend>
+                inline void cmov_limbs(Backend &r, const Backend &b, bool c) {
+                    typedef typename std::remove_cv<
+                        typename std::remove_pointer<decltype(r.limbs())>::type>::type limb_type;
+
+                    const limb_type mask = limb_type(0) - static_cast<limb_type>(c);
+                    for (unsigned i = 0; i < r.size(); ++i) {
+                        r.limbs()[i] ^= mask & (r.limbs()[i] ^ b.limbs()[i]);
+                    }
+                }
+
+                /** @brief Returns b if c is set and a otherwise, the CMOV of the hash-to-curve RFC.
+                 *
+                 * The selection masks the limbs of both arguments instead of branching on c. Both
+                 * arguments are always computed by the callers. The equality tests that produce c use
+                 * the regular field comparison, which is not guaranteed to run in constant time.
+                 */
+                template<typename FieldParams>
+                inline algebra::fields::detail::element_fp<FieldParams>
+                    cmov(const algebra::fields::detail::element_fp<FieldParams> &a,
+                         const algebra::fields::detail::element_fp<FieldParams> &b, bool c) {
+                    algebra::fields::detail::element_fp<FieldParams> result = a;
+                    cmov_limbs(result.data.backend().base_data(), b.data.backend().base_data(), c);
+                    return result;
+                }
+
+                template<typename FieldParams>
+                inline algebra::fields::detail::element_fp2<FieldParams>
+                    cmov(const algebra::fields::detail::element_fp2<FieldParams> &a,
+                         const algebra::fields::detail::element_fp2<FieldParams> &b, bool c) {
+                    return algebra::fields::detail::element_fp2<FieldParams>(cmov(a.data[0], b.data[0], c),
+                                                                              cmov(a.data[1], b.data[1], c));
+                }
+
+                template<typename FieldParams>
+                inline typename FieldParams::integral_type
+                    field_order_minus_one_half(const algebra::fields::detail::element_fp<FieldParams> &) {
+                    return FieldParams::group_order_minus_one_half;
+                }
+
+                template<typename FieldParams>
+                inline typename FieldParams::extended_integral_type
+                    field_order_minus_one_half(const algebra::fields::detail::element_fp2<FieldParams> &) {
+                    return FieldParams::group_order_minus_one_half;
+                }
+
+                /** @brief Constants of sqrt_ratio for a field of order q and a non-square Z.
+                 *
+                 * q - 1 = 2^c1 * c2 with c2 odd, c3 = (c2 - 1) / 2, c6 = Z^c2, c7 = Z^((c2 + 1) / 2).
+                 * https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.2.1.1
+                 */
+                template<typename FieldValueType>
+                struct sqrt_ratio_constants {
+                    typedef decltype(field_order_minus_one_half(std::declval<FieldValueType>())) integral_type;
+
+                    explicit sqrt_ratio_constants(const FieldValueType &Z) {
+                        const integral_type q_minus_one_half = field_order_minus_one_half(Z);
+
+                        c1 = boost::multiprecision::lsb(q_minus_one_half) + 1;
+                        c3 = integral_type(q_minus_one_half >> c1);
+                        c6 = Z.pow(integral_type(q_minus_one_half >> (c1 - 1)));
+                        c7 = Z.pow(integral_type(c3 + 1u));
+                    }
+
+                    std::size_t c1;
+                    integral_type c3;
+                    FieldValueType c6;
+                    FieldValueType c7;
+                };
+
+                /** @brief Computes sqrt(u / v) if u / v is square and sqrt(Z * u / v) otherwise.
+                 *
+                 * Needs one exponentiation and no inversion, unlike is_square() followed by sqrt()
+                 * and a division. v must be non-zero. Returns whether u / v is square.
+                 * https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.2.1.1
+                 */
+                template<typename FieldValueType>
+                inline bool sqrt_ratio(const FieldValueType &u, const FieldValueType &v,
+                                       const sqrt_ratio_constants<FieldValueType> &constants,
+                                       FieldValueType &result) {
+                    static const FieldValueType one = FieldValueType::one();
+
+                    FieldValueType tv1 = constants.c6;
+                    // tv2 = v^(2^c1 - 1)
+                    FieldValueType tv2 = v;
+                    for (std::size_t i = 1; i < constants.c1; ++i) {
+                        tv2 = tv2.squared() * v;
+                    }
+                    FieldValueType tv3 = tv2.squared() * v;
+                    FieldValueType tv5 = (u * tv3).pow(constants.c3) * tv2;
+                    tv2 = tv5 * v;
+                    tv3 = tv5 * u;
+                    FieldValueType tv4 = tv3 * tv2;
+                    // tv5 = tv4^(2^(c1 - 1))
+                    tv5 = tv4;
+                    for (std::size_t i = 1; i < constants.c1; ++i) {
+                        tv5 = tv5.squared();
+                    }
+                    const bool is_square = (tv5 == one);
+                    tv3 = cmov(tv3 * constants.c7, tv3, is_square);
+                    tv4 = cmov(tv4 * tv1, tv4, is_square);
+
+                    for (std::size_t k = constants.c1; k >= 2; --k) {
+                        // tv5 = tv4^(2^(k - 2))
+                        tv5 = tv4;
+                        for (std::size_t i = 2; i < k; ++i) {
+                            tv5 = tv5.squared();
+                        }
+                        const bool e1 = (tv5 == one);
+                        tv2 = tv3 * tv1;
+                        tv1 = tv1.squared();
+                        tv3 = cmov(tv2, tv3, e1);
+                        tv4 = cmov(tv4 * tv1, tv4, e1);
+                    }
+
+                    result = tv3;
+                    return is_square;
+                }
+
+                template<typename FieldValueType, typename IntegralType>
+                inline FieldValueType iso_map_coefficient(const IntegralType &k) {
+                    return FieldValueType(k);
+                }
+
+                template<typename FieldValueType, typename IntegralType>
+                inline FieldValueType iso_map_coefficient(const std::array<IntegralType, 2> &k) {
+                    return FieldValueType(k[0], k[1]);
+                }
+
+                /** @brief Evaluates sum k[i] * n^i * d^(degree - i), plus n^k.size() * d^(degree - k.size())
+                 * for a monic polynomial, i.e. the polynomial at x = n / d scaled by d^degree.
+                 */
+                template<typename FieldValueType, typename Coefficients>
+                inline FieldValueType iso_map_evaluate(const Coefficients &k, bool is_monic, std::size_t degree,
+                                                       const std::vector<FieldValueType> &n_powers,
+                                                       const std::vector<FieldValueType> &d_powers) {
+                    FieldValueType result = FieldValueType::zero();
+                    for (std::size_t i = 0; i < k.size(); i++) {
+                        result += iso_map_coefficient<FieldValueType>(k[i]) * n_powers[i] * d_powers[degree - i];
+                    }
+                    if (is_monic) {
+                        result += n_powers[k.size()] * d_powers[degree - k.size()];
+                    }
+                    return result;
+                }
+
+                template<typename FieldValueType>
+                inline std::vector<FieldValueType> iso_map_powers(const FieldValueType &base, std::size_t degree) {
+                    std::vector<FieldValueType> powers {FieldValueType::one()};
+                    for (std::size_t i = 0; i < degree; i++) {
+                        powers.emplace_back(powers.back() * base);
+                    }
+                    return powers;
+                }
+
+                /** @brief Builds a group element from affine coordinates given as fractions.
+                 *
+                 * Jacobian coordinates get Z = x_den * y_den, projective ones the same Z with the
+                 * lower weight of X and Y, so no inversion is needed.
+                 */
+                template<typename GroupValueType, typename FieldValueType>
+                inline GroupValueType point_from_fractions(const FieldValueType &x_num, const FieldValueType &x_den,
+                                                           const FieldValueType &y_num, const FieldValueType &y_den) {
+                    typedef typename GroupValueType::coordinates coordinates;
+
+                    const FieldValueType Z = x_den * y_den;
+                    if (std::is_same<coordinates, algebra::curves::coordinates::jacobian>::value ||
+                        std::is_same<coordinates, algebra::curves::coordinates::jacobian_with_a4_0>::value ||
+                        std::is_same<coordinates, algebra::curves::coordinates::jacobian_with_a4_minus_3>::value) {
+                        // (X / Z^2, Y / Z^3) = (x_num / x_den, y_num / y_den)
+                        const FieldValueType t = x_den * y_den.squared();
+                        return GroupValueType(x_num * t, y_num * x_den.squared() * t, Z);
+                    }
+                    return GroupValueType(x_num * y_den, y_num * x_den, Z);
                 }
 
                 template<typename Group>
@@ -142,43 +326,31 @@ namespace nil {
                         0xe0fa1d816ddc03e6b24255e0d7819c171c40f65e273b853324efcd6356caa205ca2f570f13497804415473a1d634b8f_cppui_modular381};
 
                 public:
-                    static inline group_value_type process(const group_value_type &ci) {
-                        field_value_type x_num = field_value_type::zero();
-                        field_value_type x_den = field_value_type::zero();
-                        field_value_type y_num = field_value_type::zero();
-                        field_value_type y_den = field_value_type::zero();
-
-                        std::vector<field_value_type> xi_powers = [&ci]() {
-                            std::vector<field_value_type> xi_powers {field_value_type::one()};
-                            for (std::size_t i = 0; i < 15; i++) {
-                                xi_powers.emplace_back(xi_powers.back() * ci.X);
-                            }
-                            return xi_powers;
-                        }();
-
-                        for (std::size_t i = 0; i < k_x_den.size(); i++) {
-                            x_den += field_value_type(k_x_den[i]) * xi_powers[i];
-                        }
-                        x_den += xi_powers[k_x_den.size()];
-
-                        for (std::size_t i = 0; i < k_y_den.size(); i++) {
-                            y_den += field_value_type(k_y_den[i]) * xi_powers[i];
-                        }
-                        y_den += xi_powers[k_y_den.size()];
-
-                        if (x_den.is_zero() || y_den.is_zero()) {
+                    /** @brief Maps the point (x_num / x_den, y) of the isogenous curve.
+                     *
+                     * The rational maps are evaluated in homogeneous form, so neither x_den nor the
+                     * denominators of the isogeny are inverted.
+                     */
+                    static inline group_value_type process(const field_value_type &x_num, const field_value_type &x_den,
+                                                           const field_value_type &y) {
+                        constexpr static const std::size_t x_degree = std::max(k_x_num.size() - 1, k_x_den.size());
+                        constexpr static const std::size_t y_degree = std::max(k_y_num.size() - 1, k_y_den.size());
+                        constexpr static const std::size_t degree = std::max(x_degree, y_degree);
+
+                        const std::vector<field_value_type> n_powers = iso_map_powers(x_num, degree);
+                        const std::vector<field_value_type> d_powers = iso_map_powers(x_den, degree);
+
+                        const field_value_type iso_x_den = iso_map_evaluate(k_x_den, true, x_degree, n_powers, d_powers);
+                        const field_value_type iso_y_den = iso_map_evaluate(k_y_den, true, y_degree, n_powers, d_powers);
+
+                        if (iso_x_den.is_zero() || iso_y_den.is_zero()) {
                             return group_value_type::one();
                         }
 
-                        for (std::size_t i = 0; i < k_x_num.size(); i++) {
-                            x_num += field_value_type(k_x_num[i]) * xi_powers[i];
-                        }
-
-                        for (std::size_t i = 0; i < k_y_num.size(); i++) {
-                            y_num += field_value_type(k_y_num[i]) * xi_powers[i];
-                        }
+                        const field_value_type iso_x_num = iso_map_evaluate(k_x_num, false, x_degree, n_powers, d_powers);
+                        const field_value_type iso_y_num = iso_map_evaluate(k_y_num, false, y_degree, n_powers, d_powers);
 
-                        return group_value_type(x_num * x_den.inversed(), ci.Y * y_num * y_den.inversed(), field_value_type::one());
+                        return point_from_fractions<group_value_type>(iso_x_num, iso_x_den, y * iso_y_num, iso_y_den);
                     }
                 };
 
@@ -229,43 +401,31 @@ namespace nil {
                            0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaa99_cppui_modular381}}}};
 
                 public:
-                    static inline group_value_type process(const group_value_type &ci) {
-                        field_value_type x_num = field_value_type::zero();
-                        field_value_type x_den = field_value_type::zero();
-                        field_value_type y_num = field_value_type::zero();
-                        field_value_type y_den = field_value_type::zero();
-
-                        std::vector<field_value_type> xi_powers = [&ci]() {
-                            std::vector<field_value_type> xi_powers {field_value_type::one()};
-                            for (std::size_t i = 0; i < 3; i++) {
-                                xi_powers.emplace_back(xi_powers.back() * ci.X);
-                            }
-                            return xi_powers;
-                        }();
-
-                        for (std::size_t i = 0; i < k_x_den.size(); i++) {
-                            x_den += field_value_type(k_x_den[i][0], k_x_den[i][1]) * xi_powers[i];
-                        }
-                        x_den += xi_powers[k_x_den.size()];
-
-                        for (std::size_t i = 0; i < k_y_den.size(); i++) {
-                            y_den += field_value_type(k_y_den[i][0], k_y_den[i][1]) * xi_powers[i];
-                        }
-                        y_den += xi_powers[k_y_den.size()];
-
-                        if (x_den.is_zero() || y_den.is_zero()) {
+                    /** @brief Maps the point (x_num / x_den, y) of the isogenous curve.
+                     *
+                     * The rational maps are evaluated in homogeneous form, so neither x_den nor the
+                     * denominators of the isogeny are inverted.
+                     */
+                    static inline group_value_type process(const field_value_type &x_num, const field_value_type &x_den,
+                                                           const field_value_type &y) {
+                        constexpr static const std::size_t x_degree = std::max(k_x_num.size() - 1, k_x_den.size());
+                        constexpr static const std::size_t y_degree = std::max(k_y_num.size() - 1, k_y_den.size());
+                        constexpr static const std::size_t degree = std::max(x_degree, y_degree);
+
+                        const std::vector<field_value_type> n_powers = iso_map_powers(x_num, degree);
+                        const std::vector<field_value_type> d_powers = iso_map_powers(x_den, degree);
+
+                        const field_value_type iso_x_den = iso_map_evaluate(k_x_den, true, x_degree, n_powers, d_powers);
+                        const field_value_type iso_y_den = iso_map_evaluate(k_y_den, true, y_degree, n_powers, d_powers);
+
+                        if (iso_x_den.is_zero() || iso_y_den.is_zero()) {
                             return group_value_type::one();
                         }
 
-                        for (std::size_t i = 0; i < k_x_num.size(); i++) {
-                            x_num += field_value_type(k_x_num[i][0], k_x_num[i][1]) * xi_powers[i];
-                        }
-
-                        for (std::size_t i = 0; i < k_y_num.size(); i++) {
-                            y_num += field_value_type(k_y_num[i][0], k_y_num[i][1]) * xi_powers[i];
-                        }
+                        const field_value_type iso_x_num = iso_map_evaluate(k_x_num, false, x_degree, n_powers, d_powers);
+                        const field_value_type iso_y_num = iso_map_evaluate(k_y_num, false, y_degree, n_powers, d_powers);
 
-                        return group_value_type(x_num * x_den.inversed(), ci.Y * y_num * y_den.inversed(), field_value_type::one());
+                        return point_from_fractions<group_value_type>(iso_x_num, iso_x_den, y * iso_y_num, iso_y_den);
                     }
                 };
 
@@ -276,7 +436,14 @@ namespace nil {
                     typedef typename suite_type::group_value_type group_value_type;
                     typedef typename suite_type::field_value_type field_value_type;
 
-                    static inline group_value_type process(const field_value_type &u) {
+                    /** @brief Straight-line simplified SWU map, the point is returned as (x_num / x_den, y).
+                     *
+                     * x_den is never zero. The square root is taken by a single sqrt_ratio,
+                     * without inversions and without the is_square() test of both candidates.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#section-6.6.2
+                     */
+                    static inline void process(const field_value_type &u, field_value_type &x_num,
+                                               field_value_type &x_den, field_value_type &y) {
                         // TODO: We assume that Z meets the following criteria -- correct for predefined suites,
                         //  but wrong in general case
                         // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-6.6.2
@@ -286,27 +453,32 @@ namespace nil {
                         // 3.  the polynomial g(x) - Z is irreducible over F, and
                         // 4.  g(B / (Z * A)) is square in F.
                         static const field_value_type one = field_value_type::one();
+                        static const sqrt_ratio_constants<field_value_type> constants(suite_type::Z);
+
+                        field_value_type tv1 = suite_type::Z * u.squared();
+                        field_value_type tv2 = tv1.squared() + tv1;
+                        field_value_type tv3 = suite_type::Bi * (tv2 + one);
+                        field_value_type tv4 = suite_type::Ai * cmov(suite_type::Z, -tv2, !tv2.is_zero());
+
+                        // g(x) = gx_num / gx_den for x = tv3 / tv4
+                        field_value_type tv6 = tv4.squared();
+                        const field_value_type gx_num =
+                            (tv3.squared() + suite_type::Ai * tv6) * tv3 + suite_type::Bi * tv6 * tv4;
+                        const field_value_type gx_den = tv6 * tv4;
+
+                        field_value_type y1;
+                        const bool is_gx1_square = sqrt_ratio(gx_num, gx_den, constants, y1);
+
+                        x_num = cmov(tv1 * tv3, tv3, is_gx1_square);
+                        x_den = tv4;
+                        y = cmov(tv1 * u * y1, y1, is_gx1_square);
+                        y = cmov(-y, y, sgn0(u) == sgn0(y));
+                    }
 
-                        field_value_type tv1 = (suite_type::Z.pow(2u) * u.pow(4u) + suite_type::Z * u.pow(2u)).inversed();
-                        field_value_type x1 = (-suite_type::Bi * suite_type::Ai.inversed()) * (one + tv1);
-                        if (tv1.is_zero()) {
-                            x1 = suite_type::Bi * (suite_type::Z * suite_type::Ai).inversed();
-                        }
-                        field_value_type gx1 = x1.pow(3u) + suite_type::Ai * x1 + suite_type::Bi;
-                        field_value_type x2 = suite_type::Z * u.pow(2u) * x1;
-                        field_value_type gx2 = x2.pow(3u) + suite_type::Ai * x2 + suite_type::Bi;
-                        field_value_type x, y;
-                        if (gx1.is_square()) {
-                            x = x1;
-                            y = gx1.sqrt();
-                        } else {
-                            x = x2;
-                            y = gx2.sqrt();
-                        }
-                        if (sgn0(u) != sgn0(y)) {
-                            y = -y;
-                        }
-                        return group_value_type(x, y, one);
+                    static inline group_value_type process(const field_value_type &u) {
+                        field_value_type x_num, x_den, y;
+                        process(u, x_num, x_den, y);
+                        return point_from_fractions<group_value_type>(x_num, x_den, y, field_value_type::one());
                     }
                 };
 
@@ -318,8 +490,9 @@ namespace nil {
                     typedef typename suite_type::field_value_type field_value_type;
 
                     static inline group_value_type process(const field_value_type &u) {
-                        group_value_type ci = m2c_simple_swu<Group>::process(u);
-                        return iso_map<Group>::process(ci);
+                        field_value_type x_num, x_den, y;
+                        m2c_simple_swu<Group>::process(u, x_num, x_den, y);
+                        return iso_map<Group>::process(x_num, x_den, y);
                     }
                 };
 
@@ -335,10 +508,20 @@ namespace nil {
                     : m2c_simple_swu_zeroAB<typename algebra::curves::bls12_381::g2_type<Coordinates, Form>> { };
 
                 template<typename GroupValue>
-                static inline GroupValue clear_cofactor(const GroupValue &R) {
+                static inline GroupValue clear_cofactor(const GroupValue &R, std::true_type /* psi cofactor clearing */) {
+                    return algebra::curves::detail::psi_functions<GroupValue>::clear_cofactor(R);
+                }
+
+                template<typename GroupValue>
+                static inline GroupValue clear_cofactor(const GroupValue &R, std::false_type /* psi cofactor clearing */) {
                     return R * h2c_suite<typename GroupValue::group_type>::h_eff;
                 }
 
+                template<typename GroupValue>
+                static inline GroupValue clear_cofactor(const GroupValue &R) {
+                    return clear_cofactor(R, algebra::curves::detail::is_psi_cofactor_clearing_enabled<GroupValue>());
+                }
+
                 template<typename Group, UniformityCount _uniformity_count, typename U>
                 static inline typename std::enable_if<(UniformityCount::uniform_count == _uniformity_count),
                                                       typename Group::value_type>::type
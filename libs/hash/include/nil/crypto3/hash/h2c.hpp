@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_HASH_H2C_HPP
 #define CRYPTO3_HASH_H2C_HPP
 
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -36,6 +37,8 @@
 #include <nil/crypto3/hash/detail/stream_processors/stream_processors_enum.hpp>
 #include <nil/crypto3/hash/h2f.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace hashes {
@@ -110,6 +113,28 @@ namespace nil {
                 static inline result_type process(internal_accumulator_type &acc) {
                     return detail::ep_map<group_type, Params::uniformity_count>(hash_type::process(acc));
                 }
+
+                /** @brief Hashes every message of the range to the group.
+                 *
+                 * The map to curve and the cofactor clearing do not invert field elements, the
+                 * points are brought to Z = 1 together by batch_normalize, which costs a single
+                 * inversion for the whole range.
+                 */
+                template<typename MessagesRange>
+                static inline std::vector<result_type> hash_to_curve(const MessagesRange &messages) {
+                    std::vector<result_type> result;
+                    result.reserve(std::distance(std::cbegin(messages), std::cend(messages)));
+
+                    for (const auto &message : messages) {
+                        internal_accumulator_type acc;
+                        init_accumulator(acc);
+                        update(acc, message);
+                        result.emplace_back(process(acc));
+                    }
+
+                    algebra::batch_normalize(result);
+                    return result;
+                }
             };
         }    // namespace hashes
     }        // namespace crypto3
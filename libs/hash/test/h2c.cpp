@@ -121,6 +121,21 @@ typename std::enable_if<hashes::is_h2c<Hash>::value>::type
     }
 }
 
+template<typename Hash, typename SamplesType>
+void check_hash_to_curve_batch(const SamplesType &samples) {
+    std::vector<std::vector<std::uint8_t>> messages;
+    for (const auto &s : samples) {
+        messages.emplace_back(std::get<0>(s).begin(), std::get<0>(s).end());
+    }
+
+    const std::vector<typename Hash::digest_type> result = Hash::hash_to_curve(messages);
+    BOOST_CHECK_EQUAL(result.size(), samples.size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        BOOST_CHECK_EQUAL(result[i], std::get<1>(samples[i]));
+        BOOST_CHECK(result[i].Z.is_one());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(hash_h2c_manual_tests)
 
 BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g1_h2c_sha256_test) {
@@ -181,6 +196,8 @@ BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g1_h2c_sha256_test) {
     for (auto &s : samples) {
         check_hash_to_curve<hash_type>(std::get<0>(s), std::get<1>(s));
     }
+
+    check_hash_to_curve_batch<hash_type>(samples);
 }
 
 // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#appendix-J.10.1
@@ -266,6 +283,8 @@ BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g2_h2c_sha256_test) {
     for (auto &s : samples) {
         check_hash_to_curve<hash_type>(std::get<0>(s), std::get<1>(s));
     }
+
+    check_hash_to_curve_batch<hash_type>(samples);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
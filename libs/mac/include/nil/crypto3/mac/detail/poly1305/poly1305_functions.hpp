@@ -25,13 +25,22 @@
 #ifndef CRYPTO3_MAC_POLY1305_FUNCTIONS_HPP
 #define CRYPTO3_MAC_POLY1305_FUNCTIONS_HPP
 
+#include <cstring>
+
 #include <boost/endian/arithmetic.hpp>
 #include <boost/endian/conversion.hpp>
 
-#include <nil/crypto3/detail/make_uint_t.hpp>
+#include <boost/predef/architecture.h>
+#include <boost/predef/hardware/simd.h>
 
 #include <nil/crypto3/mac/detail/poly1305/poly1305_policy.hpp>
 
+#if defined(CRYPTO3_HAS_POLY1305_AVX2) || \
+    ((BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_AVX2_VERSION)
+#define CRYPTO3_MAC_POLY1305_SIMD
+#include <nil/crypto3/mac/detail/poly1305/poly1305_simd_impl.hpp>
+#endif
+
 namespace nil {
     namespace crypto3 {
         namespace mac {
@@ -39,6 +48,12 @@ namespace nil {
                 struct poly1305_functions : public poly1305_policy {
                     typedef poly1305_policy policy_type;
 
+#if defined(CRYPTO3_MAC_POLY1305_SIMD) && defined(__AVX512F__)
+                    typedef poly1305_avx512_impl simd_impl_type;
+#elif defined(CRYPTO3_MAC_POLY1305_SIMD)
+                    typedef poly1305_avx2_impl simd_impl_type;
+#endif
+
                     constexpr static const std::size_t word_bits = policy_type::word_bits;
                     typedef typename policy_type::word_type word_type;
 
@@ -50,13 +65,59 @@ namespace nil {
                     constexpr static const std::size_t key_schedule_words = policy_type::key_schedule_words;
                     typedef typename policy_type::key_schedule_type key_schedule_type;
 
+                    constexpr static const std::size_t powers_count = policy_type::powers_count;
+                    constexpr static const std::size_t powers_offset = policy_type::powers_offset;
+
+                    typedef unsigned __int128 uint128_t;
+
+                    static inline word_type load_le(const std::uint8_t *m, std::size_t i) {
+                        word_type v;
+                        std::memcpy(&v, m + i * sizeof(word_type), sizeof(word_type));
+                        return boost::endian::little_to_native(v);
+                    }
+
+                    static inline void store_le(std::uint8_t *out, word_type w0, word_type w1) {
+                        w0 = boost::endian::native_to_little(w0);
+                        w1 = boost::endian::native_to_little(w1);
+                        std::memcpy(out, &w0, sizeof(word_type));
+                        std::memcpy(out + sizeof(word_type), &w1, sizeof(word_type));
+                    }
+
+                    static inline word_type carry_shift(const uint128_t &a, std::size_t shift) {
+                        return static_cast<word_type>(a >> shift);
+                    }
+
+                    /*!
+                     * @brief h *= r with a partial reduction mod 2^130 - 5, all values in 44-bit limbs.
+                     */
+                    static inline void poly1305_mul(word_type &h0, word_type &h1, word_type &h2, word_type r0,
+                                                    word_type r1, word_type r2) {
+                        const word_type s1 = r1 * (5 << 2);
+                        const word_type s2 = r2 * (5 << 2);
+
+                        uint128_t d0 = uint128_t(h0) * r0 + uint128_t(h1) * s2 + uint128_t(h2) * s1;
+                        uint128_t d1 = uint128_t(h0) * r1 + uint128_t(h1) * r0 + uint128_t(h2) * s2;
+                        uint128_t d2 = uint128_t(h0) * r2 + uint128_t(h1) * r1 + uint128_t(h2) * r0;
+
+                        /* (partial) h %= p */
+                        word_type c = carry_shift(d0, 44);
+                        h0 = d0 & 0xfffffffffff;
+                        d1 += c;
+                        c = carry_shift(d1, 44);
+                        h1 = d1 & 0xfffffffffff;
+                        d2 += c;
+                        c = carry_shift(d2, 42);
+                        h2 = d2 & 0x3ffffffffff;
+                        h0 += c * 5;
+                        c = carry_shift(h0, 44);
+                        h0 = h0 & 0xfffffffffff;
+                        h1 += c;
+                    }
+
                     static void poly1305_init(key_schedule_type &X, const key_type &key) {
-                        using namespace nil::crypto3::detail;
                         /* r &= 0xffffffc0ffffffc0ffffffc0fffffff */
-                        const word_type t0 = boost::endian::native_to_little(
-                            make_uint_t<word_bits>(key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7]));
-                        const word_type t1 = boost::endian::native_to_little(make_uint_t<word_bits>(
-                            key[8], key[9], key[10], key[11], key[12], key[13], key[14], key[15]));
+                        const word_type t0 = load_le(key.data(), 0);
+                        const word_type t1 = load_le(key.data(), 1);
 
                         X[0] = (t0)&0xffc0fffffff;
                         X[1] = ((t0 >> 44) | (t1 << 20)) & 0xfffffc0ffff;
@@ -68,14 +129,30 @@ namespace nil {
                         X[5] = 0;
 
                         /* save pad for later */
-                        X[6] = boost::endian::native_to_little(make_uint_t<word_bits>(
-                            key[16], key[17], key[18], key[19], key[20], key[21], key[22], key[23]));
-                        X[7] = boost::endian::native_to_little(make_uint_t<word_bits>(
-                            key[24], key[25], key[26], key[27], key[28], key[29], key[30], key[31]));
+                        X[6] = load_le(key.data(), 2);
+                        X[7] = load_le(key.data(), 3);
+
+                        /* precompute r^2 .. r^powers_count for multi-block absorption */
+                        word_type p0 = X[0], p1 = X[1], p2 = X[2];
+                        for (std::size_t i = 0; i != powers_count - 1; ++i) {
+                            poly1305_mul(p0, p1, p2, X[0], X[1], X[2]);
+                            X[powers_offset + 3 * i + 0] = p0;
+                            X[powers_offset + 3 * i + 1] = p1;
+                            X[powers_offset + 3 * i + 2] = p2;
+                        }
                     }
 
                     static void poly1305_blocks(key_schedule_type &X, const uint8_t *m, size_t blocks,
                                                 bool is_final = false) {
+#if defined(CRYPTO3_MAC_POLY1305_SIMD)
+                        if (!is_final && blocks >= simd_impl_type::lanes) {
+                            const std::size_t groups = blocks / simd_impl_type::lanes;
+                            simd_impl_type::poly1305_blocks(X, m, groups);
+                            m += groups * simd_impl_type::lanes * 16;
+                            blocks -= groups * simd_impl_type::lanes;
+                        }
+#endif
+
                         const word_type hibit = is_final ? 0 : (static_cast<word_type>(1) << 40); /* 1 << 128 */
 
                         const word_type r0 = X[0];
@@ -86,36 +163,17 @@ namespace nil {
                         word_type h1 = X[3 + 1];
                         word_type h2 = X[3 + 2];
 
-                        const word_type s1 = r1 * (5 << 2);
-                        const word_type s2 = r2 * (5 << 2);
-
                         while (blocks--) {
                             /* h += m[i] */
-                            const word_type t0 = load_le<word_type>(m, 0);
-                            const word_type t1 = load_le<word_type>(m, 1);
+                            const word_type t0 = load_le(m, 0);
+                            const word_type t1 = load_le(m, 1);
 
                             h0 += ((t0)&0xfffffffffff);
                             h1 += (((t0 >> 44) | (t1 << 20)) & 0xfffffffffff);
                             h2 += (((t1 >> 24)) & 0x3ffffffffff) | hibit;
 
                             /* h *= r */
-                            uint128_t d0 = uint128_t(h0) * r0 + uint128_t(h1) * s2 + uint128_t(h2) * s1;
-                            uint128_t d1 = uint128_t(h0) * r1 + uint128_t(h1) * r0 + uint128_t(h2) * s2;
-                            uint128_t d2 = uint128_t(h0) * r2 + uint128_t(h1) * r1 + uint128_t(h2) * r0;
-
-                            /* (partial) h %= p */
-                            word_type c = carry_shift(d0, 44);
-                            h0 = d0 & 0xfffffffffff;
-                            d1 += c;
-                            c = carry_shift(d1, 44);
-                            h1 = d1 & 0xfffffffffff;
-                            d2 += c;
-                            c = carry_shift(d2, 42);
-                            h2 = d2 & 0x3ffffffffff;
-                            h0 += c * 5;
-                            c = carry_shift(h0, 44);
-                            h0 = h0 & 0xfffffffffff;
-                            h1 += c;
+                            poly1305_mul(h0, h1, h2, r0, r1, r2);
 
                             m += 16;
                         }
@@ -190,7 +248,7 @@ namespace nil {
                         store_le(mac, h0, h1);
 
                         /* zero out the state */
-                        clear_mem(X.data(), X.size());
+                        X.fill(0);
                     }
                 };
             }    // namespace detail
@@ -25,18 +25,21 @@
 #ifndef CRYPTO3_MAC_POLY1305_POLICY_HPP
 #define CRYPTO3_MAC_POLY1305_POLICY_HPP
 
+#include <array>
+#include <climits>
+
 #include <boost/integer.hpp>
 
 #include <boost/container/static_vector.hpp>
 
-#include <nil/crypto3/mac/detail/basic_functions.hpp>
+#include <nil/crypto3/detail/basic_functions.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace mac {
             namespace detail {
-                struct poly1305_policy : public basic_functions<64> {
-                    typedef basic_functions<64> policy_type;
+                struct poly1305_policy : public ::nil::crypto3::detail::basic_functions<64> {
+                    typedef ::nil::crypto3::detail::basic_functions<64> policy_type;
 
                     typedef typename policy_type::byte_type byte_type;
 
@@ -51,7 +54,18 @@ namespace nil {
                     constexpr static const std::size_t key_bits = key_words * CHAR_BIT;
                     typedef std::array<byte_type, key_words> key_type;
 
-                    constexpr static const std::size_t key_schedule_words = 8;
+                    /*!
+                     * @brief Amount of precomputed powers of r (r^1 .. r^powers_count) kept in the
+                     * key schedule. Vectorized implementations absorb up to powers_count blocks per step.
+                     */
+                    constexpr static const std::size_t powers_count = 8;
+
+                    /*!
+                     * Key schedule layout (44-bit limbs): r[0..2], h[3..5], pad[6..7], then
+                     * r^2, r^3, ..., r^powers_count with three limbs each starting from powers_offset.
+                     */
+                    constexpr static const std::size_t powers_offset = 8;
+                    constexpr static const std::size_t key_schedule_words = powers_offset + 3 * (powers_count - 1);
                     constexpr static const std::size_t key_schedule_bits = key_schedule_words * word_bits;
                     typedef std::array<word_type, key_schedule_words> key_schedule_type;
 
@@ -0,0 +1,363 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MAC_POLY1305_SIMD_IMPL_HPP
+#define CRYPTO3_MAC_POLY1305_SIMD_IMPL_HPP
+
+#include <cstring>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#include <nil/crypto3/mac/detail/poly1305/poly1305_policy.hpp>
+
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace mac {
+            namespace detail {
+                /*!
+                 * @brief Conversions between the scalar 3x44-bit limb representation stored in the
+                 * key schedule and the 5x26-bit limb representation used by vector lanes. 26-bit limbs
+                 * keep every partial product of the multiplication inside a 64-bit lane.
+                 */
+                struct poly1305_radix26 {
+                    typedef poly1305_policy policy_type;
+                    typedef typename policy_type::word_type word_type;
+
+                    constexpr static const word_type mask26 = 0x3ffffff;
+                    constexpr static const word_type mask44 = 0xfffffffffff;
+                    constexpr static const word_type mask42 = 0x3ffffffffff;
+
+                    static inline void to_radix26(const word_type *l44, word_type *l26) {
+                        word_type h0 = l44[0], h1 = l44[1], h2 = l44[2], c;
+
+                        c = h0 >> 44;
+                        h0 &= mask44;
+                        h1 += c;
+                        c = h1 >> 44;
+                        h1 &= mask44;
+                        h2 += c;
+                        c = h2 >> 42;
+                        h2 &= mask42;
+                        h0 += c * 5;
+                        c = h0 >> 44;
+                        h0 &= mask44;
+                        h1 += c;
+                        c = h1 >> 44;
+                        h1 &= mask44;
+                        h2 += c;
+
+                        l26[0] = h0 & mask26;
+                        l26[1] = ((h0 >> 26) | (h1 << 18)) & mask26;
+                        l26[2] = (h1 >> 8) & mask26;
+                        l26[3] = ((h1 >> 34) | (h2 << 10)) & mask26;
+                        l26[4] = h2 >> 16;
+                    }
+
+                    static inline void from_radix26(const word_type *l26, word_type *l44) {
+                        word_type l0 = l26[0], l1 = l26[1], l2 = l26[2], l3 = l26[3], l4 = l26[4], c;
+
+                        c = l0 >> 26;
+                        l0 &= mask26;
+                        l1 += c;
+                        c = l1 >> 26;
+                        l1 &= mask26;
+                        l2 += c;
+                        c = l2 >> 26;
+                        l2 &= mask26;
+                        l3 += c;
+                        c = l3 >> 26;
+                        l3 &= mask26;
+                        l4 += c;
+                        c = l4 >> 26;
+                        l4 &= mask26;
+                        l0 += c * 5;
+
+                        word_type h0 = l0 + (l1 << 26);
+                        word_type h1 = (h0 >> 44) + (l2 << 8) + (l3 << 34);
+                        word_type h2 = (h1 >> 44) + (l4 << 16);
+
+                        l44[0] = h0 & mask44;
+                        l44[1] = h1 & mask44;
+                        l44[2] = h2;
+                    }
+
+                    /*!
+                     * @brief Loads r^power from the key schedule layout described in poly1305_policy.
+                     */
+                    template<typename KeySchedule>
+                    static inline void load_power(const KeySchedule &X, std::size_t power, word_type *l26) {
+                        to_radix26(power == 1 ? &X[0] : &X[policy_type::powers_offset + 3 * (power - 2)], l26);
+                    }
+                };
+
+                /*!
+                 * @brief AVX2 Poly1305 absorbing four blocks per step. Lane i accumulates blocks 4k + i
+                 * with multiplier r^4, the last step multiplies lanes by r^4, r^3, r^2, r^1 and the lanes
+                 * are summed, which equals the sequential Horner evaluation.
+                 */
+                struct poly1305_avx2_impl : public poly1305_radix26 {
+                    typedef poly1305_policy policy_type;
+                    typedef typename policy_type::word_type word_type;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                    constexpr static const std::size_t lanes = 4;
+                    constexpr static const std::size_t block_size = 16;
+
+                    static inline BOOST_ATTRIBUTE_TARGET("avx2") __m256i mul5(__m256i x) {
+                        return _mm256_add_epi64(x, _mm256_slli_epi64(x, 2));
+                    }
+
+                    static inline BOOST_ATTRIBUTE_TARGET("avx2") void mul_reduce(__m256i *H, const __m256i *R,
+                                                                                const __m256i *S) {
+                        const __m256i M = _mm256_set1_epi64x(mask26);
+
+                        __m256i d0 = _mm256_add_epi64(
+                            _mm256_add_epi64(_mm256_mul_epu32(H[0], R[0]), _mm256_mul_epu32(H[1], S[4])),
+                            _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], S[3]),
+                                                              _mm256_mul_epu32(H[3], S[2])),
+                                             _mm256_mul_epu32(H[4], S[1])));
+                        __m256i d1 = _mm256_add_epi64(
+                            _mm256_add_epi64(_mm256_mul_epu32(H[0], R[1]), _mm256_mul_epu32(H[1], R[0])),
+                            _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], S[4]),
+                                                              _mm256_mul_epu32(H[3], S[3])),
+                                             _mm256_mul_epu32(H[4], S[2])));
+                        __m256i d2 = _mm256_add_epi64(
+                            _mm256_add_epi64(_mm256_mul_epu32(H[0], R[2]), _mm256_mul_epu32(H[1], R[1])),
+                            _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], R[0]),
+                                                              _mm256_mul_epu32(H[3], S[4])),
+                                             _mm256_mul_epu32(H[4], S[3])));
+                        __m256i d3 = _mm256_add_epi64(
+                            _mm256_add_epi64(_mm256_mul_epu32(H[0], R[3]), _mm256_mul_epu32(H[1], R[2])),
+                            _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], R[1]),
+                                                              _mm256_mul_epu32(H[3], R[0])),
+                                             _mm256_mul_epu32(H[4], S[4])));
+                        __m256i d4 = _mm256_add_epi64(
+                            _mm256_add_epi64(_mm256_mul_epu32(H[0], R[4]), _mm256_mul_epu32(H[1], R[3])),
+                            _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], R[2]),
+                                                              _mm256_mul_epu32(H[3], R[1])),
+                                             _mm256_mul_epu32(H[4], R[0])));
+
+                        __m256i c = _mm256_srli_epi64(d0, 26);
+                        H[0] = _mm256_and_si256(d0, M);
+                        d1 = _mm256_add_epi64(d1, c);
+                        c = _mm256_srli_epi64(d1, 26);
+                        H[1] = _mm256_and_si256(d1, M);
+                        d2 = _mm256_add_epi64(d2, c);
+                        c = _mm256_srli_epi64(d2, 26);
+                        H[2] = _mm256_and_si256(d2, M);
+                        d3 = _mm256_add_epi64(d3, c);
+                        c = _mm256_srli_epi64(d3, 26);
+                        H[3] = _mm256_and_si256(d3, M);
+                        d4 = _mm256_add_epi64(d4, c);
+                        c = _mm256_srli_epi64(d4, 26);
+                        H[4] = _mm256_and_si256(d4, M);
+                        H[0] = _mm256_add_epi64(H[0], mul5(c));
+                        c = _mm256_srli_epi64(H[0], 26);
+                        H[0] = _mm256_and_si256(H[0], M);
+                        H[1] = _mm256_add_epi64(H[1], c);
+                    }
+
+                    /*!
+                     * @brief Absorbs groups * lanes full (non-final) blocks into the accumulator X[3..5].
+                     */
+                    static BOOST_ATTRIBUTE_TARGET("avx2") void poly1305_blocks(key_schedule_type &X,
+                                                                               const std::uint8_t *m,
+                                                                               std::size_t groups) {
+                        const __m256i M = _mm256_set1_epi64x(mask26);
+                        const __m256i hibit = _mm256_set1_epi64x(static_cast<word_type>(1) << 24);
+
+                        word_type r26[lanes][5], h26[5];
+                        for (std::size_t i = 0; i != lanes; ++i) {
+                            load_power(X, i + 1, r26[i]);
+                        }
+                        to_radix26(&X[3], h26);
+
+                        __m256i R[5], S[5], RL[5], SL[5], H[5];
+                        for (std::size_t i = 0; i != 5; ++i) {
+                            R[i] = _mm256_set1_epi64x(r26[lanes - 1][i]);
+                            S[i] = mul5(R[i]);
+                            RL[i] = _mm256_set_epi64x(r26[0][i], r26[1][i], r26[2][i], r26[3][i]);
+                            SL[i] = mul5(RL[i]);
+                            H[i] = _mm256_set_epi64x(0, 0, 0, h26[i]);
+                        }
+
+                        for (std::size_t g = 0; g != groups; ++g, m += lanes * block_size) {
+                            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(m));
+                            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(m + 32));
+
+                            const __m256i t0 = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xd8);
+                            const __m256i t1 = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xd8);
+
+                            H[0] = _mm256_add_epi64(H[0], _mm256_and_si256(t0, M));
+                            H[1] = _mm256_add_epi64(H[1], _mm256_and_si256(_mm256_srli_epi64(t0, 26), M));
+                            H[2] = _mm256_add_epi64(
+                                H[2],
+                                _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(t0, 52), _mm256_slli_epi64(t1, 12)),
+                                                 M));
+                            H[3] = _mm256_add_epi64(H[3], _mm256_and_si256(_mm256_srli_epi64(t1, 14), M));
+                            H[4] = _mm256_add_epi64(H[4], _mm256_or_si256(_mm256_srli_epi64(t1, 40), hibit));
+
+                            if (g + 1 != groups) {
+                                mul_reduce(H, R, S);
+                            } else {
+                                mul_reduce(H, RL, SL);
+                            }
+                        }
+
+                        alignas(32) word_type lane[lanes];
+                        for (std::size_t i = 0; i != 5; ++i) {
+                            _mm256_store_si256(reinterpret_cast<__m256i *>(lane), H[i]);
+                            h26[i] = lane[0] + lane[1] + lane[2] + lane[3];
+                        }
+
+                        from_radix26(h26, &X[3]);
+                    }
+                };
+
+#if defined(__AVX512F__)
+                /*!
+                 * @brief AVX-512 Poly1305 absorbing eight blocks per step with multipliers r^8 .. r^1.
+                 */
+                struct poly1305_avx512_impl : public poly1305_radix26 {
+                    typedef poly1305_policy policy_type;
+                    typedef typename policy_type::word_type word_type;
+                    typedef typename policy_type::key_schedule_type key_schedule_type;
+
+                    constexpr static const std::size_t lanes = 8;
+                    constexpr static const std::size_t block_size = 16;
+
+                    static inline __m512i mul5(__m512i x) {
+                        return _mm512_add_epi64(x, _mm512_slli_epi64(x, 2));
+                    }
+
+                    static inline void mul_reduce(__m512i *H, const __m512i *R, const __m512i *S) {
+                        const __m512i M = _mm512_set1_epi64(mask26);
+
+                        __m512i d0 = _mm512_add_epi64(
+                            _mm512_add_epi64(_mm512_mul_epu32(H[0], R[0]), _mm512_mul_epu32(H[1], S[4])),
+                            _mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epu32(H[2], S[3]),
+                                                              _mm512_mul_epu32(H[3], S[2])),
+                                             _mm512_mul_epu32(H[4], S[1])));
+                        __m512i d1 = _mm512_add_epi64(
+                            _mm512_add_epi64(_mm512_mul_epu32(H[0], R[1]), _mm512_mul_epu32(H[1], R[0])),
+                            _mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epu32(H[2], S[4]),
+                                                              _mm512_mul_epu32(H[3], S[3])),
+                                             _mm512_mul_epu32(H[4], S[2])));
+                        __m512i d2 = _mm512_add_epi64(
+                            _mm512_add_epi64(_mm512_mul_epu32(H[0], R[2]), _mm512_mul_epu32(H[1], R[1])),
+                            _mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epu32(H[2], R[0]),
+                                                              _mm512_mul_epu32(H[3], S[4])),
+                                             _mm512_mul_epu32(H[4], S[3])));
+                        __m512i d3 = _mm512_add_epi64(
+                            _mm512_add_epi64(_mm512_mul_epu32(H[0], R[3]), _mm512_mul_epu32(H[1], R[2])),
+                            _mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epu32(H[2], R[1]),
+                                                              _mm512_mul_epu32(H[3], R[0])),
+                                             _mm512_mul_epu32(H[4], S[4])));
+                        __m512i d4 = _mm512_add_epi64(
+                            _mm512_add_epi64(_mm512_mul_epu32(H[0], R[4]), _mm512_mul_epu32(H[1], R[3])),
+                            _mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epu32(H[2], R[2]),
+                                                              _mm512_mul_epu32(H[3], R[1])),
+                                             _mm512_mul_epu32(H[4], R[0])));
+
+                        __m512i c = _mm512_srli_epi64(d0, 26);
+                        H[0] = _mm512_and_si512(d0, M);
+                        d1 = _mm512_add_epi64(d1, c);
+                        c = _mm512_srli_epi64(d1, 26);
+                        H[1] = _mm512_and_si512(d1, M);
+                        d2 = _mm512_add_epi64(d2, c);
+                        c = _mm512_srli_epi64(d2, 26);
+                        H[2] = _mm512_and_si512(d2, M);
+                        d3 = _mm512_add_epi64(d3, c);
+                        c = _mm512_srli_epi64(d3, 26);
+                        H[3] = _mm512_and_si512(d3, M);
+                        d4 = _mm512_add_epi64(d4, c);
+                        c = _mm512_srli_epi64(d4, 26);
+                        H[4] = _mm512_and_si512(d4, M);
+                        H[0] = _mm512_add_epi64(H[0], mul5(c));
+                        c = _mm512_srli_epi64(H[0], 26);
+                        H[0] = _mm512_and_si512(H[0], M);
+                        H[1] = _mm512_add_epi64(H[1], c);
+                    }
+
+                    static void poly1305_blocks(key_schedule_type &X, const std::uint8_t *m, std::size_t groups) {
+                        const __m512i M = _mm512_set1_epi64(mask26);
+                        const __m512i hibit = _mm512_set1_epi64(static_cast<word_type>(1) << 24);
+                        const __m512i even = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+                        const __m512i odd = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+
+                        word_type r26[lanes][5], h26[5];
+                        for (std::size_t i = 0; i != lanes; ++i) {
+                            load_power(X, i + 1, r26[i]);
+                        }
+                        to_radix26(&X[3], h26);
+
+                        __m512i R[5], S[5], RL[5], SL[5], H[5];
+                        for (std::size_t i = 0; i != 5; ++i) {
+                            R[i] = _mm512_set1_epi64(r26[lanes - 1][i]);
+                            S[i] = mul5(R[i]);
+                            RL[i] = _mm512_set_epi64(r26[0][i], r26[1][i], r26[2][i], r26[3][i], r26[4][i],
+                                                     r26[5][i], r26[6][i], r26[7][i]);
+                            SL[i] = mul5(RL[i]);
+                            H[i] = _mm512_set_epi64(0, 0, 0, 0, 0, 0, 0, h26[i]);
+                        }
+
+                        for (std::size_t g = 0; g != groups; ++g, m += lanes * block_size) {
+                            const __m512i a = _mm512_loadu_si512(m);
+                            const __m512i b = _mm512_loadu_si512(m + 64);
+
+                            const __m512i t0 = _mm512_permutex2var_epi64(a, even, b);
+                            const __m512i t1 = _mm512_permutex2var_epi64(a, odd, b);
+
+                            H[0] = _mm512_add_epi64(H[0], _mm512_and_si512(t0, M));
+                            H[1] = _mm512_add_epi64(H[1], _mm512_and_si512(_mm512_srli_epi64(t0, 26), M));
+                            H[2] = _mm512_add_epi64(
+                                H[2],
+                                _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(t0, 52), _mm512_slli_epi64(t1, 12)),
+                                                 M));
+                            H[3] = _mm512_add_epi64(H[3], _mm512_and_si512(_mm512_srli_epi64(t1, 14), M));
+                            H[4] = _mm512_add_epi64(H[4], _mm512_or_si512(_mm512_srli_epi64(t1, 40), hibit));
+
+                            if (g + 1 != groups) {
+                                mul_reduce(H, R, S);
+                            } else {
+                                mul_reduce(H, RL, SL);
+                            }
+                        }
+
+                        for (std::size_t i = 0; i != 5; ++i) {
+                            h26[i] = _mm512_reduce_add_epi64(H[i]);
+                        }
+
+                        from_radix26(h26, &X[3]);
+                    }
+                };
+#endif
+            }    // namespace detail
+        }        // namespace mac
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MAC_POLY1305_SIMD_IMPL_HPP
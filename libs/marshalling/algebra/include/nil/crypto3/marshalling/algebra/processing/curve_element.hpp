@@ -43,6 +43,7 @@
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
 
 #include <nil/crypto3/marshalling/multiprecision/processing/integral.hpp>
 
@@ -1266,6 +1267,33 @@ namespace nil {
                         return nil::marshalling::status_type::success;
                     }
                 };
+
+                /** @brief Reads a point with curve_element_reader and rejects it unless it is on the curve
+                 * and belongs to the prime order subgroup.
+                 *
+                 * The subgroup membership is tested by algebra::curves::detail::subgroup_check, which uses
+                 * an endomorphism instead of a full multiplication by the group order where one is known.
+                 */
+                template<typename Endianness, typename Group>
+                struct curve_element_validated_reader {
+                    using group_type = Group;
+                    using group_value_type = typename group_type::value_type;
+
+                    template<typename TIter>
+                    static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
+                        const nil::marshalling::status_type status =
+                            curve_element_reader<Endianness, Group>::process(point, iter);
+                        if (status != nil::marshalling::status_type::success) {
+                            return status;
+                        }
+
+                        if (!point.is_well_formed() || !algebra::curves::detail::subgroup_check(point)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+
+                        return nil::marshalling::status_type::success;
+                    }
+                };
             }    // namespace processing
         }        // namespace marshalling
     }            // namespace crypto3
@@ -37,6 +37,9 @@ namespace nil {
                 template<typename TTypeBase, typename CurveGroupType, typename... TOptions>
                 class curve_element;
 
+                template<typename TTypeBase, typename CurveGroupType, typename... TOptions>
+                class validated_curve_element;
+
                 template<typename TTypeBase, typename FieldValueType, typename... TOptions>
                 class extended_field_element;
 
@@ -73,6 +76,13 @@ namespace nil {
             static const bool value = true;
         };
 
+        template<typename TTypeBase, typename CurveGroupType, typename... TOptions>
+        struct is_curve_element<nil::crypto3::marshalling::types::validated_curve_element<TTypeBase,
+            CurveGroupType, TOptions...>> {
+
+            static const bool value = true;
+        };
+
         template<typename T>
         struct is_field_element {
 
@@ -267,6 +267,38 @@ namespace nil {
                         "crypto3::curve_element type");
                 };
 
+                /// @brief Curve element which is read with processing::curve_element_validated_reader.
+                /// @details Reading fails with nil::marshalling::status_type::invalid_msg_data unless the
+                ///     decoded point is on the curve and in the prime order subgroup. Meant for untrusted
+                ///     inputs such as proofs and verification keys.
+                template<typename TTypeBase, typename CurveGroupType, typename... TOptions>
+                class validated_curve_element : public curve_element<TTypeBase, CurveGroupType, TOptions...> {
+                    using base_type = curve_element<TTypeBase, CurveGroupType, TOptions...>;
+                    using reader_type =
+                        crypto3::marshalling::processing::curve_element_validated_reader<typename base_type::endian_type,
+                                                                                         CurveGroupType>;
+
+                public:
+                    using value_type = typename base_type::value_type;
+
+                    validated_curve_element() = default;
+
+                    explicit validated_curve_element(const value_type &val) : base_type(val) {
+                    }
+
+                    /// @brief Read field value from input data sequence and validate it
+                    /// @param[in, out] iter Iterator to read the data.
+                    /// @param[in] size Number of bytes available for reading.
+                    /// @return Status of read operation.
+                    /// @post Iterator is advanced.
+                    template<typename TIter>
+                    nil::marshalling::status_type read(TIter &iter, std::size_t size) {
+                        nil::marshalling::status_type status = reader_type::process(this->value(), iter);
+                        iter += base_type::max_length();
+                        return status;
+                    }
+                };
+
                 /// @brief Equality comparison operator.
                 /// @param[in] field1 First field.
                 /// @param[in] field2 Second field.
@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_MARSHALLING_G2_PRECOMPUTED_HPP
+#define CRYPTO3_MARSHALLING_G2_PRECOMPUTED_HPP
+
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                /** @brief Marshalling of the line coefficients produced by precompute_g2.
+                 *
+                 * Covers the ate precomputation of short Weierstrass curves in jacobian_with_a4_0 form
+                 * (BLS12, alt_bn128): the point itself and one (ell_0, ell_VW, ell_VV) triple per doubling
+                 * or addition step of the Miller loop.
+                 */
+                template<typename TTypeBase, typename CurveType>
+                using ate_ell_coeffs = nil::marshalling::types::bundle<
+                    TTypeBase,
+                    std::tuple<
+                        // ell_0
+                        field_element<TTypeBase, typename CurveType::template g2_type<>::field_type::value_type>,
+                        // ell_VW
+                        field_element<TTypeBase, typename CurveType::template g2_type<>::field_type::value_type>,
+                        // ell_VV
+                        field_element<TTypeBase, typename CurveType::template g2_type<>::field_type::value_type>>>;
+
+                template<typename TTypeBase, typename CurveType>
+                using g2_precomputed = nil::marshalling::types::bundle<
+                    TTypeBase,
+                    std::tuple<
+                        // Q
+                        validated_curve_element<TTypeBase, typename CurveType::template g2_type<>>,
+                        // coeffs
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            ate_ell_coeffs<TTypeBase, CurveType>,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<TTypeBase, std::size_t>>>>>;
+
+                template<typename CurveType, typename Endianness>
+                g2_precomputed<nil::marshalling::field_type<Endianness>, CurveType> fill_g2_precomputed(
+                    const typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type &prec_Q) {
+
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using g2_type = typename CurveType::template g2_type<>;
+                    using field_element_type =
+                        field_element<TTypeBase, typename CurveType::template g2_type<>::field_type::value_type>;
+                    using coeffs_type = ate_ell_coeffs<TTypeBase, CurveType>;
+                    using coeffs_vector_type = nil::marshalling::types::array_list<
+                        TTypeBase,
+                        coeffs_type,
+                        nil::marshalling::option::sequence_size_field_prefix<
+                            nil::marshalling::types::integral<TTypeBase, std::size_t>>>;
+
+                    coeffs_vector_type filled_coeffs;
+                    std::vector<coeffs_type> &filled_coeffs_val = filled_coeffs.value();
+                    filled_coeffs_val.reserve(prec_Q.coeffs.size());
+                    for (std::size_t i = 0; i < prec_Q.coeffs.size(); i++) {
+                        filled_coeffs_val.push_back(coeffs_type(std::make_tuple(
+                            field_element_type(prec_Q.coeffs[i].ell_0), field_element_type(prec_Q.coeffs[i].ell_VW),
+                            field_element_type(prec_Q.coeffs[i].ell_VV))));
+                    }
+
+                    const typename g2_type::value_type Q =
+                        prec_Q.is_zero ? typename g2_type::value_type::zero() :
+                                         typename g2_type::value_type(prec_Q.QX, prec_Q.QY,
+                                                                      g2_type::field_type::value_type::one());
+
+                    return g2_precomputed<TTypeBase, CurveType>(
+                        std::make_tuple(validated_curve_element<TTypeBase, g2_type>(Q), filled_coeffs));
+                }
+
+                /** @brief Loads the precomputation of a G2 point.
+                 *
+                 * The point is read with the validated reader, so it is known to be on the curve and in the
+                 * prime order subgroup. The stored coefficients are untrusted as well: they are compared with
+                 * the ones precompute_g2 derives from the point, and std::invalid_argument is thrown when the
+                 * count or any triple differs.
+                 */
+                template<typename CurveType, typename Endianness>
+                typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type make_g2_precomputed(
+                    const g2_precomputed<nil::marshalling::field_type<Endianness>, CurveType> &filled_prec_Q) {
+
+                    typedef typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type
+                        g2_precomputed_type;
+
+                    const typename CurveType::template g2_type<>::value_type Q =
+                        std::get<0>(filled_prec_Q.value()).value();
+                    g2_precomputed_type result =
+                        algebra::pairing::pairing_policy<CurveType>::precompute_g2::process(Q);
+
+                    const auto &filled_coeffs = std::get<1>(filled_prec_Q.value()).value();
+                    if (filled_coeffs.size() != result.coeffs.size()) {
+                        throw std::invalid_argument("g2_precomputed: wrong number of line coefficients");
+                    }
+                    for (std::size_t i = 0; i < filled_coeffs.size(); i++) {
+                        if (std::get<0>(filled_coeffs[i].value()).value() != result.coeffs[i].ell_0 ||
+                            std::get<1>(filled_coeffs[i].value()).value() != result.coeffs[i].ell_VW ||
+                            std::get<2>(filled_coeffs[i].value()).value() != result.coeffs[i].ell_VV) {
+                            throw std::invalid_argument("g2_precomputed: line coefficients do not match the point");
+                        }
+                    }
+
+                    return result;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_G2_PRECOMPUTED_HPP
@@ -43,6 +43,7 @@
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
+#include <nil/crypto3/container/merkle/multiproof.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -149,6 +150,27 @@ namespace nil {
                                                         // path_type _path
                                                         typename merkle_proof_path<TTypeBase, MerkleProof>::type>>;
 
+                template<typename TTypeBase, typename MerkleMultiproof>
+                using merkle_multiproof = nil::marshalling::types::bundle<
+                    TTypeBase,
+                    std::tuple<
+                        // std::size_t _row_count
+                        nil::marshalling::types::integral<TTypeBase, std::uint64_t>,
+                        // value_type _root
+                        typename merkle_node_value<TTypeBase, typename MerkleMultiproof::value_type>::type,
+                        // std::vector<std::size_t> _leaf_idxs
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            nil::marshalling::types::integral<TTypeBase, std::uint64_t>,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<TTypeBase, std::uint64_t>>>,
+                        // std::vector<value_type> _nodes
+                        nil::marshalling::types::array_list<
+                            TTypeBase,
+                            typename merkle_node_value<TTypeBase, typename MerkleMultiproof::value_type>::type,
+                            nil::marshalling::option::sequence_size_field_prefix<
+                                nil::marshalling::types::integral<TTypeBase, std::uint64_t>>>>>;
+
                 template<
                     typename ValueType,
                     typename Endianness,
@@ -347,6 +369,49 @@ namespace nil {
                     );
                     return mp;
                 }
+
+                template<typename MerkleMultiproof, typename Endianness>
+                merkle_multiproof<nil::marshalling::field_type<Endianness>, MerkleMultiproof>
+                    fill_merkle_multiproof(const MerkleMultiproof &mp) {
+
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using uint64_t_marshalling_type = nil::marshalling::types::integral<TTypeBase, std::uint64_t>;
+                    using value_type = typename MerkleMultiproof::value_type;
+                    using result_type = merkle_multiproof<TTypeBase, MerkleMultiproof>;
+
+                    typename std::tuple_element<2, typename result_type::value_type>::type filled_leaf_idxs;
+                    for (std::size_t leaf_idx : mp.leaf_indices()) {
+                        filled_leaf_idxs.value().push_back(uint64_t_marshalling_type(leaf_idx));
+                    }
+                    typename std::tuple_element<3, typename result_type::value_type>::type filled_nodes;
+                    for (const value_type &node : mp.nodes()) {
+                        filled_nodes.value().push_back(fill_merkle_node_value<value_type, Endianness>(node));
+                    }
+                    return result_type(std::make_tuple(uint64_t_marshalling_type(mp.row_count()),
+                                                       fill_merkle_node_value<value_type, Endianness>(mp.root()),
+                                                       filled_leaf_idxs, filled_nodes));
+                }
+
+                template<typename MerkleMultiproof, typename Endianness>
+                MerkleMultiproof make_merkle_multiproof(
+                    const merkle_multiproof<nil::marshalling::field_type<Endianness>, MerkleMultiproof>
+                        &filled_merkle_multiproof) {
+
+                    using value_type = typename MerkleMultiproof::value_type;
+
+                    std::vector<std::size_t> leaf_idxs;
+                    for (const auto &filled_leaf_idx : std::get<2>(filled_merkle_multiproof.value()).value()) {
+                        leaf_idxs.push_back(filled_leaf_idx.value());
+                    }
+                    std::vector<value_type> nodes;
+                    for (const auto &filled_node : std::get<3>(filled_merkle_multiproof.value()).value()) {
+                        nodes.push_back(make_merkle_node_value<value_type, Endianness>(filled_node));
+                    }
+                    return MerkleMultiproof(
+                        std::get<0>(filled_merkle_multiproof.value()).value(),
+                        make_merkle_node_value<value_type, Endianness>(std::get<1>(filled_merkle_multiproof.value())),
+                        leaf_idxs, nodes);
+                }
             }    // namespace types
         }        // namespace marshalling
     }            // namespace crypto3
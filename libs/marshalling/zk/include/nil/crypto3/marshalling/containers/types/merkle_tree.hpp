@@ -0,0 +1,94 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_MERKLE_TREE_HPP
+#define CRYPTO3_MARSHALLING_MERKLE_TREE_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/field_type.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+#include <nil/crypto3/marshalling/containers/types/merkle_proof.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                // All the nodes of a merkle_tree, leaves first and the root last, as the tree stores them
+                template<typename TTypeBase, typename MerkleTree>
+                using merkle_tree = nil::marshalling::types::array_list<
+                    TTypeBase,
+                    typename merkle_node_value<TTypeBase, MerkleTree>::type,
+                    nil::marshalling::option::sequence_size_field_prefix<
+                        nil::marshalling::types::integral<TTypeBase, std::uint64_t>>>;
+
+                template<typename MerkleTree, typename Endianness>
+                merkle_tree<nil::marshalling::field_type<Endianness>, MerkleTree>
+                    fill_merkle_tree(const MerkleTree &tree) {
+                    merkle_tree<nil::marshalling::field_type<Endianness>, MerkleTree> filled_tree;
+                    for (const auto &node_value : tree) {
+                        filled_tree.value().push_back(
+                            fill_merkle_node_value<typename MerkleTree::value_type, Endianness>(node_value));
+                    }
+                    return filled_tree;
+                }
+
+                /// @brief Throws std::invalid_argument if the nodes do not make a complete tree.
+                template<typename MerkleTree, typename Endianness>
+                MerkleTree make_merkle_tree(
+                    const merkle_tree<nil::marshalling::field_type<Endianness>, MerkleTree> &filled_tree) {
+                    if (filled_tree.value().empty()) {
+                        throw std::invalid_argument("Merkle tree has no nodes");
+                    }
+
+                    std::vector<typename MerkleTree::value_type> nodes;
+                    nodes.reserve(filled_tree.value().size());
+                    for (const auto &filled_node_value : filled_tree.value()) {
+                        nodes.push_back(make_merkle_node_value<typename MerkleTree::value_type, Endianness>(
+                            filled_node_value));
+                    }
+
+                    MerkleTree tree(nodes.begin(), nodes.end());
+                    std::size_t leaves = tree.leaves();
+                    while (leaves > 1 && leaves % MerkleTree::arity == 0) {
+                        leaves /= MerkleTree::arity;
+                    }
+                    if (leaves != 1 || tree.complete_size() != tree.size()) {
+                        throw std::invalid_argument("Merkle tree nodes do not make a complete tree");
+                    }
+                    return tree;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MARSHALLING_MERKLE_TREE_HPP
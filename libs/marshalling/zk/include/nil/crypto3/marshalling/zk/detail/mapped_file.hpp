@@ -0,0 +1,332 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_ZK_DETAIL_MAPPED_FILE_HPP
+#define CRYPTO3_MARSHALLING_ZK_DETAIL_MAPPED_FILE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
+#include <nil/crypto3/container/raw_storable.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CRYPTO3_MARSHALLING_HAS_MMAP
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace detail {
+                // Columns of raw tables start at multiples of this, which covers the alignment of any raw
+                // value type and keeps every column on its own cache lines.
+                constexpr static const std::size_t raw_column_alignment = 64;
+
+                /** @brief Representation of ValueType in raw files.
+                 *
+                 * Raw storable types are stored as they are.
+                 */
+                template<typename ValueType, typename = void>
+                struct raw_value {
+                    static_assert(containers::is_raw_storable<ValueType>::value,
+                                  "Values without a raw representation cannot be stored in raw files");
+
+                    typedef ValueType type;
+
+                    static const type &encode(const ValueType &value) {
+                        return value;
+                    }
+
+                    static ValueType decode(const type &raw) {
+                        return raw;
+                    }
+                };
+
+                /** @brief Prime field elements are not trivially copyable, so the limbs of their Montgomery form
+                 * are stored instead. Both directions only copy limbs, no value is converted or reduced.
+                 */
+                template<typename FieldParams>
+                struct raw_value<algebra::fields::detail::element_fp<FieldParams>> {
+                    typedef algebra::fields::detail::element_fp<FieldParams> value_type;
+                    typedef typename std::remove_cv<typename std::remove_reference<
+                        decltype(std::declval<value_type &>().data.backend().base_data())>::type>::type backend_type;
+                    typedef typename std::remove_cv<typename std::remove_pointer<
+                        decltype(std::declval<const backend_type &>().limbs())>::type>::type limb_type;
+
+                    typedef std::array<limb_type, backend_type::internal_limb_count> type;
+
+                    static_assert(containers::is_raw_storable<type>::value, "Limbs are stored as raw bytes");
+
+                    static type encode(const value_type &value) {
+                        const backend_type &base = value.data.backend().base_data();
+                        type result;
+                        std::copy(base.limbs(), base.limbs() + result.size(), result.begin());
+                        return result;
+                    }
+
+                    static value_type decode(const type &raw) {
+                        // zero() carries the modulus parameters, only its limbs are replaced
+                        value_type result = value_type::zero();
+                        std::copy(raw.begin(), raw.end(), result.data.backend().base_data().limbs());
+                        return result;
+                    }
+                };
+
+                inline std::size_t align_up(std::size_t size, std::size_t alignment) {
+                    return (size + alignment - 1) / alignment * alignment;
+                }
+
+                /** @brief Whether amount blocks of stride bytes starting at offset lie within size bytes.
+                 *
+                 * Offsets, amounts and strides come from file headers, so the check must not overflow for
+                 * any of their values.
+                 */
+                inline bool is_within(std::uint64_t offset, std::uint64_t amount, std::uint64_t stride,
+                                      std::uint64_t size) {
+                    return offset <= size && (amount == 0 || stride <= (size - offset) / amount);
+                }
+
+                inline void check_stream(const std::ostream &out) {
+                    if (!out) {
+                        throw std::runtime_error("Cannot write the raw file");
+                    }
+                }
+
+                inline void write_padding(std::ostream &out, std::size_t size) {
+                    static const char zeros[raw_column_alignment] = {};
+                    while (size > 0) {
+                        std::size_t chunk = std::min(size, raw_column_alignment);
+                        out.write(zeros, chunk);
+                        size -= chunk;
+                    }
+                    check_stream(out);
+                }
+
+                /** @brief Writes the raw_value of value.
+                 */
+                template<typename ValueType>
+                void write_raw_value(std::ostream &out, const ValueType &value) {
+                    const typename raw_value<ValueType>::type raw = raw_value<ValueType>::encode(value);
+                    out.write(reinterpret_cast<const char *>(&raw), sizeof(raw));
+                    check_stream(out);
+                }
+
+                /** @brief Writes the raw_value of each value followed by padding up to rows_amount values and
+                 * then to raw_column_alignment bytes.
+                 *
+                 * Field values are stored in Montgomery form, so such a column is read back without any
+                 * conversion. The layout is only meaningful for the same field type and the same byte order,
+                 * which readers check through a fingerprint of the field.
+                 */
+                template<typename ValueType>
+                void write_raw_column(std::ostream &out, const ValueType *values, std::size_t size,
+                                      std::size_t rows_amount, const ValueType &padding) {
+                    typedef typename raw_value<ValueType>::type raw_type;
+
+                    if (size > rows_amount) {
+                        throw std::invalid_argument("Column is longer than the table");
+                    }
+                    // encoded in chunks, so a column is never copied as a whole
+                    constexpr static const std::size_t chunk_size = 1024;
+                    std::vector<raw_type> chunk;
+                    chunk.reserve(std::min(size, chunk_size));
+                    for (std::size_t i = 0; i < size; i += chunk_size) {
+                        chunk.clear();
+                        for (std::size_t j = i; j < std::min(size, i + chunk_size); j++) {
+                            chunk.emplace_back(raw_value<ValueType>::encode(values[j]));
+                        }
+                        out.write(reinterpret_cast<const char *>(chunk.data()), chunk.size() * sizeof(raw_type));
+                    }
+                    const raw_type raw_padding = raw_value<ValueType>::encode(padding);
+                    for (std::size_t i = size; i < rows_amount; i++) {
+                        out.write(reinterpret_cast<const char *>(&raw_padding), sizeof(raw_type));
+                    }
+                    check_stream(out);
+                    const std::size_t written = rows_amount * sizeof(raw_type);
+                    write_padding(out, align_up(written, raw_column_alignment) - written);
+                }
+
+                template<typename ValueType>
+                void write_raw_column(std::ostream &out, const std::vector<ValueType> &column, std::size_t rows_amount,
+                                      const ValueType &padding) {
+                    write_raw_column(out, column.data(), column.size(), rows_amount, padding);
+                }
+
+                /** @brief Read-only column of a raw file, backed by the mapping.
+                 *
+                 * Values are decoded from their raw_value when they are accessed, so only the pages of the
+                 * touched rows are read. Element access returns values rather than references. The column is
+                 * valid while the mapped_file it points into is alive.
+                 */
+                template<typename ValueType>
+                class mapped_column {
+                    typedef typename raw_value<ValueType>::type raw_type;
+
+                    struct decode_value {
+                        ValueType operator()(const raw_type &raw) const {
+                            return raw_value<ValueType>::decode(raw);
+                        }
+                    };
+
+                public:
+                    typedef ValueType value_type;
+                    typedef boost::transform_iterator<decode_value, const raw_type *> const_iterator;
+                    typedef const_iterator iterator;
+
+                    mapped_column() = default;
+
+                    mapped_column(const std::uint8_t *data, std::size_t size) :
+                        _data(reinterpret_cast<const raw_type *>(data)), _size(size) {
+                    }
+
+                    value_type operator[](std::size_t index) const {
+                        return raw_value<ValueType>::decode(_data[index]);
+                    }
+
+                    std::size_t size() const {
+                        return _size;
+                    }
+
+                    const_iterator begin() const {
+                        return const_iterator(_data, decode_value());
+                    }
+
+                    const_iterator end() const {
+                        return const_iterator(_data + _size, decode_value());
+                    }
+
+                    bool operator==(const mapped_column &other) const {
+                        return _size == other._size && std::equal(begin(), end(), other.begin());
+                    }
+
+                    bool operator!=(const mapped_column &other) const {
+                        return !(*this == other);
+                    }
+
+                private:
+                    const raw_type *_data = nullptr;
+                    std::size_t _size = 0;
+                };
+
+                /** @brief Read-only view of a whole file.
+                 *
+                 * The file is mapped where mmap is available, so pages are only read when a column is touched
+                 * and are shared with the page cache. Elsewhere it is read into memory.
+                 */
+                class mapped_file {
+                public:
+                    explicit mapped_file(const std::string &path) {
+#ifdef CRYPTO3_MARSHALLING_HAS_MMAP
+                        int fd = ::open(path.c_str(), O_RDONLY);
+                        if (fd < 0) {
+                            throw std::runtime_error("Cannot open " + path);
+                        }
+                        struct stat st;
+                        if (::fstat(fd, &st) != 0) {
+                            ::close(fd);
+                            throw std::runtime_error("Cannot stat " + path);
+                        }
+                        _size = static_cast<std::size_t>(st.st_size);
+                        if (_size > 0) {
+                            void *mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+                            if (mapping == MAP_FAILED) {
+                                ::close(fd);
+                                throw std::runtime_error("Cannot map " + path);
+                            }
+                            _data = static_cast<const std::uint8_t *>(mapping);
+                        }
+                        ::close(fd);
+#else
+                        std::ifstream in(path, std::ios::binary | std::ios::ate);
+                        if (!in) {
+                            throw std::runtime_error("Cannot open " + path);
+                        }
+                        _size = static_cast<std::size_t>(in.tellg());
+                        in.seekg(0);
+                        // std::vector<std::uint64_t> storage keeps the buffer aligned for field values.
+                        _buffer.resize((_size + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+                        in.read(reinterpret_cast<char *>(_buffer.data()), _size);
+                        if (!in) {
+                            throw std::runtime_error("Cannot read " + path);
+                        }
+                        _data = reinterpret_cast<const std::uint8_t *>(_buffer.data());
+#endif
+                    }
+
+                    mapped_file(const mapped_file &) = delete;
+                    mapped_file &operator=(const mapped_file &) = delete;
+
+                    mapped_file(mapped_file &&other) noexcept :
+                        _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0))
+#ifndef CRYPTO3_MARSHALLING_HAS_MMAP
+                        , _buffer(std::move(other._buffer))
+#endif
+                    {
+                    }
+
+                    ~mapped_file() {
+#ifdef CRYPTO3_MARSHALLING_HAS_MMAP
+                        if (_data != nullptr) {
+                            ::munmap(const_cast<std::uint8_t *>(_data), _size);
+                        }
+#endif
+                    }
+
+                    const std::uint8_t *data() const {
+                        return _data;
+                    }
+
+                    std::size_t size() const {
+                        return _size;
+                    }
+
+                private:
+                    const std::uint8_t *_data = nullptr;
+                    std::size_t _size = 0;
+#ifndef CRYPTO3_MARSHALLING_HAS_MMAP
+                    std::vector<std::uint64_t> _buffer;
+#endif
+                };
+            }    // namespace detail
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MARSHALLING_ZK_DETAIL_MAPPED_FILE_HPP
@@ -27,9 +27,11 @@
 #ifndef CRYPTO3_MARSHALLING_COMMON_DATA_HPP
 #define CRYPTO3_MARSHALLING_COMMON_DATA_HPP
 
+#include <cstdint>
 #include <ratio>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 #include <nil/marshalling/types/bundle.hpp>
 #include <nil/marshalling/types/array_list.hpp>
@@ -109,6 +111,32 @@ namespace nil {
                     >
                 >;
 
+                /// @brief Bytes of vk.constraint_system_with_params_hash in the order placeholder_common_data stores them.
+                template<typename CommonDataType>
+                std::vector<std::uint8_t> constraint_system_with_params_hash_bytes(
+                    const typename CommonDataType::transcript_hash_type::digest_type &constraint_system_with_params_hash) {
+                    std::vector<std::uint8_t> result;
+                    if constexpr(nil::crypto3::algebra::is_field_element<
+                        typename CommonDataType::transcript_hash_type::word_type
+                    >::value) {
+                        auto integral = typename CommonDataType::field_type::integral_type(constraint_system_with_params_hash.data);
+                        std::vector<unsigned char> blob;
+                        export_bits(integral, std::back_inserter(blob), 8);
+                        result.assign(blob.rbegin(), blob.rend());
+                    } else {
+                        for( std::size_t i = 0; i < constraint_system_with_params_hash.size(); i++){
+                            result.push_back(constraint_system_with_params_hash[i]);
+                        }
+                    }
+                    return result;
+                }
+
+                template<typename CommonDataType>
+                std::vector<std::uint8_t> constraint_system_with_params_hash_bytes(const CommonDataType &common_data) {
+                    return constraint_system_with_params_hash_bytes<CommonDataType>(
+                        common_data.vk.constraint_system_with_params_hash);
+                }
+
                 template<typename Endianness, typename CommonDataType>
                 placeholder_common_data<nil::marshalling::field_type<Endianness>, CommonDataType>
                 fill_placeholder_common_data(const CommonDataType &common_data){
@@ -146,23 +174,10 @@ namespace nil {
                         nil::marshalling::option::sequence_size_field_prefix<nil::marshalling::types::integral<TTypeBase, std::size_t>>
                     > filled_constraint_system_with_params_hash;
 
-                    if constexpr(nil::crypto3::algebra::is_field_element<
-                        typename CommonDataType::transcript_hash_type::word_type
-                    >::value) {
-                        auto integral = typename CommonDataType::field_type::integral_type(common_data.vk.constraint_system_with_params_hash.data);
-                        std::vector<unsigned char> blob;
-                        export_bits(integral, std::back_inserter(blob), 8);
-                        for( std::size_t i = blob.size(); i > 0; i--){
-                            filled_constraint_system_with_params_hash.value().push_back(
-                                nil::marshalling::types::integral<TTypeBase, octet_type>(blob[i-1])
-                            );
-                        }
-                    } else {
-                        for( std::size_t i = 0; i < common_data.vk.constraint_system_with_params_hash.size(); i++){
-                            filled_constraint_system_with_params_hash.value().push_back(
-                                nil::marshalling::types::integral<TTypeBase, octet_type>(common_data.vk.constraint_system_with_params_hash[i])
-                            );
-                        }
+                    for( std::uint8_t octet:constraint_system_with_params_hash_bytes(common_data)){
+                        filled_constraint_system_with_params_hash.value().push_back(
+                            nil::marshalling::types::integral<TTypeBase, octet_type>(octet)
+                        );
                     }
 
                     using permuted_column_indices_type = nil::marshalling::types::array_list <TTypeBase,
@@ -0,0 +1,292 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_ZK_PLACEHOLDER_MAPPED_PREPROCESSED_DATA_HPP
+#define CRYPTO3_MARSHALLING_ZK_PLACEHOLDER_MAPPED_PREPROCESSED_DATA_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+
+#include <nil/crypto3/marshalling/zk/detail/mapped_file.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/common_data.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+                    constexpr static const char mapped_preprocessed_public_data_magic[8] = {'N', 'I', 'L', 'P', 'L', 'P', 'P', 'D'};
+                    constexpr static const std::uint32_t mapped_preprocessed_public_data_version = 2;
+
+                    struct mapped_preprocessed_public_data_header {
+                        char magic[8];
+                        std::uint32_t version;
+                        // Size of the raw_value of value_type, followed right after the header by the raw_value
+                        // of value_type::one(), see mapped_assignment_table_header.
+                        std::uint32_t element_size;
+                        std::uint64_t public_input_columns;
+                        std::uint64_t constant_columns;
+                        std::uint64_t selector_columns;
+                        std::uint64_t permutation_polynomials;
+                        std::uint64_t identity_polynomials;
+                        std::uint64_t rows_amount;
+                        // placeholder_common_data marshalled with the Endianness of the reader
+                        std::uint64_t common_data_offset;
+                        std::uint64_t common_data_size;
+                        // one std::uint64_t degree per polynomial, in the order of the columns
+                        std::uint64_t degrees_offset;
+                        std::uint64_t columns_offset;
+                        std::uint64_t column_stride;
+                    };
+
+                    static_assert(std::is_trivially_copyable<mapped_preprocessed_public_data_header>::value,
+                                  "The header is read and written as raw bytes");
+                }    // namespace detail
+
+                /** @brief Output of placeholder_public_preprocessor mapped from a file.
+                 *
+                 * The polynomials are stored in DFS form as raw values, like the columns of
+                 * mapped_assignment_table: public inputs, constants, selectors, permutation polynomials,
+                 * identity polynomials, q_last and q_blind, each of rows_amount values aligned to
+                 * raw_column_alignment bytes. The common data, which is small and holds no polynomial,
+                 * goes through the placeholder_common_data marshalling.
+                 * polynomial() is backed by the mapping. data() builds an owning preprocessed_data_type,
+                 * so it decodes every polynomial once.
+                 */
+                template<typename Endianness, typename PreprocessedDataType>
+                class mapped_preprocessed_public_data {
+                public:
+                    using preprocessed_data_type = PreprocessedDataType;
+                    using common_data_type = typename preprocessed_data_type::common_data_type;
+                    using public_table_type = decltype(preprocessed_data_type::public_polynomial_table);
+                    using polynomial_dfs_type = decltype(preprocessed_data_type::q_last);
+                    using value_type = typename polynomial_dfs_type::value_type;
+                    using raw_value_type = marshalling::detail::raw_value<value_type>;
+                    using raw_type = typename raw_value_type::type;
+                    using column_view_type = marshalling::detail::mapped_column<value_type>;
+
+                    explicit mapped_preprocessed_public_data(const std::string &path) : _file(path) {
+                        if (_file.size() < sizeof(detail::mapped_preprocessed_public_data_header) + sizeof(raw_type)) {
+                            throw std::invalid_argument("Preprocessed data file is too short: " + path);
+                        }
+                        std::memcpy(&_header, _file.data(), sizeof(_header));
+
+                        if (std::memcmp(_header.magic, detail::mapped_preprocessed_public_data_magic,
+                                        sizeof(_header.magic)) != 0) {
+                            throw std::invalid_argument("Not a preprocessed data file: " + path);
+                        }
+                        if (_header.version != detail::mapped_preprocessed_public_data_version) {
+                            throw std::invalid_argument("Unsupported preprocessed data version " +
+                                                        std::to_string(_header.version) + ": " + path);
+                        }
+                        const raw_type one = raw_value_type::encode(value_type::one());
+                        if (_header.element_size != sizeof(raw_type) ||
+                            std::memcmp(_file.data() + sizeof(_header), &one, sizeof(raw_type)) != 0) {
+                            throw std::invalid_argument("Preprocessed data was written for another field: " + path);
+                        }
+                        // every polynomial takes at least one byte, which also keeps polynomials_amount() from
+                        // overflowing
+                        if (_header.public_input_columns > _file.size() || _header.constant_columns > _file.size() ||
+                            _header.selector_columns > _file.size() ||
+                            _header.permutation_polynomials > _file.size() ||
+                            _header.identity_polynomials > _file.size() ||
+                            !marshalling::detail::is_within(_header.common_data_offset, 1, _header.common_data_size,
+                                                            _file.size()) ||
+                            !marshalling::detail::is_within(_header.degrees_offset, polynomials_amount(),
+                                                            sizeof(std::uint64_t), _file.size()) ||
+                            _header.columns_offset % marshalling::detail::raw_column_alignment != 0 ||
+                            _header.column_stride / sizeof(raw_type) < _header.rows_amount ||
+                            !marshalling::detail::is_within(_header.columns_offset, polynomials_amount(),
+                                                            _header.column_stride, _file.size())) {
+                            throw std::invalid_argument("Preprocessed data file is truncated or malformed: " + path);
+                        }
+                    }
+
+                    std::size_t polynomials_amount() const {
+                        return _header.public_input_columns + _header.constant_columns + _header.selector_columns +
+                               _header.permutation_polynomials + _header.identity_polynomials + 2;
+                    }
+
+                    /// @brief DFS values of the index-th polynomial in file order, valid while the file is alive.
+                    column_view_type polynomial(std::size_t index) const {
+                        BOOST_ASSERT(index < polynomials_amount());
+                        return column_view_type(_file.data() + _header.columns_offset + index * _header.column_stride,
+                                                _header.rows_amount);
+                    }
+
+                    std::size_t degree(std::size_t index) const {
+                        BOOST_ASSERT(index < polynomials_amount());
+                        std::uint64_t result;
+                        std::memcpy(&result, _file.data() + _header.degrees_offset + index * sizeof(std::uint64_t),
+                                    sizeof(result));
+                        return result;
+                    }
+
+                    common_data_type common_data() const {
+                        using TTypeBase = nil::marshalling::field_type<Endianness>;
+
+                        placeholder_common_data<TTypeBase, common_data_type> filled_common_data;
+                        auto read_iter = _file.data() + _header.common_data_offset;
+                        if (filled_common_data.read(read_iter, _header.common_data_size) !=
+                            nil::marshalling::status_type::success) {
+                            throw std::invalid_argument("Malformed common data in the preprocessed data file");
+                        }
+                        return make_placeholder_common_data<Endianness, common_data_type>(filled_common_data);
+                    }
+
+                    preprocessed_data_type data() const {
+                        std::size_t index = 0;
+                        auto polynomials = [this, &index](std::size_t amount) {
+                            std::vector<polynomial_dfs_type> result;
+                            result.reserve(amount);
+                            for (std::size_t i = 0; i < amount; i++, index++) {
+                                const column_view_type view = polynomial(index);
+                                result.emplace_back(degree(index), view.begin(), view.end());
+                            }
+                            return result;
+                        };
+
+                        auto public_inputs = polynomials(_header.public_input_columns);
+                        auto constants = polynomials(_header.constant_columns);
+                        auto selectors = polynomials(_header.selector_columns);
+                        auto permutation_polynomials = polynomials(_header.permutation_polynomials);
+                        auto identity_polynomials = polynomials(_header.identity_polynomials);
+                        auto q = polynomials(2);
+
+                        return preprocessed_data_type {
+                            public_table_type(std::move(public_inputs), std::move(constants), std::move(selectors)),
+                            std::move(permutation_polynomials),
+                            std::move(identity_polynomials),
+                            std::move(q[0]),
+                            std::move(q[1]),
+                            common_data()
+                        };
+                    }
+
+                private:
+                    marshalling::detail::mapped_file _file;
+                    detail::mapped_preprocessed_public_data_header _header;
+                };
+
+                template<typename Endianness, typename PreprocessedDataType>
+                void write_mapped_preprocessed_public_data(std::ostream &out, const PreprocessedDataType &data) {
+                    using common_data_type = typename PreprocessedDataType::common_data_type;
+                    using polynomial_dfs_type = decltype(PreprocessedDataType::q_last);
+                    using value_type = typename polynomial_dfs_type::value_type;
+                    using raw_type = typename marshalling::detail::raw_value<value_type>::type;
+
+                    std::vector<const polynomial_dfs_type *> polynomials;
+                    for (const auto &column : data.public_polynomial_table.public_inputs()) {
+                        polynomials.push_back(&column);
+                    }
+                    for (const auto &column : data.public_polynomial_table.constants()) {
+                        polynomials.push_back(&column);
+                    }
+                    for (const auto &column : data.public_polynomial_table.selectors()) {
+                        polynomials.push_back(&column);
+                    }
+                    for (const auto &polynomial : data.permutation_polynomials) {
+                        polynomials.push_back(&polynomial);
+                    }
+                    for (const auto &polynomial : data.identity_polynomials) {
+                        polynomials.push_back(&polynomial);
+                    }
+                    polynomials.push_back(&data.q_last);
+                    polynomials.push_back(&data.q_blind);
+
+                    const std::size_t rows_amount = data.common_data.desc.rows_amount;
+                    for (const auto *polynomial : polynomials) {
+                        if (polynomial->size() != rows_amount) {
+                            throw std::invalid_argument("Preprocessed polynomial is not on the basic domain");
+                        }
+                    }
+
+                    auto filled_common_data = fill_placeholder_common_data<Endianness, common_data_type>(data.common_data);
+                    std::vector<std::uint8_t> common_data_blob(filled_common_data.length(), 0x00);
+                    auto write_iter = common_data_blob.begin();
+                    if (filled_common_data.write(write_iter, common_data_blob.size()) !=
+                        nil::marshalling::status_type::success) {
+                        throw std::invalid_argument("Cannot marshal the common data");
+                    }
+
+                    detail::mapped_preprocessed_public_data_header header;
+                    std::memcpy(header.magic, detail::mapped_preprocessed_public_data_magic, sizeof(header.magic));
+                    header.version = detail::mapped_preprocessed_public_data_version;
+                    header.element_size = sizeof(raw_type);
+                    header.public_input_columns = data.public_polynomial_table.public_inputs_amount();
+                    header.constant_columns = data.public_polynomial_table.constants_amount();
+                    header.selector_columns = data.public_polynomial_table.selectors_amount();
+                    header.permutation_polynomials = data.permutation_polynomials.size();
+                    header.identity_polynomials = data.identity_polynomials.size();
+                    header.rows_amount = rows_amount;
+                    header.common_data_offset = sizeof(header) + sizeof(raw_type);
+                    header.common_data_size = common_data_blob.size();
+                    header.degrees_offset = header.common_data_offset + header.common_data_size;
+                    const std::size_t degrees_end = header.degrees_offset + polynomials.size() * sizeof(std::uint64_t);
+                    header.columns_offset =
+                        marshalling::detail::align_up(degrees_end, marshalling::detail::raw_column_alignment);
+                    header.column_stride = marshalling::detail::align_up(rows_amount * sizeof(raw_type),
+                                                                         marshalling::detail::raw_column_alignment);
+
+                    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                    marshalling::detail::write_raw_value(out, value_type::one());
+                    out.write(reinterpret_cast<const char *>(common_data_blob.data()), common_data_blob.size());
+                    for (const auto *polynomial : polynomials) {
+                        const std::uint64_t degree = polynomial->degree();
+                        out.write(reinterpret_cast<const char *>(&degree), sizeof(degree));
+                    }
+                    marshalling::detail::check_stream(out);
+                    marshalling::detail::write_padding(out, header.columns_offset - degrees_end);
+
+                    const value_type zero = value_type::zero();
+                    for (const auto *polynomial : polynomials) {
+                        marshalling::detail::write_raw_column(out, &*polynomial->begin(), polynomial->size(),
+                                                              rows_amount, zero);
+                    }
+                }
+
+                /// @brief Same result as placeholder_public_preprocessor::process, read from a file written by
+                /// write_mapped_preprocessed_public_data.
+                template<typename Endianness, typename PreprocessedDataType>
+                PreprocessedDataType read_mapped_preprocessed_public_data(const std::string &path) {
+                    return mapped_preprocessed_public_data<Endianness, PreprocessedDataType>(path).data();
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MARSHALLING_ZK_PLACEHOLDER_MAPPED_PREPROCESSED_DATA_HPP
@@ -0,0 +1,284 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_ZK_PLACEHOLDER_PREPROCESSOR_CACHE_HPP
+#define CRYPTO3_MARSHALLING_ZK_PLACEHOLDER_PREPROCESSOR_CACHE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/zk/commitments/type_traits.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/proof.hpp>
+
+#include <nil/crypto3/marshalling/containers/types/merkle_tree.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/common_data.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/mapped_preprocessed_data.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+                    constexpr static const char placeholder_public_preprocessor_cache_extension[] = ".ppd";
+                    constexpr static const char placeholder_public_preprocessor_cache_tree_extension[] = ".ppt";
+
+                    inline void append_octets(std::vector<std::uint8_t> &out, std::uint64_t value) {
+                        for (std::size_t i = 0; i < sizeof(value); i++) {
+                            out.push_back(std::uint8_t(value >> (8 * i)));
+                        }
+                    }
+
+                    inline std::string sha256_hex(const std::vector<std::uint8_t> &data) {
+                        static const char digits[] = "0123456789abcdef";
+
+                        const std::vector<std::uint8_t> digest = nil::crypto3::hash<nil::crypto3::hashes::sha2<256>>(data);
+
+                        std::string result;
+                        for (std::uint8_t byte : digest) {
+                            result.push_back(digits[byte >> 4]);
+                            result.push_back(digits[byte & 0x0f]);
+                        }
+                        return result;
+                    }
+
+                    template<typename Marshalled>
+                    void write_marshalled_file(const Marshalled &filled, const std::filesystem::path &path) {
+                        std::vector<std::uint8_t> blob(filled.length(), 0x00);
+                        auto write_iter = blob.begin();
+                        if (filled.write(write_iter, blob.size()) != nil::marshalling::status_type::success) {
+                            throw std::invalid_argument("Cannot marshal " + path.string());
+                        }
+
+                        std::filesystem::path temporary_path = path;
+                        temporary_path += ".tmp";
+                        {
+                            std::ofstream out(temporary_path, std::ios::binary | std::ios::trunc);
+                            out.write(reinterpret_cast<const char *>(blob.data()), blob.size());
+                            if (!out) {
+                                throw std::runtime_error("Cannot write " + temporary_path.string());
+                            }
+                        }
+                        std::filesystem::rename(temporary_path, path);
+                    }
+
+                    template<typename Marshalled>
+                    Marshalled read_marshalled_file(const std::filesystem::path &path) {
+                        std::ifstream in(path, std::ios::binary);
+                        if (!in) {
+                            throw std::runtime_error("Cannot read " + path.string());
+                        }
+                        const std::vector<std::uint8_t> blob((std::istreambuf_iterator<char>(in)),
+                                                             std::istreambuf_iterator<char>());
+
+                        Marshalled filled;
+                        auto read_iter = blob.begin();
+                        if (filled.read(read_iter, blob.size()) != nil::marshalling::status_type::success ||
+                            read_iter != blob.end()) {
+                            throw std::invalid_argument("Cannot unmarshal " + path.string());
+                        }
+                        return filled;
+                    }
+                }    // namespace detail
+
+                /** @brief Prefix of the file names of the placeholder_public_preprocessor_cache entries with
+                 * the given lookup key.
+                 *
+                 * The key of the in-memory cache is constraint_system_with_params_hash, see
+                 * placeholder_public_preprocessor::compute_constraint_system_with_params_hash, and
+                 * max_quotient_chunks. Both are known before preprocessing, so the entries of a circuit can
+                 * be found without reading the others.
+                 */
+                template<typename CommonDataType>
+                std::string placeholder_public_preprocessor_cache_key_name(
+                    const typename CommonDataType::transcript_hash_type::digest_type &constraint_system_with_params_hash,
+                    std::size_t max_quotient_chunks) {
+                    std::vector<std::uint8_t> key =
+                        constraint_system_with_params_hash_bytes<CommonDataType>(constraint_system_with_params_hash);
+                    detail::append_octets(key, key.size());
+                    detail::append_octets(key, max_quotient_chunks);
+                    return detail::sha256_hex(key);
+                }
+
+                /** @brief File name of a placeholder_public_preprocessor_cache entry.
+                 *
+                 * placeholder_public_preprocessor_cache_key_name, then the hex SHA-256 of the marshalled fixed
+                 * values commitment, which tells apart entries of one circuit that differ in constants or
+                 * selectors. The name has the same length for every commitment scheme.
+                 */
+                template<typename Endianness, typename CommonDataType>
+                std::string placeholder_public_preprocessor_cache_file_name(const CommonDataType &common_data) {
+                    auto filled_commitment = fill_commitment<Endianness, typename CommonDataType::commitment_scheme_type>(
+                        common_data.vk.fixed_values_commitment);
+                    std::vector<std::uint8_t> commitment(filled_commitment.length(), 0x00);
+                    auto write_iter = commitment.begin();
+                    if (filled_commitment.write(write_iter, commitment.size()) !=
+                        nil::marshalling::status_type::success) {
+                        throw std::invalid_argument("Cannot marshal the preprocessor cache key");
+                    }
+
+                    return placeholder_public_preprocessor_cache_key_name<CommonDataType>(
+                               common_data.vk.constraint_system_with_params_hash, common_data.max_quotient_chunks) +
+                           "-" + detail::sha256_hex(commitment) +
+                           detail::placeholder_public_preprocessor_cache_extension;
+                }
+
+                /** @brief Writes the entries of a placeholder_public_preprocessor_cache to directory.
+                 *
+                 * Each entry goes to its own file in the format of write_mapped_preprocessed_public_data,
+                 * named by placeholder_public_preprocessor_cache_file_name. For LPC the Merkle tree of
+                 * FIXED_VALUES_BATCH goes next to it, in a file with the .ppt extension. Files that already
+                 * exist are kept, new ones are written under a temporary name first, the tree before the
+                 * entry, so a reader never sees a partial entry. Returns the number of entries written.
+                 */
+                template<typename Endianness, typename CacheType>
+                std::size_t save_placeholder_public_preprocessor_cache(const CacheType &cache,
+                                                                       const std::filesystem::path &directory) {
+                    using commitment_scheme_type = typename CacheType::commitment_scheme_type;
+
+                    std::filesystem::create_directories(directory);
+
+                    std::size_t written = 0;
+                    for (const auto &entry : cache.entries()) {
+                        const std::filesystem::path path =
+                            directory / placeholder_public_preprocessor_cache_file_name<Endianness>(
+                                entry.preprocessed_data.common_data);
+                        if (std::filesystem::exists(path)) {
+                            continue;
+                        }
+
+                        if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
+                            std::filesystem::path tree_path = path;
+                            tree_path.replace_extension(detail::placeholder_public_preprocessor_cache_tree_extension);
+                            const auto &tree =
+                                entry.commitment_scheme.get_precommitment(nil::crypto3::zk::snark::FIXED_VALUES_BATCH);
+                            detail::write_marshalled_file(
+                                fill_merkle_tree<typename commitment_scheme_type::precommitment_type, Endianness>(tree),
+                                tree_path);
+                        }
+
+                        std::filesystem::path temporary_path = path;
+                        temporary_path += ".tmp";
+                        {
+                            std::ofstream out(temporary_path, std::ios::binary | std::ios::trunc);
+                            write_mapped_preprocessed_public_data<Endianness>(out, entry.preprocessed_data);
+                            if (!out) {
+                                throw std::runtime_error("Cannot write " + temporary_path.string());
+                            }
+                        }
+                        std::filesystem::rename(temporary_path, path);
+                        ++written;
+                    }
+                    return written;
+                }
+
+                /** @brief Inserts into cache the entries with the given lookup key saved by
+                 * save_placeholder_public_preprocessor_cache.
+                 *
+                 * Only the files named with placeholder_public_preprocessor_cache_key_name are read, call it
+                 * before placeholder_public_preprocessor_cache::process of the same circuit. commitment_scheme
+                 * holds no batches yet and is copied for each entry. An LPC entry with its Merkle tree is not
+                 * committed again, see placeholder_public_preprocessor_cache::insert. Entries already in cache
+                 * are skipped. Returns the number of entries inserted.
+                 */
+                template<typename Endianness, typename CacheType>
+                std::size_t load_placeholder_public_preprocessor_cache(
+                    CacheType &cache, const std::filesystem::path &directory,
+                    const typename CacheType::preprocessed_data_type::common_data_type::transcript_hash_type::digest_type
+                        &constraint_system_with_params_hash,
+                    std::size_t max_quotient_chunks,
+                    const typename CacheType::commitment_scheme_type &commitment_scheme) {
+                    using preprocessed_data_type = typename CacheType::preprocessed_data_type;
+                    using common_data_type = typename preprocessed_data_type::common_data_type;
+                    using commitment_scheme_type = typename CacheType::commitment_scheme_type;
+
+                    if (!std::filesystem::is_directory(directory)) {
+                        return 0;
+                    }
+
+                    const std::string prefix = placeholder_public_preprocessor_cache_key_name<common_data_type>(
+                                                   constraint_system_with_params_hash, max_quotient_chunks) + "-";
+
+                    std::set<std::string> cached_names;
+                    for (const auto &entry : cache.entries()) {
+                        cached_names.insert(placeholder_public_preprocessor_cache_file_name<Endianness>(
+                            entry.preprocessed_data.common_data));
+                    }
+
+                    std::size_t inserted = 0;
+                    for (const auto &file : std::filesystem::directory_iterator(directory)) {
+                        const std::string name = file.path().filename().string();
+                        if (!file.is_regular_file() || name.compare(0, prefix.size(), prefix) != 0 ||
+                            file.path().extension() != detail::placeholder_public_preprocessor_cache_extension ||
+                            cached_names.count(name) != 0) {
+                            continue;
+                        }
+
+                        preprocessed_data_type data =
+                            read_mapped_preprocessed_public_data<Endianness, preprocessed_data_type>(
+                                file.path().string());
+                        if (placeholder_public_preprocessor_cache_file_name<Endianness>(data.common_data) != name) {
+                            throw std::invalid_argument("Preprocessor cache entry does not match its file name: " +
+                                                        file.path().string());
+                        }
+
+                        if constexpr (nil::crypto3::zk::is_lpc<commitment_scheme_type>) {
+                            using precommitment_type = typename commitment_scheme_type::precommitment_type;
+
+                            std::filesystem::path tree_path = file.path();
+                            tree_path.replace_extension(detail::placeholder_public_preprocessor_cache_tree_extension);
+                            if (std::filesystem::exists(tree_path)) {
+                                cache.insert(
+                                    std::move(data), commitment_scheme,
+                                    make_merkle_tree<precommitment_type, Endianness>(
+                                        detail::read_marshalled_file<
+                                            merkle_tree<nil::marshalling::field_type<Endianness>, precommitment_type>>(
+                                            tree_path)));
+                                ++inserted;
+                                continue;
+                            }
+                        }
+                        cache.insert(std::move(data), commitment_scheme);
+                        ++inserted;
+                    }
+                    return inserted;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MARSHALLING_ZK_PLACEHOLDER_PREPROCESSOR_CACHE_HPP
@@ -0,0 +1,251 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_ZK_PLONK_MAPPED_ASSIGNMENT_TABLE_HPP
+#define CRYPTO3_MARSHALLING_ZK_PLONK_MAPPED_ASSIGNMENT_TABLE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+
+#include <nil/crypto3/marshalling/zk/detail/mapped_file.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                namespace detail {
+                    constexpr static const char mapped_assignment_table_magic[8] = {'N', 'I', 'L', 'P', 'L', 'T', 'B', 'L'};
+                    constexpr static const std::uint32_t mapped_assignment_table_version = 2;
+
+                    struct mapped_assignment_table_header {
+                        char magic[8];
+                        std::uint32_t version;
+                        // Size of the raw_value of value_type, followed right after the header by the raw_value
+                        // of value_type::one(). Both have to match the reader's field, or the columns are not
+                        // usable as is.
+                        std::uint32_t element_size;
+                        std::uint64_t witness_columns;
+                        std::uint64_t public_input_columns;
+                        std::uint64_t constant_columns;
+                        std::uint64_t selector_columns;
+                        std::uint64_t usable_rows;
+                        std::uint64_t rows_amount;
+                        std::uint64_t columns_offset;
+                        std::uint64_t column_stride;
+                    };
+
+                    static_assert(std::is_trivially_copyable<mapped_assignment_table_header>::value,
+                                  "The header is read and written as raw bytes");
+                }    // namespace detail
+
+                /** @brief Assignment table file mapped into memory.
+                 *
+                 * Unlike plonk_assignment_table, which encodes every value through the field marshalling,
+                 * the file holds the raw_value of every cell, which for field elements are their Montgomery
+                 * form limbs: a header, a fingerprint of the field, then witnesses, public inputs, constants
+                 * and selectors, each column padded with zeros to rows_amount values and aligned to
+                 * raw_column_alignment bytes.
+                 * Opening it costs a single mmap. column() and view() are backed by the mapping, values are
+                 * decoded from their limbs when they are read. table() builds an owning plonk table, so it
+                 * decodes every column once.
+                 * The format is tied to the field type and to the byte order of the machine that wrote it.
+                 */
+                template<typename PlonkTable>
+                class mapped_assignment_table {
+                public:
+                    using field_type = typename PlonkTable::field_type;
+                    using value_type = typename field_type::value_type;
+                    using table_description_type = zk::snark::plonk_table_description<field_type>;
+                    using raw_value_type = marshalling::detail::raw_value<value_type>;
+                    using raw_type = typename raw_value_type::type;
+                    using column_view_type = marshalling::detail::mapped_column<value_type>;
+                    /// Plonk table whose columns are views into the mapping, valid while the mapped table is alive.
+                    using view_type = zk::snark::plonk_table<field_type, column_view_type>;
+
+                    explicit mapped_assignment_table(const std::string &path) :
+                        _file(path), _desc(0, 0, 0, 0) {
+
+                        if (_file.size() < sizeof(detail::mapped_assignment_table_header) + sizeof(raw_type)) {
+                            throw std::invalid_argument("Assignment table file is too short: " + path);
+                        }
+                        std::memcpy(&_header, _file.data(), sizeof(_header));
+
+                        if (std::memcmp(_header.magic, detail::mapped_assignment_table_magic, sizeof(_header.magic)) != 0) {
+                            throw std::invalid_argument("Not an assignment table file: " + path);
+                        }
+                        if (_header.version != detail::mapped_assignment_table_version) {
+                            throw std::invalid_argument("Unsupported assignment table version " +
+                                                        std::to_string(_header.version) + ": " + path);
+                        }
+                        const raw_type one = raw_value_type::encode(value_type::one());
+                        if (_header.element_size != sizeof(raw_type) ||
+                            std::memcmp(_file.data() + sizeof(_header), &one, sizeof(raw_type)) != 0) {
+                            throw std::invalid_argument("Assignment table was written for another field: " + path);
+                        }
+                        // every column takes at least one byte, which also keeps the width from overflowing
+                        if (_header.witness_columns > _file.size() || _header.public_input_columns > _file.size() ||
+                            _header.constant_columns > _file.size() || _header.selector_columns > _file.size() ||
+                            _header.rows_amount > _file.size()) {
+                            throw std::invalid_argument("Assignment table file is truncated or malformed: " + path);
+                        }
+
+                        _desc = table_description_type(_header.witness_columns, _header.public_input_columns,
+                                                       _header.constant_columns, _header.selector_columns,
+                                                       _header.usable_rows, _header.rows_amount);
+                        if (_desc.usable_rows_amount >= _desc.rows_amount) {
+                            throw std::invalid_argument(
+                                "Rows amount should be greater than usable rows amount. Rows amount = " +
+                                std::to_string(_desc.rows_amount) +
+                                ", usable rows amount = " + std::to_string(_desc.usable_rows_amount));
+                        }
+                        if (_header.columns_offset % marshalling::detail::raw_column_alignment != 0 ||
+                            _header.column_stride / sizeof(raw_type) < _desc.rows_amount ||
+                            !marshalling::detail::is_within(_header.columns_offset, _desc.table_width(),
+                                                            _header.column_stride, _file.size())) {
+                            throw std::invalid_argument("Assignment table file is truncated or malformed: " + path);
+                        }
+                    }
+
+                    const table_description_type &table_description() const {
+                        return _desc;
+                    }
+
+                    /// @brief rows_amount values of the column with the given global index, see
+                    /// plonk_table_description::global_index. Valid while the table is alive.
+                    column_view_type column(std::size_t index) const {
+                        BOOST_ASSERT(index < _desc.table_width());
+                        return column_view_type(_file.data() + _header.columns_offset + index * _header.column_stride,
+                                                _desc.rows_amount);
+                    }
+
+                    /// @brief Plonk table backed by the mapping, no column is decoded up front.
+                    view_type view() const {
+                        return make_table<view_type>([](const column_view_type &view) { return view; });
+                    }
+
+                    /// @brief Owning copy of the table, every column is decoded once.
+                    PlonkTable table() const {
+                        return make_table<PlonkTable>([](const column_view_type &view) {
+                            return typename PlonkTable::column_type(view.begin(), view.end());
+                        });
+                    }
+
+                private:
+                    template<typename TableType, typename MakeColumn>
+                    TableType make_table(MakeColumn make_column) const {
+                        std::size_t index = 0;
+                        auto columns = [this, &index, &make_column](std::size_t amount) {
+                            std::vector<typename TableType::column_type> result;
+                            result.reserve(amount);
+                            for (std::size_t i = 0; i < amount; i++, index++) {
+                                result.emplace_back(make_column(column(index)));
+                            }
+                            return result;
+                        };
+
+                        auto witnesses = columns(_desc.witness_columns);
+                        auto public_inputs = columns(_desc.public_input_columns);
+                        auto constants = columns(_desc.constant_columns);
+                        auto selectors = columns(_desc.selector_columns);
+
+                        return TableType(
+                            typename TableType::private_table_type(std::move(witnesses)),
+                            typename TableType::public_table_type(std::move(public_inputs), std::move(constants),
+                                                                  std::move(selectors)));
+                    }
+
+                    marshalling::detail::mapped_file _file;
+                    detail::mapped_assignment_table_header _header;
+                    table_description_type _desc;
+                };
+
+                template<typename PlonkTable>
+                void write_mapped_assignment_table(std::ostream &out, std::size_t usable_rows,
+                                                   const PlonkTable &assignments) {
+                    using value_type = typename PlonkTable::field_type::value_type;
+                    using raw_type = typename marshalling::detail::raw_value<value_type>::type;
+
+                    const std::size_t rows_amount = assignments.rows_amount();
+                    const std::size_t header_size = sizeof(detail::mapped_assignment_table_header) + sizeof(raw_type);
+
+                    detail::mapped_assignment_table_header header;
+                    std::memcpy(header.magic, detail::mapped_assignment_table_magic, sizeof(header.magic));
+                    header.version = detail::mapped_assignment_table_version;
+                    header.element_size = sizeof(raw_type);
+                    header.witness_columns = assignments.witnesses_amount();
+                    header.public_input_columns = assignments.public_inputs_amount();
+                    header.constant_columns = assignments.constants_amount();
+                    header.selector_columns = assignments.selectors_amount();
+                    header.usable_rows = usable_rows;
+                    header.rows_amount = rows_amount;
+                    header.columns_offset =
+                        marshalling::detail::align_up(header_size, marshalling::detail::raw_column_alignment);
+                    header.column_stride = marshalling::detail::align_up(rows_amount * sizeof(raw_type),
+                                                                         marshalling::detail::raw_column_alignment);
+
+                    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                    marshalling::detail::check_stream(out);
+                    marshalling::detail::write_raw_value(out, value_type::one());
+                    marshalling::detail::write_padding(out, header.columns_offset - header_size);
+
+                    const value_type zero = value_type::zero();
+                    for (const auto &column : assignments.witnesses()) {
+                        marshalling::detail::write_raw_column(out, column, rows_amount, zero);
+                    }
+                    for (const auto &column : assignments.public_inputs()) {
+                        marshalling::detail::write_raw_column(out, column, rows_amount, zero);
+                    }
+                    for (const auto &column : assignments.constants()) {
+                        marshalling::detail::write_raw_column(out, column, rows_amount, zero);
+                    }
+                    for (const auto &column : assignments.selectors()) {
+                        marshalling::detail::write_raw_column(out, column, rows_amount, zero);
+                    }
+                }
+
+                /// @brief Same result as make_assignment_table, read from a file written by write_mapped_assignment_table.
+                template<typename PlonkTable>
+                std::pair<zk::snark::plonk_table_description<typename PlonkTable::field_type>, PlonkTable>
+                    read_mapped_assignment_table(const std::string &path) {
+                    mapped_assignment_table<PlonkTable> mapped(path);
+                    return std::make_pair(mapped.table_description(), mapped.table());
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MARSHALLING_ZK_PLONK_MAPPED_ASSIGNMENT_TABLE_HPP
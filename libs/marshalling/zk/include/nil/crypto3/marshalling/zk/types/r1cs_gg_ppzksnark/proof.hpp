@@ -64,11 +64,11 @@ namespace nil {
                     TTypeBase,
                     std::tuple<
                         // g_A
-                        curve_element<TTypeBase, typename ProofType::curve_type::template g1_type<>>,
+                        validated_curve_element<TTypeBase, typename ProofType::curve_type::template g1_type<>>,
                         // g_B
-                        curve_element<TTypeBase, typename ProofType::curve_type::template g2_type<>>,
+                        validated_curve_element<TTypeBase, typename ProofType::curve_type::template g2_type<>>,
                         // g_C
-                        curve_element<TTypeBase, typename ProofType::curve_type::template g1_type<>>>>;
+                        validated_curve_element<TTypeBase, typename ProofType::curve_type::template g1_type<>>>>;
 
                 template<typename ProofType, typename Endianness>
                 r1cs_gg_ppzksnark_proof<nil::marshalling::field_type<Endianness>, ProofType>
@@ -77,10 +77,10 @@ namespace nil {
                     using TTypeBase = nil::marshalling::field_type<Endianness>;
 
                     using curve_g1_element_type =
-                        curve_element<TTypeBase, typename ProofType::curve_type::template g1_type<>>;
+                        validated_curve_element<TTypeBase, typename ProofType::curve_type::template g1_type<>>;
 
                     using curve_g2_element_type =
-                        curve_element<TTypeBase, typename ProofType::curve_type::template g2_type<>>;
+                        validated_curve_element<TTypeBase, typename ProofType::curve_type::template g2_type<>>;
 
                     return r1cs_gg_ppzksnark_proof<nil::marshalling::field_type<Endianness>, ProofType>(
                         std::make_tuple(curve_g1_element_type(r1cs_gg_ppzksnark_proof_inp.g_A),
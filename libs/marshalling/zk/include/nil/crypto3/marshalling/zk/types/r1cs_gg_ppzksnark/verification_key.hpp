@@ -48,6 +48,7 @@
 
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/g2_precomputed.hpp>
 #include <nil/crypto3/marshalling/zk/types/accumulation_vector.hpp>
 
 namespace nil {
@@ -69,9 +70,9 @@ namespace nil {
                         // alpha_g1_beta_g2
                         field_element<TTypeBase, typename VerificationKey::curve_type::gt_type::value_type>,
                         // gamma_g2
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
                         // delta_g2
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
                         // gamma_ABC_g1
                         accumulation_vector<
                             TTypeBase,
@@ -86,7 +87,7 @@ namespace nil {
                     using field_gt_element_type =
                         field_element<TTypeBase, typename VerificationKey::curve_type::gt_type::value_type>;
                     using curve_g2_element_type =
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>;
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>;
                     using accumulation_vector_type = accumulation_vector<
                         TTypeBase,
                         container::accumulation_vector<typename VerificationKey::curve_type::template g1_type<>>>;
@@ -125,6 +126,75 @@ namespace nil {
                                 std::get<3>(filled_r1cs_gg_ppzksnark_verification_key.value()))));
                 }
 
+                /// @brief Processed verification key, stored with the line coefficients of gamma_g2 and delta_g2
+                /// so that a verifier loads it without running precompute_g2 again.
+                template<typename TTypeBase,
+                         typename VerificationKey,
+                         typename = typename std::enable_if<
+                             std::is_same<VerificationKey,
+                                          zk::snark::r1cs_gg_ppzksnark_processed_verification_key<
+                                              typename VerificationKey::curve_type>>::value,
+                             bool>::type,
+                         typename... TOptions>
+                using r1cs_gg_ppzksnark_processed_verification_key = nil::marshalling::types::bundle<
+                    TTypeBase,
+                    std::tuple<
+                        // vk_alpha_g1_beta_g2
+                        field_element<TTypeBase, typename VerificationKey::curve_type::gt_type::value_type>,
+                        // vk_gamma_g2_precomp
+                        g2_precomputed<TTypeBase, typename VerificationKey::curve_type>,
+                        // vk_delta_g2_precomp
+                        g2_precomputed<TTypeBase, typename VerificationKey::curve_type>,
+                        // gamma_ABC_g1
+                        accumulation_vector<
+                            TTypeBase,
+                            container::accumulation_vector<typename VerificationKey::curve_type::template g1_type<>>>>>;
+
+                template<typename VerificationKey, typename Endianness>
+                r1cs_gg_ppzksnark_processed_verification_key<nil::marshalling::field_type<Endianness>, VerificationKey>
+                    fill_r1cs_gg_ppzksnark_verification_key(
+                        const VerificationKey &r1cs_gg_ppzksnark_processed_verification_key_inp) {
+
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using curve_type = typename VerificationKey::curve_type;
+                    using field_gt_element_type = field_element<TTypeBase, typename curve_type::gt_type::value_type>;
+
+                    field_gt_element_type filled_alpha_g1_beta_g2(
+                        r1cs_gg_ppzksnark_processed_verification_key_inp.vk_alpha_g1_beta_g2);
+
+                    return r1cs_gg_ppzksnark_processed_verification_key<TTypeBase, VerificationKey>(std::make_tuple(
+                        filled_alpha_g1_beta_g2,
+                        fill_g2_precomputed<curve_type, Endianness>(
+                            r1cs_gg_ppzksnark_processed_verification_key_inp.vk_gamma_g2_precomp),
+                        fill_g2_precomputed<curve_type, Endianness>(
+                            r1cs_gg_ppzksnark_processed_verification_key_inp.vk_delta_g2_precomp),
+                        fill_accumulation_vector<
+                            container::accumulation_vector<typename curve_type::template g1_type<>>, Endianness>(
+                            r1cs_gg_ppzksnark_processed_verification_key_inp.gamma_ABC_g1)));
+                }
+
+                template<typename VerificationKey, typename Endianness>
+                VerificationKey make_r1cs_gg_ppzksnark_verification_key(
+                    const r1cs_gg_ppzksnark_processed_verification_key<nil::marshalling::field_type<Endianness>,
+                                                                       VerificationKey>
+                        &filled_r1cs_gg_ppzksnark_processed_verification_key) {
+
+                    using curve_type = typename VerificationKey::curve_type;
+
+                    VerificationKey result;
+                    result.vk_alpha_g1_beta_g2 =
+                        std::get<0>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()).value();
+                    result.vk_gamma_g2_precomp = make_g2_precomputed<curve_type, Endianness>(
+                        std::get<1>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()));
+                    result.vk_delta_g2_precomp = make_g2_precomputed<curve_type, Endianness>(
+                        std::get<2>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()));
+                    result.gamma_ABC_g1 = make_accumulation_vector<
+                        container::accumulation_vector<typename curve_type::template g1_type<>>, Endianness>(
+                        std::get<3>(filled_r1cs_gg_ppzksnark_processed_verification_key.value()));
+
+                    return result;
+                }
+
                 template<typename TTypeBase,
                          typename VerificationKey,
                          typename = typename std::enable_if<
@@ -139,13 +209,13 @@ namespace nil {
                         // alpha_g1_beta_g2
                         field_element<TTypeBase, typename VerificationKey::curve_type::gt_type::value_type>,
                         // gamma_g2
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
                         // delta_g2
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>,
                         // delta_g1
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g1_type<>>,
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g1_type<>>,
                         // gamma_g1
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g1_type<>>,
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g1_type<>>,
                         // gamma_ABC_g1
                         accumulation_vector<
                             TTypeBase,
@@ -160,9 +230,9 @@ namespace nil {
                     using field_gt_element_type =
                         field_element<TTypeBase, typename VerificationKey::curve_type::gt_type::value_type>;
                     using curve_g1_element_type =
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g1_type<>>;
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g1_type<>>;
                     using curve_g2_element_type =
-                        curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>;
+                        validated_curve_element<TTypeBase, typename VerificationKey::curve_type::template g2_type<>>;
                     using accumulation_vector_type = accumulation_vector<
                         TTypeBase,
                         container::accumulation_vector<typename VerificationKey::curve_type::template g1_type<>>>;
@@ -33,6 +33,7 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
 #include <fstream>
 
 #include <nil/marshalling/status_type.hpp>
@@ -49,6 +50,7 @@
 #include <nil/crypto3/hash/poseidon.hpp>
 
 #include <nil/crypto3/marshalling/containers/types/merkle_proof.hpp>
+#include <nil/crypto3/marshalling/containers/types/merkle_tree.hpp>
 
 template<typename TIter>
 void print_hex_byteblob(std::ostream &os, TIter iter_begin, TIter iter_end, bool endl) {
@@ -148,6 +150,95 @@ void test_merkle_proof(std::size_t tree_depth) {
     BOOST_CHECK(proof == constructed_val_read);
 }
 
+template<typename Endianness, typename Hash, std::size_t Arity, std::size_t LeafSize = 64>
+void test_merkle_multiproof(std::size_t tree_depth, std::size_t opened_number) {
+
+    using namespace nil::crypto3::marshalling;
+    using merkle_multiproof_type = nil::crypto3::containers::merkle_multiproof<Hash, Arity>;
+    using merkle_multiproof_marshalling_type =
+            types::merkle_multiproof<nil::marshalling::field_type<Endianness>, merkle_multiproof_type>;
+
+    std::size_t leafs_number = std::pow(Arity, tree_depth);
+    auto data = generate_random_data<std::uint8_t, LeafSize>(leafs_number);
+    auto tree = nil::crypto3::containers::make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    std::vector<std::size_t> leaf_idxs;
+    for (std::size_t i = 0; i < opened_number; ++i) {
+        leaf_idxs.push_back(std::rand() % leafs_number);
+    }
+    merkle_multiproof_type proof(tree, leaf_idxs);
+
+    auto filled_merkle_multiproof = types::fill_merkle_multiproof<merkle_multiproof_type, Endianness>(proof);
+    BOOST_CHECK(proof == (types::make_merkle_multiproof<merkle_multiproof_type, Endianness>(filled_merkle_multiproof)));
+
+    std::vector<std::uint8_t> cv;
+    cv.resize(filled_merkle_multiproof.length(), 0x00);
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status = filled_merkle_multiproof.write(write_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    merkle_multiproof_marshalling_type test_val_read;
+    auto read_iter = cv.begin();
+    status = test_val_read.read(read_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    merkle_multiproof_type constructed_val_read =
+        types::make_merkle_multiproof<merkle_multiproof_type, Endianness>(test_val_read);
+    BOOST_CHECK(proof == constructed_val_read);
+
+    std::vector<std::array<std::uint8_t, LeafSize>> opened;
+    for (std::size_t leaf_idx : constructed_val_read.leaf_indices()) {
+        opened.push_back(data[leaf_idx]);
+    }
+    BOOST_CHECK(constructed_val_read.validate(opened));
+}
+
+template<typename Endianness, typename Hash, std::size_t Arity, std::size_t LeafSize = 64>
+void test_merkle_tree(std::size_t tree_depth) {
+
+    using namespace nil::crypto3::marshalling;
+    using merkle_tree_type = nil::crypto3::containers::merkle_tree<Hash, Arity>;
+    using merkle_tree_marshalling_type = types::merkle_tree<nil::marshalling::field_type<Endianness>, merkle_tree_type>;
+
+    std::size_t leafs_number = std::pow(Arity, tree_depth);
+    auto data = generate_random_data<std::uint8_t, LeafSize>(leafs_number);
+    merkle_tree_type tree;
+
+    if constexpr (nil::crypto3::algebra::is_field_element<typename Hash::word_type>::value) {
+        std::vector<
+            nil::crypto3::hashes::block_to_field_elements_wrapper<
+                typename Hash::word_type::field_type,
+                std::array<std::uint8_t, LeafSize>
+            >
+        > wrappers;
+        for (const auto& inner_containers : data) {
+            wrappers.emplace_back(inner_containers);
+        }
+        tree = nil::crypto3::containers::make_merkle_tree<Hash, Arity>(wrappers.begin(), wrappers.end());
+    } else {
+        tree = nil::crypto3::containers::make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    }
+
+    auto filled_merkle_tree = types::fill_merkle_tree<merkle_tree_type, Endianness>(tree);
+
+    std::vector<std::uint8_t> cv;
+    cv.resize(filled_merkle_tree.length(), 0x00);
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status = filled_merkle_tree.write(write_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    merkle_tree_marshalling_type test_val_read;
+    auto read_iter = cv.begin();
+    status = test_val_read.read(read_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    merkle_tree_type constructed_val_read = types::make_merkle_tree<merkle_tree_type, Endianness>(test_val_read);
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), constructed_val_read.begin(), constructed_val_read.end()));
+    BOOST_CHECK(tree.root() == constructed_val_read.root());
+    BOOST_CHECK(tree.leaves() == constructed_val_read.leaves());
+
+    // A tree without its root is not accepted
+    test_val_read.value().pop_back();
+    BOOST_CHECK_THROW((types::make_merkle_tree<merkle_tree_type, Endianness>(test_val_read)), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE(marshalling_merkle_proof_test_suite)
 
 using curve_type = nil::crypto3::algebra::curves::pallas;
@@ -188,4 +279,18 @@ using BlockHashTypes = boost::mpl::list<
         test_merkle_proof<nil::marshalling::option::big_endian, HashType, 5>(10);
     }
 
+    BOOST_AUTO_TEST_CASE_TEMPLATE(marshalling_merkle_tree_arity_2_test, HashType, HashTypes) {
+        test_merkle_tree<nil::marshalling::option::big_endian, HashType, 2>(5);
+        test_merkle_tree<nil::marshalling::option::big_endian, HashType, 2>(10);
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(marshalling_merkle_tree_arity_4_test, HashType, BlockHashTypes) {
+        test_merkle_tree<nil::marshalling::option::big_endian, HashType, 4>(5);
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(marshalling_merkle_multiproof_test, HashType, BlockHashTypes) {
+        test_merkle_multiproof<nil::marshalling::option::big_endian, HashType, 2>(10, 40);
+        test_merkle_multiproof<nil::marshalling::option::big_endian, HashType, 4>(5, 20);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -48,6 +48,7 @@
 
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor_cache.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
@@ -63,6 +64,8 @@
 #include <nil/crypto3/marshalling/zk/types/commitments/kzg.hpp>
 #include <nil/crypto3/marshalling/zk/types/commitments/lpc.hpp>
 #include <nil/crypto3/marshalling/zk/types/placeholder/common_data.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/mapped_preprocessed_data.hpp>
+#include <nil/crypto3/marshalling/zk/types/placeholder/preprocessor_cache.hpp>
 #include "./detail/circuits.hpp"
 
 
@@ -149,6 +152,86 @@ void test_placeholder_common_data(CommonDataType common_data, std::string folder
     }
 }
 
+template<typename PreprocessedDataType>
+void test_mapped_preprocessed_public_data(const PreprocessedDataType &data) {
+    using Endianness = nil::marshalling::option::big_endian;
+
+    std::filesystem::path mapped_path =
+        std::filesystem::temp_directory_path() / "crypto3_marshalling_mapped_preprocessed_data.bin";
+    {
+        std::ofstream mapped_out(mapped_path, std::ios::binary);
+        nil::crypto3::marshalling::types::write_mapped_preprocessed_public_data<Endianness>(mapped_out, data);
+    }
+    auto read_data = nil::crypto3::marshalling::types::read_mapped_preprocessed_public_data<
+        Endianness, PreprocessedDataType>(mapped_path.string());
+    std::filesystem::remove(mapped_path);
+
+    BOOST_CHECK(data.public_polynomial_table == read_data.public_polynomial_table);
+    BOOST_CHECK(data.permutation_polynomials == read_data.permutation_polynomials);
+    BOOST_CHECK(data.identity_polynomials == read_data.identity_polynomials);
+    BOOST_CHECK(data.q_last == read_data.q_last);
+    BOOST_CHECK(data.q_blind == read_data.q_blind);
+    BOOST_CHECK(data.common_data == read_data.common_data);
+}
+
+template<typename FieldType, typename ParamsType, typename PublicTableType>
+void test_saved_preprocessor_cache(
+    const plonk_constraint_system<FieldType> &constraint_system,
+    const PublicTableType &public_table,
+    const plonk_table_description<FieldType> &desc,
+    const typename ParamsType::commitment_scheme_type &commitment_scheme,
+    std::size_t max_quotient_poly_chunks
+) {
+    using Endianness = nil::marshalling::option::big_endian;
+    using cache_type = placeholder_public_preprocessor_cache<FieldType, ParamsType>;
+
+    std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "crypto3_marshalling_preprocessor_cache";
+    std::filesystem::remove_all(directory);
+
+    cache_type cache;
+    auto computed = cache.process(constraint_system, public_table, desc, commitment_scheme, max_quotient_poly_chunks);
+    const auto &common_data = computed.preprocessed_data.common_data;
+    // hex SHA-256 of the key and of the commitment and the extension, whatever the size of the commitment
+    const std::string file_name =
+        nil::crypto3::marshalling::types::placeholder_public_preprocessor_cache_file_name<Endianness>(common_data);
+    BOOST_CHECK(file_name.size() == 2 * 32 + 1 + 2 * 32 + 4);
+    BOOST_CHECK(nil::crypto3::marshalling::types::save_placeholder_public_preprocessor_cache<Endianness>(
+        cache, directory) == 1);
+    BOOST_CHECK(nil::crypto3::marshalling::types::save_placeholder_public_preprocessor_cache<Endianness>(
+        cache, directory) == 0);
+    BOOST_CHECK(std::filesystem::exists(directory / file_name));
+    BOOST_CHECK(std::filesystem::exists((directory / file_name).replace_extension(".ppt")) ==
+                nil::crypto3::zk::is_lpc<typename ParamsType::commitment_scheme_type>);
+
+    // Another process starts from an empty cache and reads only the entries of its key
+    cache_type loaded_cache;
+    BOOST_CHECK(nil::crypto3::marshalling::types::load_placeholder_public_preprocessor_cache<Endianness>(
+        loaded_cache, directory, common_data.vk.constraint_system_with_params_hash, max_quotient_poly_chunks + 1,
+        commitment_scheme) == 0);
+    BOOST_CHECK(nil::crypto3::marshalling::types::load_placeholder_public_preprocessor_cache<Endianness>(
+        loaded_cache, directory, common_data.vk.constraint_system_with_params_hash, max_quotient_poly_chunks,
+        commitment_scheme) == 1);
+    BOOST_CHECK(nil::crypto3::marshalling::types::load_placeholder_public_preprocessor_cache<Endianness>(
+        loaded_cache, directory, common_data.vk.constraint_system_with_params_hash, max_quotient_poly_chunks,
+        commitment_scheme) == 0);
+    auto loaded = loaded_cache.process(constraint_system, public_table, desc, commitment_scheme, max_quotient_poly_chunks);
+    std::filesystem::remove_all(directory);
+
+    if constexpr (nil::crypto3::zk::is_lpc<typename ParamsType::commitment_scheme_type>) {
+        // The tree is read, not built again
+        const auto &computed_tree = computed.commitment_scheme.get_precommitment(FIXED_VALUES_BATCH);
+        const auto &loaded_tree = loaded.commitment_scheme.get_precommitment(FIXED_VALUES_BATCH);
+        BOOST_CHECK(std::equal(computed_tree.begin(), computed_tree.end(), loaded_tree.begin(), loaded_tree.end()));
+    }
+
+    BOOST_CHECK(loaded_cache.hits() == 1);
+    BOOST_CHECK(loaded_cache.misses() == 0);
+    BOOST_CHECK(computed.preprocessed_data.public_polynomial_table == loaded.preprocessed_data.public_polynomial_table);
+    BOOST_CHECK(computed.preprocessed_data.permutation_polynomials == loaded.preprocessed_data.permutation_polynomials);
+    BOOST_CHECK(computed.preprocessed_data.common_data == loaded.preprocessed_data.common_data);
+}
+
 BOOST_AUTO_TEST_SUITE(placeholder_circuit1_poseidon)
     using Endianness = nil::marshalling::option::big_endian;
     using TTypeBase = nil::marshalling::field_type<Endianness>;
@@ -217,6 +300,10 @@ BOOST_AUTO_TEST_CASE(prover_test) {
         test_placeholder_common_data<common_data_type>(lpc_preprocessed_public_data.common_data, "circuit1");
     else
         test_placeholder_common_data<common_data_type>(lpc_preprocessed_public_data.common_data);
+    test_mapped_preprocessed_public_data(lpc_preprocessed_public_data);
+    test_saved_preprocessor_cache<field_type, lpc_placeholder_params_type>(
+        constraint_system, assignments.public_table(), desc, lpc_scheme_type(fri_params),
+        columns_with_copy_constraints.size());
 }
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -7,6 +7,8 @@
 #include <regex>
 #include <fstream>
 #include <filesystem>
+#include <algorithm>
+#include <cstddef>
 
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/field_type.hpp>
@@ -22,6 +24,7 @@
 #include <nil/crypto3/random/algebraic_random_device.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/variable.hpp>
 #include <nil/crypto3/marshalling/zk/types/plonk/assignment_table.hpp>
+#include <nil/crypto3/marshalling/zk/types/plonk/mapped_assignment_table.hpp>
 
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
@@ -84,6 +87,39 @@ void test_assignment_table(std::size_t usable_rows, PlonkTable val, std::string
     BOOST_CHECK(val == table_desc_pair.second);
     BOOST_CHECK(usable_rows == table_desc_pair.first.usable_rows_amount);
 
+    std::filesystem::path mapped_path =
+        std::filesystem::temp_directory_path() / "crypto3_marshalling_mapped_assignment_table.bin";
+    {
+        std::ofstream mapped_out(mapped_path, std::ios::binary);
+        types::write_mapped_assignment_table(mapped_out, usable_rows, val);
+    }
+    table_desc_pair = types::read_mapped_assignment_table<PlonkTable>(mapped_path.string());
+    {
+        // the view decodes the same values straight from the mapping
+        types::mapped_assignment_table<PlonkTable> mapped(mapped_path.string());
+        const auto view = mapped.view();
+        BOOST_CHECK(view.witnesses_amount() == val.witnesses_amount());
+        for (std::size_t i = 0; i < val.witnesses_amount(); i++) {
+            BOOST_CHECK(std::equal(val.witness(i).begin(), val.witness(i).end(), view.witness(i).begin()));
+        }
+        for (std::size_t i = 0; i < val.selectors_amount(); i++) {
+            BOOST_CHECK(std::equal(val.selector(i).begin(), val.selector(i).end(), view.selector(i).begin()));
+        }
+    }
+    {
+        // a header whose column range wraps around is rejected instead of pointing past the file
+        std::fstream mapped_io(mapped_path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint64_t columns_offset = std::uint64_t(-64);
+        mapped_io.seekp(offsetof(types::detail::mapped_assignment_table_header, columns_offset));
+        mapped_io.write(reinterpret_cast<const char *>(&columns_offset), sizeof(columns_offset));
+    }
+    BOOST_CHECK_THROW(types::mapped_assignment_table<PlonkTable>(mapped_path.string()), std::invalid_argument);
+    std::filesystem::remove(mapped_path);
+
+    BOOST_CHECK(val == table_desc_pair.second);
+    BOOST_CHECK(usable_rows == table_desc_pair.first.usable_rows_amount);
+    BOOST_CHECK(val.rows_amount() == table_desc_pair.first.rows_amount);
+
     if(folder_name != "") {
         std::filesystem::create_directory(folder_name);
         std::ofstream out;
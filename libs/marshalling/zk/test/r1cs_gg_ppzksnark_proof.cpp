@@ -46,11 +46,14 @@
 #include <nil/crypto3/algebra/pairing/bls12.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
+#include <nil/crypto3/algebra/test_tools/curve_points.hpp>
 
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark.hpp>
 
 #include <nil/crypto3/marshalling/zk/types/r1cs_gg_ppzksnark/proof.hpp>
 
+using nil::crypto3::algebra::test_tools::small_order_point;
+
 template<typename TIter>
 void print_byteblob(TIter iter_begin, TIter iter_end) {
     for (TIter it = iter_begin; it != iter_end; it++) {
@@ -105,6 +108,47 @@ void test_proof(typename SchemeType::proof_type val) {
     BOOST_CHECK(val == constructed_val_read);
 }
 
+template<typename SchemeType, typename Endianness>
+nil::marshalling::status_type write_and_read_proof(const typename SchemeType::proof_type &val) {
+    using namespace nil::crypto3::marshalling;
+
+    using unit_type = unsigned char;
+    using proof_type =
+            types::r1cs_gg_ppzksnark_proof<nil::marshalling::field_type<Endianness>, typename SchemeType::proof_type>;
+
+    proof_type filled_val = types::fill_r1cs_gg_ppzksnark_proof<typename SchemeType::proof_type, Endianness>(val);
+
+    std::vector<unit_type> cv(filled_val.length(), 0x00);
+    auto write_iter = cv.begin();
+    nil::marshalling::status_type status = filled_val.write(write_iter, cv.size());
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+
+    proof_type test_val_read;
+    auto read_iter = cv.begin();
+    return test_val_read.read(read_iter, cv.size());
+}
+
+template<typename SchemeType, typename Endianness>
+void test_proof_rejects_small_order_points() {
+    using curve_type = typename SchemeType::proof_type::curve_type;
+    using g1_type = typename curve_type::template g1_type<>;
+    using g2_type = typename curve_type::template g2_type<>;
+    using proof_type = typename SchemeType::proof_type;
+
+    const auto g1 = nil::crypto3::algebra::random_element<g1_type>();
+    const auto g2 = nil::crypto3::algebra::random_element<g2_type>();
+
+    BOOST_CHECK(write_and_read_proof<SchemeType, Endianness>(proof_type(g1, g2, g1)) ==
+                nil::marshalling::status_type::success);
+
+    BOOST_CHECK(write_and_read_proof<SchemeType, Endianness>(proof_type(small_order_point<g1_type>(), g2, g1)) ==
+                nil::marshalling::status_type::invalid_msg_data);
+    BOOST_CHECK(write_and_read_proof<SchemeType, Endianness>(proof_type(g1, small_order_point<g2_type>(), g1)) ==
+                nil::marshalling::status_type::invalid_msg_data);
+    BOOST_CHECK(write_and_read_proof<SchemeType, Endianness>(proof_type(g1, g2, small_order_point<g1_type>())) ==
+                nil::marshalling::status_type::invalid_msg_data);
+}
+
 template<typename SchemeType, typename Endianness>
 void test_proof() {
     std::cout << std::hex;
@@ -133,6 +177,12 @@ BOOST_AUTO_TEST_SUITE(proof_test_suite)
         std::cout << "BLS12-381 r1cs_gg_ppzksnark proof big-endian test finished" << std::endl;
     }
 
+    BOOST_AUTO_TEST_CASE(proof_bls12_381_be_small_order_points) {
+        test_proof_rejects_small_order_points<
+                nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>,
+                nil::marshalling::option::big_endian>();
+    }
+
 // BOOST_AUTO_TEST_CASE(proof_bls12_381_le) {
 //     std::cout << "BLS12-381 r1cs_gg_ppzksnark proof little-endian test started" << std::endl;
 //     test_proof<nil::crypto3::zk::snark::r1cs_gg_ppzksnark<nil::crypto3::algebra::curves::bls12<381>>,
@@ -201,6 +201,32 @@ test_verification_key() {
     }
 }
 
+template<typename VerificationKey, typename VerificationKeyMarshalling, typename Endianness, std::size_t TSize,
+        typename CurveType = typename VerificationKey::curve_type>
+typename std::enable_if<std::is_same<nil::crypto3::zk::snark::r1cs_gg_ppzksnark_processed_verification_key<CurveType>,
+        VerificationKey>::value>::type
+test_verification_key() {
+    using g1_type = typename CurveType::template g1_type<>;
+    using g2_type = typename CurveType::template g2_type<>;
+    using gt_type = typename CurveType::gt_type;
+
+    std::cout << std::hex;
+    std::cerr << std::hex;
+    for (unsigned i = 0; i < 16; ++i) {
+        typename g1_type::value_type first = nil::crypto3::algebra::random_element<g1_type>();
+        std::vector<typename g1_type::value_type> rest;
+        for (std::size_t i = 0; i < TSize; i++) {
+            rest.push_back(nil::crypto3::algebra::random_element<g1_type>());
+        }
+        nil::crypto3::zk::snark::r1cs_gg_ppzksnark_verification_key<CurveType> vk(
+                nil::crypto3::algebra::random_element<gt_type>(),
+                nil::crypto3::algebra::random_element<g2_type>(),
+                nil::crypto3::algebra::random_element<g2_type>(),
+                std::move(nil::crypto3::container::accumulation_vector<g1_type>(std::move(first), std::move(rest))));
+        test_verification_key<Endianness, VerificationKeyMarshalling>(VerificationKey(vk));
+    }
+}
+
 // TODO: move to pubkey marshling
 template<typename PublicKey, typename PublicKeyMarshalling, typename Endianness, std::size_t TSize,
         typename CurveType = typename PublicKey::scheme_type::curve_type>
@@ -259,6 +285,56 @@ BOOST_AUTO_TEST_SUITE(verification_key_test_suite)
         std::cout << "BLS12-381 r1cs_gg_ppzksnark extended verification key big-endian test finished" << std::endl;
     }
 
+    BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_processed_verification_key_bls12_381_be) {
+        using endianness = nil::marshalling::option::big_endian;
+        using key_type =
+                nil::crypto3::zk::snark::r1cs_gg_ppzksnark_processed_verification_key<nil::crypto3::algebra::curves::bls12<381>>;
+        using key_marshalling_type = nil::crypto3::marshalling::types::r1cs_gg_ppzksnark_processed_verification_key<
+                nil::marshalling::field_type<endianness>, key_type>;
+        std::cout << "BLS12-381 r1cs_gg_ppzksnark processed verification key big-endian test started" << std::endl;
+        test_verification_key<key_type, key_marshalling_type, endianness, 5>();
+        std::cout << "BLS12-381 r1cs_gg_ppzksnark processed verification key big-endian test finished" << std::endl;
+    }
+
+    BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_processed_verification_key_bls12_381_be_tampered_coeffs) {
+        using endianness = nil::marshalling::option::big_endian;
+        using curve_type = nil::crypto3::algebra::curves::bls12<381>;
+        using g1_type = typename curve_type::template g1_type<>;
+        using g2_type = typename curve_type::template g2_type<>;
+        using gt_type = typename curve_type::gt_type;
+        using key_type = nil::crypto3::zk::snark::r1cs_gg_ppzksnark_processed_verification_key<curve_type>;
+
+        nil::crypto3::zk::snark::r1cs_gg_ppzksnark_verification_key<curve_type> vk(
+                nil::crypto3::algebra::random_element<gt_type>(),
+                nil::crypto3::algebra::random_element<g2_type>(),
+                nil::crypto3::algebra::random_element<g2_type>(),
+                nil::crypto3::container::accumulation_vector<g1_type>(
+                        nil::crypto3::algebra::random_element<g1_type>(),
+                        std::vector<typename g1_type::value_type>(1, nil::crypto3::algebra::random_element<g1_type>())));
+        key_type processed_vk(vk);
+
+        auto filled_val =
+                nil::crypto3::marshalling::types::fill_r1cs_gg_ppzksnark_verification_key<key_type, endianness>(
+                        processed_vk);
+
+        // A changed line coefficient no longer matches the coefficients derived from gamma_g2
+        auto tampered_val = filled_val;
+        auto &gamma_coeffs = std::get<1>(std::get<1>(tampered_val.value()).value()).value();
+        std::get<0>(gamma_coeffs[0].value()).value() += g2_type::field_type::value_type::one();
+        BOOST_CHECK_THROW(
+                (nil::crypto3::marshalling::types::make_r1cs_gg_ppzksnark_verification_key<key_type, endianness>(
+                        tampered_val)),
+                std::invalid_argument);
+
+        // So does a truncated coefficient list
+        tampered_val = filled_val;
+        std::get<1>(std::get<2>(tampered_val.value()).value()).value().pop_back();
+        BOOST_CHECK_THROW(
+                (nil::crypto3::marshalling::types::make_r1cs_gg_ppzksnark_verification_key<key_type, endianness>(
+                        tampered_val)),
+                std::invalid_argument);
+    }
+
 // TODO: move to pubkey marshling
     BOOST_AUTO_TEST_CASE(elgamal_verifiable_public_key_bls12_381_be) {
         using endianness = nil::marshalling::option::big_endian;
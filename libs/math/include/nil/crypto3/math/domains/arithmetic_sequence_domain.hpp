@@ -82,6 +82,12 @@ namespace nil {
                     precomputation_sentinel = false;
                 }
 
+                void prepare_fft_cache() override {
+                    if (!precomputation_sentinel) {
+                        do_precomputation();
+                    }
+                }
+
                 void fft(std::vector<value_type> &a) override {
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
@@ -28,6 +28,8 @@
 
 #include <vector>
 
+#include <boost/range/iterator_range.hpp>
+
 #include <nil/crypto3/math/detail/field_utils.hpp>
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
@@ -58,6 +60,23 @@ namespace nil {
                     detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
                 }
 
+                void prepare_fft(std::vector<value_type> &a) {
+                    if (a.size() < this->m) {
+                        a.resize(this->m, value_type::zero());
+                    }
+                    prepare_fft(a.size());
+                }
+
+                void prepare_fft(std::size_t size) {
+                    if (size != this->m) {
+                        throw std::invalid_argument("basic_radix2: expected a.size() == this->m");
+                    }
+
+                    if (!fft_cache) {
+                        create_fft_cache();
+                    }
+                }
+
             public:
                 typedef FieldType field_type;
 
@@ -77,38 +96,54 @@ namespace nil {
                     }
                 }
 
-                void fft(std::vector<value_type> &a) override {
-                    if (a.size() != this->m) {
-                        if (a.size() < this->m) {
-                            a.resize(this->m, value_type::zero());
-                        } else {
-                            throw std::invalid_argument("basic_radix2: expected a.size() == this->m");
-                        }
-                    }
-
+                void prepare_fft_cache() override {
                     if (!fft_cache) {
                         create_fft_cache();
                     }
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->first);
+                }
+
+                void fft(std::vector<value_type> &a) override {
+                    prepare_fft(a);
+                    fft(a.data(), a.size());
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
-                    if (a.size() != this->m) {
-                        if (a.size() < this->m) {
-                            a.resize(this->m, value_type::zero());
-                        } else {
-                            throw std::invalid_argument("basic_radix2: expected a.size() == this->m");
-                        }
-                    }
+                    prepare_fft(a);
+                    inverse_fft(a.data(), a.size());
+                }
 
-                    if (!fft_cache) {
-                        create_fft_cache();
+                void fft(value_type *a, std::size_t size) override {
+                    prepare_fft(size);
+                    auto range = boost::make_iterator_range(a, a + size);
+                    detail::basic_radix2_fft_cached<FieldType>(range, fft_cache->first);
+                }
+
+                void inverse_fft(value_type *a, std::size_t size) override {
+                    prepare_fft(size);
+                    auto range = boost::make_iterator_range(a, a + size);
+                    detail::basic_radix2_fft_cached<FieldType>(range, fft_cache->second);
+
+                    const field_value_type sconst = field_value_type(size).inversed();
+                    for (std::size_t i = 0; i < size; ++i) {
+                        a[i] = a[i] * sconst;
                     }
+                }
+
+                void coset_fft(std::vector<value_type> &a, const field_value_type &g) override {
+                    prepare_fft(a);
+                    detail::basic_radix2_coset_fft_cached<FieldType>(a, fft_cache->first, g);
+                }
+
+                void inverse_coset_fft(std::vector<value_type> &a, const field_value_type &g) override {
+                    prepare_fft(a);
                     detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->second);
 
-                    const field_value_type sconst = field_value_type(a.size()).inversed();
+                    // the scaling by 1/N and the shift by g^{-1} share one pass
+                    const field_value_type g_inv = g.inversed();
+                    field_value_type u = field_value_type(a.size()).inversed();
                     for (std::size_t i = 0; i < a.size(); ++i) {
-                        a[i] = a[i] * sconst;
+                        a[i] = a[i] * u;
+                        u *= g_inv;
                     }
                 }
 
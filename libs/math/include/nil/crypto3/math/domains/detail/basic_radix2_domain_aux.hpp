@@ -57,14 +57,39 @@ namespace nil {
                     }
                 }
 
+                /*
+                 * Butterflies of the iterative radix-2 FFT, a must already be in bit-reversed order.
+                 */
+                template<typename Range, typename FieldValueType>
+                void basic_radix2_butterflies(Range &a, const std::vector<FieldValueType> &omega_cache,
+                                              const std::size_t logn) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    const std::size_t n = a.size();
+
+                    // invariant: m = 2^{s-1}
+                    value_type t;
+                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
+                        // w_m is 2^s-th root of unity now
+                        for (std::size_t k = 0; k < n; k += 2 * m) {
+                            for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
+                                t = a[k + j + m];
+                                t *= omega_cache[idx];
+                                a[k + j + m] = a[k + j];
+                                a[k + j + m] -= t;
+                                a[k + j] += t;
+                            }
+                        }
+                    }
+                }
+
                 /*
                  * Below we make use of pseudocode from [CLRS 2n Ed, pp. 864].
                  * Also, note that it's the caller's responsibility to multiply by 1/N.
                  */
                 template<typename FieldType, typename Range>
                 void basic_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
-                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
-                        value_type;
                     BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
 
                     // It now supports curve elements too, should probably some other assertion about the field type and value type
@@ -81,20 +106,33 @@ namespace nil {
                             std::swap(a[k], a[rk]);
                     }
 
-                    // invariant: m = 2^{s-1}
-                    value_type t;
-                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
-                        // w_m is 2^s-th root of unity now
-                        for (std::size_t k = 0; k < n; k += 2 * m) {
-                            for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
-                                t = a[k + j + m];
-                                t *= omega_cache[idx];
-                                a[k + j + m] = a[k + j];
-                                a[k + j + m] -= t;
-                                a[k + j] += t;
-                            }
-                        }
+                    basic_radix2_butterflies(a, omega_cache, logn);
+                }
+
+                /*
+                 * Same as basic_radix2_fft_cached for the vector (a_0, g * a_1, ..., g^{n-1} * a_{n-1}), the coset
+                 * shift is applied during the bit-reversal pass instead of a separate pass over a.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_coset_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache,
+                                                   const typename FieldType::value_type &g) {
+                    typedef typename FieldType::value_type field_value_type;
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+
+                    field_value_type u = field_value_type::one();
+                    for (std::size_t k = 0; k < n; ++k, u *= g) {
+                        const std::size_t rk = bitreverse(k, logn);
+                        // a_k is still at position k unless it was swapped to rk on iteration rk < k
+                        a[k <= rk ? k : rk] *= u;
+                        if (k < rk)
+                            std::swap(a[k], a[rk]);
                     }
+
+                    basic_radix2_butterflies(a, omega_cache, logn);
                 }
 
                 /**
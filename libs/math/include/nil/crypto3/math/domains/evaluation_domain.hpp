@@ -26,9 +26,12 @@
 #ifndef CRYPTO3_MATH_EVALUATION_DOMAIN_HPP
 #define CRYPTO3_MATH_EVALUATION_DOMAIN_HPP
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/multiprecision/integer.hpp>
+#include <nil/crypto3/math/coset.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
 namespace nil {
@@ -86,6 +89,49 @@ namespace nil {
                  */
                 virtual void inverse_fft(std::vector<value_type> &a) = 0;
 
+                /**
+                 * Build the tables which fft() and inverse_fft() otherwise create on first use, so that the
+                 * domain can be shared between threads afterwards. Does nothing for domains without such tables.
+                 */
+                virtual void prepare_fft_cache() {
+                }
+
+                /**
+                 * Compute the FFT, over the domain S, of the size values starting at a, for storage which is not a
+                 * std::vector. The storage is not resized, so size must be equal to m.
+                 */
+                virtual void fft(value_type *a, std::size_t size) {
+                    std::vector<value_type> tmp(a, a + check_size(size));
+                    fft(tmp);
+                    std::copy(tmp.begin(), tmp.end(), a);
+                }
+
+                /**
+                 * Compute the inverse FFT, over the domain S, of the size values starting at a, for storage which is
+                 * not a std::vector. The storage is not resized, so size must be equal to m.
+                 */
+                virtual void inverse_fft(value_type *a, std::size_t size) {
+                    std::vector<value_type> tmp(a, a + check_size(size));
+                    inverse_fft(tmp);
+                    std::copy(tmp.begin(), tmp.end(), a);
+                }
+
+                /**
+                 * Compute the FFT, over the coset g * S, of the vector a.
+                 */
+                virtual void coset_fft(std::vector<value_type> &a, const field_value_type &g) {
+                    multiply_by_coset(a, g);
+                    fft(a);
+                }
+
+                /**
+                 * Compute the inverse FFT, over the coset g * S, of the vector a.
+                 */
+                virtual void inverse_coset_fft(std::vector<value_type> &a, const field_value_type &g) {
+                    inverse_fft(a);
+                    multiply_by_coset(a, g.inversed());
+                }
+
                 /**
                  * Evaluate all Lagrange polynomials.
                  *
@@ -133,6 +179,14 @@ namespace nil {
                 bool operator==(const evaluation_domain &rhs) const {
                     return m == rhs.m && log2_size == rhs.log2_size;
                 }
+
+            protected:
+                std::size_t check_size(std::size_t size) const {
+                    if (size != m) {
+                        throw std::invalid_argument("evaluation_domain: expected size == m");
+                    }
+                    return size;
+                }
             };
         }    // namespace math
     }        // namespace crypto3
@@ -80,6 +80,12 @@ namespace nil {
                     }
                 }
 
+                void prepare_fft_cache() override {
+                    if (fft_cache == nullptr) {
+                        create_fft_cache();
+                    }
+                }
+
                 void fft(std::vector<value_type> &a) override {
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
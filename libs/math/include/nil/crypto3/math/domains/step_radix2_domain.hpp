@@ -84,6 +84,12 @@ namespace nil {
                         throw std::invalid_argument("step_radix2(): expected small_m == 1ul<<log2(small_m)");
                 }
 
+                void prepare_fft_cache() override {
+                    if (small_fft_cache == nullptr) {
+                        create_fft_cache();
+                    }
+                }
+
                 void fft(std::vector<value_type> &a) override {
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
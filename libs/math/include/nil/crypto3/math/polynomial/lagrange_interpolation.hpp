@@ -28,14 +28,18 @@
 #define CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/subproduct_tree.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
-            // Default implementation according to Wikipedia
-            // https://en.wikipedia.org/wiki/Lagrange_polynomial
+            /**
+             * Returns the polynomial of degree < k through the k given (x, y) pairs.
+             * Goes through subproduct_tree, which is quadratic for a few points and O(k log^2 k) for many.
+             * The x coordinates must be pairwise distinct.
+             */
             template<typename InputRange,
                     typename FieldValueType =
                     typename std::iterator_traits<typename InputRange::iterator>::value_type::first_type>
@@ -45,20 +49,15 @@ namespace nil {
                     polynomial<FieldValueType>>::type
             lagrange_interpolation(const InputRange &points) {
 
-                std::size_t k = std::size(points);
-
-                polynomial<FieldValueType> result;
-                for (std::size_t j = 0; j < k; ++j) {
-                    polynomial<FieldValueType> term({points[j].second});
-                    for (std::size_t m = 0; m < k; ++m) {
-                        if (m != j) {
-                            term = term * (polynomial<FieldValueType>({-points[m].first, FieldValueType::one()}) *
-                                           (points[j].first - points[m].first).inversed());
-                        }
-                    }
-                    result = result + term;
+                std::vector<FieldValueType> xs, ys;
+                xs.reserve(std::size(points));
+                ys.reserve(std::size(points));
+                for (const auto &point : points) {
+                    xs.push_back(point.first);
+                    ys.push_back(point.second);
                 }
-                return result;
+
+                return fast_interpolation(xs, ys);
             }
         }    // namespace math
     }        // namespace crypto3
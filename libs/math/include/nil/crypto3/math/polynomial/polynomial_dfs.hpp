@@ -39,6 +39,7 @@
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/parallelization/parallel_for.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -137,7 +138,7 @@ namespace nil {
                                      "DFS optimal polynomial size must be a power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynomial size must be a power of two");
                 }
@@ -162,7 +163,7 @@ namespace nil {
                 }
 
                 allocator_type get_allocator() const BOOST_NOEXCEPT {
-                    return this->val.__alloc();
+                    return this->val.get_allocator();
                 }
 
                 container_type& get_storage() {
@@ -350,14 +351,12 @@ namespace nil {
                         } else {
                             BOOST_ASSERT_MSG(old_domain->size() == this->size(), "Old domain size is not equal to the polynomial size");
                         }
-                        old_domain->inverse_fft(this->val);
-                        this->val.resize(_sz, FieldValueType::zero());
                         if (new_domain == nullptr) {
                             new_domain = make_evaluation_domain<FieldType>(_sz);
                         } else {
                             BOOST_ASSERT_MSG(new_domain->size() == _sz, "New domain size is not equal to the polynomial size");
                         }
-                        new_domain->fft(this->val);
+                        change_domain(this->val, _sz, *old_domain, *new_domain);
                     }
                 }
 
@@ -430,13 +429,14 @@ namespace nil {
                  * Computes the standard polynomial addition, polynomial A + polynomial B,
                  * and stores result in polynomial A.
                  */
-                polynomial_dfs& operator+=(const polynomial_dfs& other) {
+                template<typename OtherAllocator>
+                polynomial_dfs& operator+=(const polynomial_dfs<FieldValueType, OtherAllocator>& other) {
                     if (other.size() > this->size()) {
                         this->resize(other.size());
                     }
-                    this->_d = std::max(this->_d, other._d);
+                    this->_d = std::max(this->_d, other.degree());
                     if (this->size() > other.size()) {
-                        polynomial_dfs tmp(other);
+                        polynomial_dfs<FieldValueType, OtherAllocator> tmp(other);
                         tmp.resize(this->size());
 
                         std::transform(tmp.begin(), tmp.end(), this->begin(), this->begin(), std::plus<FieldValueType>());
@@ -658,13 +658,32 @@ namespace nil {
                     return result;
                 }
 
+            private:
+                template<typename FieldType>
+                static void change_domain(std::vector<FieldValueType>& values, size_type new_size,
+                                          evaluation_domain<FieldType>& old_domain,
+                                          evaluation_domain<FieldType>& new_domain) {
+                    old_domain.inverse_fft(values);
+                    values.resize(new_size, FieldValueType::zero());
+                    new_domain.fft(values);
+                }
+
+                // Storage with another allocator is transformed in place through its contiguous data.
+                template<typename FieldType, typename OtherContainerType>
+                static void change_domain(OtherContainerType& values, size_type new_size,
+                                          evaluation_domain<FieldType>& old_domain,
+                                          evaluation_domain<FieldType>& new_domain) {
+                    old_domain.inverse_fft(values.data(), values.size());
+                    values.resize(new_size, FieldValueType::zero());
+                    new_domain.fft(values.data(), values.size());
+                }
             };
 
             template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>,
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator+(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it += B;
                 }
@@ -675,7 +694,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator+(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
-                polynomial_dfs<FieldValueType> result(B);
+                polynomial_dfs<FieldValueType, Allocator> result(B);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it += A;
                 }
@@ -687,7 +706,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator-(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it -=  B;
                 }
@@ -698,7 +717,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator-(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
-                polynomial_dfs<FieldValueType> result(B);
+                polynomial_dfs<FieldValueType, Allocator> result(B);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it = A - *it;
                 }
@@ -709,7 +728,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator*(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it *= B;
                 }
@@ -728,7 +747,7 @@ namespace nil {
                      typename = typename std::enable_if<detail::is_field_element<FieldValueType>::value>::type>
             polynomial_dfs<FieldValueType, Allocator> operator/(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
-                polynomial_dfs<FieldValueType> result(A);
+                polynomial_dfs<FieldValueType, Allocator> result(A);
                 FieldValueType B_inversed = B.inversed();
                 for( auto it = result.begin(); it != result.end(); it++ ){
                     *it *= B_inversed;
@@ -741,7 +760,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator/(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
 
-                return polynomial_dfs<FieldValueType>(0, B.size(), A) / B;
+                return polynomial_dfs<FieldValueType, Allocator>(0, B.size(), A, B.get_allocator()) / B;
             }
 
             // Used in the unit tests, so we can use BOOST_CHECK_EQUALS, and see
@@ -768,12 +787,12 @@ namespace nil {
                 return os;
             }
 
-            template<typename FieldType>
-            static inline polynomial_dfs<typename FieldType::value_type> polynomial_sum(
-                    std::vector<math::polynomial_dfs<typename FieldType::value_type>> addends) {
+            template<typename FieldType, typename Allocator = std::allocator<typename FieldType::value_type>>
+            static inline polynomial_dfs<typename FieldType::value_type, Allocator> polynomial_sum(
+                    std::vector<math::polynomial_dfs<typename FieldType::value_type, Allocator>> addends) {
                 using FieldValueType = typename FieldType::value_type;
                 std::size_t max_size = 0;
-                std::unordered_map<std::size_t, polynomial_dfs<FieldValueType>> size_to_part_sum;
+                std::unordered_map<std::size_t, polynomial_dfs<FieldValueType, Allocator>> size_to_part_sum;
                 for (auto& addend : addends) {
                     max_size = std::max(max_size, addend.size());
                     auto it = size_to_part_sum.find(addend.size());
@@ -782,7 +801,7 @@ namespace nil {
                     } else {
                         it->second += addend;
                         // Free the memory we are not going to use anymore.
-                        addend = math::polynomial_dfs<FieldValueType>();
+                        addend = math::polynomial_dfs<FieldValueType, Allocator>();
                     }
                 }
 
@@ -791,18 +810,17 @@ namespace nil {
                     coef_result += polynomial<FieldValueType>(std::move(partial_sum.coefficients()));
                 }
 
-                polynomial_dfs<FieldValueType> dfs_result;
+                polynomial_dfs<FieldValueType, Allocator> dfs_result;
                 dfs_result.from_coefficients(coef_result.get_storage());
 
                 return dfs_result;
             }
 
-            template<typename FieldType>
-            static inline polynomial_dfs<typename FieldType::value_type> polynomial_product(
-                    std::vector<math::polynomial_dfs<typename FieldType::value_type>> multipliers) {
-                // Pre-create all the domains. We could do this on-the-go, but we want this function to be more
-                // parallelization-friendly. This single-threaded version may look a bit complicated,
-                // but it's now very similar to what we have in parallel code.
+            template<typename FieldType, typename Allocator = std::allocator<typename FieldType::value_type>>
+            static inline polynomial_dfs<typename FieldType::value_type, Allocator> polynomial_product(
+                    std::vector<math::polynomial_dfs<typename FieldType::value_type, Allocator>> multipliers) {
+                // Pre-create all the domains, so that the multiplications below only read the cache
+                // and can run in parallel.
                 std::unordered_map<std::size_t, std::shared_ptr<evaluation_domain<FieldType>>> domain_cache;
 
                 std::size_t min_domain_size = std::numeric_limits<std::size_t>::max();
@@ -818,24 +836,29 @@ namespace nil {
                 std::vector<std::size_t> needed_domain_sizes;
                 for (std::size_t i = min_domain_size; i <= max_domain_size; i *= 2) {
                     needed_domain_sizes.push_back(i);
-                    // On the next line I want to create the tree structure, then create the evaluation domains.
-                    // This way filling of this structure can be done in parallel.
+                    // Create the map structure first, the domains are filled in parallel.
                     domain_cache[i] = nullptr;
                 }
 
-                // This loop will run in parallel.
-                for (const auto& domain_size: needed_domain_sizes) {
-                    domain_cache[domain_size] = make_evaluation_domain<FieldType>(domain_size);
-                }
+                parallelization::parallel_for(0, needed_domain_sizes.size(), [&](std::size_t i) {
+                    const std::size_t domain_size = needed_domain_sizes[i];
+                    std::shared_ptr<evaluation_domain<FieldType>> domain =
+                        make_evaluation_domain<FieldType>(domain_size);
+
+                    // Domains build their FFT caches on first use. Do it here, before they are shared
+                    // between the threads of the loop below.
+                    domain->prepare_fft_cache();
+
+                    domain_cache.at(domain_size) = std::move(domain);
+                });
 
                 for (std::size_t stride = 1; stride < multipliers.size(); stride <<= 1) {
                     const std::size_t double_stride = stride << 1;
-                    // This loop will run in parallel.
                     std::size_t max_i = (multipliers.size() - stride) / double_stride;
                     if ((multipliers.size() - stride) % double_stride != 0)
                         max_i++;
 
-                    for(std::size_t i = 0; i < max_i; i++) {
+                    parallelization::parallel_for(0, max_i, [&](std::size_t i) {
                         std::size_t index1 = i * double_stride;
                         std::size_t index2 = index1 + stride;
 
@@ -849,13 +872,13 @@ namespace nil {
 
                         multipliers[index1].cached_multiplication(
                             multipliers[index2],
-                            domain_cache[current_domain_size],
-                            domain_cache[next_domain_size],
-                            domain_cache[new_domain_size]);
+                            domain_cache.at(current_domain_size),
+                            domain_cache.at(next_domain_size),
+                            domain_cache.at(new_domain_size));
 
                         // Free the memory we are not going to use anymore.
-                        multipliers[index2] = polynomial_dfs<typename FieldType::value_type>();
-                    }
+                        multipliers[index2] = polynomial_dfs<typename FieldType::value_type, Allocator>();
+                    });
                 }
                 return multipliers[0];
             }
@@ -46,11 +46,16 @@ namespace nil {
                 return f_shifted;
             }
 
-            template<typename FieldValueType>
-            static inline polynomial_dfs<FieldValueType>
-            polynomial_shift(const polynomial_dfs<FieldValueType> &f,
+            /**
+             * Writes the values of f rotated by shift rows of a domain of domain_size points to out. f may be
+             * given over an extension of that domain, then one row spans several of its points.
+             */
+            template<typename FieldValueType, typename Allocator, typename OutputIterator>
+            static inline OutputIterator
+            polynomial_shift(const polynomial_dfs<FieldValueType, Allocator> &f,
                              const int shift,
-                             std::size_t domain_size = 0) {
+                             std::size_t domain_size,
+                             OutputIterator out) {
                 if (domain_size == 0) {
                     domain_size = f.size();
                 }
@@ -61,13 +66,21 @@ namespace nil {
 
                 const std::size_t domain_scale = extended_domain_size / domain_size;
 
-                polynomial_dfs<FieldValueType> f_shifted(f.degree(), extended_domain_size);
-
                 for (std::size_t index = 0; index < extended_domain_size; index++) {
-                    f_shifted[index] = f[(extended_domain_size + index + domain_scale * shift) %
-                                         (extended_domain_size)];
+                    *out++ = f[(extended_domain_size + index + domain_scale * shift) %
+                               (extended_domain_size)];
                 }
 
+                return out;
+            }
+
+            template<typename FieldValueType>
+            static inline polynomial_dfs<FieldValueType>
+            polynomial_shift(const polynomial_dfs<FieldValueType> &f,
+                             const int shift,
+                             std::size_t domain_size = 0) {
+                polynomial_dfs<FieldValueType> f_shifted(f.degree(), f.size());
+                polynomial_shift(f, shift, domain_size, f_shifted.begin());
                 return f_shifted;
             }
         }    // namespace math
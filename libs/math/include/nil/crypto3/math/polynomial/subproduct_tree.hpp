@@ -0,0 +1,336 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_SUBPRODUCT_TREE_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_SUBPRODUCT_TREE_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/algebra/algorithms/batch_inverse.hpp>
+#include <nil/crypto3/algebra/fields/params.hpp>
+
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                // Below this many coefficients schoolbook products and divisions beat the FFT based ones
+                constexpr static const std::size_t subproduct_tree_naive_threshold = 32;
+
+                /**
+                 * Two-adicity of FieldType for FFT products: arithmetic_params<FieldType>::s if the field has
+                 * an arithmetic_params specialization with a root of unity, 0 otherwise.
+                 */
+                template<typename FieldType, typename = void>
+                struct subproduct_tree_fft_log_size : std::integral_constant<std::size_t, 0> { };
+
+                template<typename FieldType>
+                struct subproduct_tree_fft_log_size<
+                    FieldType,
+                    decltype(void(algebra::fields::arithmetic_params<FieldType>::s),
+                             void(algebra::fields::arithmetic_params<FieldType>::root_of_unity))>
+                    : std::integral_constant<std::size_t, algebra::fields::arithmetic_params<FieldType>::s> { };
+
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_tree_naive_multiply(const std::vector<FieldValueType> &a,
+                                                                           const std::vector<FieldValueType> &b) {
+                    std::vector<FieldValueType> c(a.size() + b.size() - 1, FieldValueType::zero());
+                    for (std::size_t i = 0; i < a.size(); ++i) {
+                        for (std::size_t j = 0; j < b.size(); ++j) {
+                            c[i + j] += a[i] * b[j];
+                        }
+                    }
+                    return c;
+                }
+
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_tree_fft_multiply(const std::vector<FieldValueType> &a,
+                                                                         const std::vector<FieldValueType> &b,
+                                                                         std::true_type) {
+                    std::vector<FieldValueType> c;
+                    multiplication(c, a, b);
+                    c.resize(a.size() + b.size() - 1, FieldValueType::zero());
+                    return c;
+                }
+
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_tree_fft_multiply(const std::vector<FieldValueType> &a,
+                                                                         const std::vector<FieldValueType> &b,
+                                                                         std::false_type) {
+                    return subproduct_tree_naive_multiply(a, b);
+                }
+
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_tree_multiply(const std::vector<FieldValueType> &a,
+                                                                     const std::vector<FieldValueType> &b) {
+                    constexpr std::size_t fft_log_size =
+                        subproduct_tree_fft_log_size<typename FieldValueType::field_type>::value;
+
+                    if (std::min(a.size(), b.size()) <= subproduct_tree_naive_threshold ||
+                        a.size() + b.size() - 1 > (std::size_t(1) << std::min<std::size_t>(fft_log_size, 62))) {
+                        return subproduct_tree_naive_multiply(a, b);
+                    }
+                    return subproduct_tree_fft_multiply(a, b, std::integral_constant<bool, (fft_log_size > 0)>());
+                }
+
+                /**
+                 * Returns g with f * g = 1 mod x^precision by Newton iteration, g <- g * (2 - f * g),
+                 * which doubles the precision of g at each step. Requires f[0] = 1.
+                 */
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_tree_inverse_series(const std::vector<FieldValueType> &f,
+                                                                           std::size_t precision) {
+                    std::vector<FieldValueType> g = {FieldValueType::one()};
+                    for (std::size_t current = 1; current < precision;) {
+                        current = std::min(2 * current, precision);
+
+                        std::vector<FieldValueType> f_low(f.begin(), f.begin() + std::min(f.size(), current));
+                        std::vector<FieldValueType> e = subproduct_tree_multiply(f_low, g);
+                        e.resize(current, FieldValueType::zero());
+                        for (FieldValueType &coefficient : e) {
+                            coefficient = -coefficient;
+                        }
+                        e[0] += FieldValueType(2u);
+
+                        g = subproduct_tree_multiply(g, e);
+                        g.resize(current, FieldValueType::zero());
+                    }
+                    return g;
+                }
+
+                /**
+                 * Returns a mod b for a monic b. Long quotients by long divisors go through the reversed
+                 * polynomials: rev(q) = rev(a) / rev(b) mod x^(deg a - deg b + 1), which costs a few products.
+                 */
+                template<typename FieldValueType>
+                std::vector<FieldValueType> subproduct_tree_remainder(std::vector<FieldValueType> a,
+                                                                      const std::vector<FieldValueType> &b) {
+                    const std::size_t divisor_degree = b.size() - 1;
+                    if (a.size() <= divisor_degree) {
+                        return a;
+                    }
+                    const std::size_t quotient_size = a.size() - divisor_degree;
+
+                    if (std::min(quotient_size, divisor_degree) <= subproduct_tree_naive_threshold) {
+                        for (std::size_t i = a.size(); i-- > divisor_degree;) {
+                            const FieldValueType lead = a[i];
+                            if (lead.is_zero()) {
+                                continue;
+                            }
+                            for (std::size_t j = 0; j < divisor_degree; ++j) {
+                                a[i - divisor_degree + j] -= lead * b[j];
+                            }
+                        }
+                        a.resize(std::max<std::size_t>(divisor_degree, 1), FieldValueType::zero());
+                        return a;
+                    }
+
+                    std::vector<FieldValueType> reversed_a(a.rbegin(), a.rbegin() + quotient_size);
+                    std::vector<FieldValueType> reversed_b(b.rbegin(), b.rend());
+                    std::vector<FieldValueType> q = subproduct_tree_multiply(
+                        reversed_a, subproduct_tree_inverse_series(reversed_b, quotient_size));
+                    q.resize(quotient_size, FieldValueType::zero());
+                    std::reverse(q.begin(), q.end());
+
+                    const std::vector<FieldValueType> qb = subproduct_tree_multiply(q, b);
+                    a.resize(divisor_degree);
+                    for (std::size_t i = 0; i < divisor_degree; ++i) {
+                        a[i] -= qb[i];
+                    }
+                    return a;
+                }
+            }    // namespace detail
+
+            /**
+             * @brief Products of (x - x_i) over a balanced binary tree on the points x_0, ..., x_{n-1}.
+             *
+             * Node j of level l is the product over the points [j * 2^l, (j + 1) * 2^l), the root is the
+             * vanishing polynomial of all points. Built once, the tree gives multipoint evaluation by a
+             * remainder tree and interpolation by a linear combination up the tree, both in O(n log^2 n)
+             * with FFT products. Small nodes fall back to schoolbook arithmetic, so the tree is also
+             * the quadratic naive algorithm for small n.
+             */
+            template<typename FieldValueType>
+            class subproduct_tree {
+                typedef std::vector<FieldValueType> coefficients_type;
+
+            public:
+                typedef polynomial<FieldValueType> polynomial_type;
+
+                explicit subproduct_tree(const std::vector<FieldValueType> &points) : _points(points) {
+                    if (_points.empty()) {
+                        throw std::invalid_argument("subproduct_tree: expected at least one point");
+                    }
+
+                    std::vector<coefficients_type> level;
+                    level.reserve(_points.size());
+                    for (const FieldValueType &point : _points) {
+                        level.push_back({-point, FieldValueType::one()});
+                    }
+                    _levels.push_back(std::move(level));
+
+                    while (_levels.back().size() > 1) {
+                        const std::vector<coefficients_type> &children = _levels.back();
+                        std::vector<coefficients_type> parents((children.size() + 1) / 2);
+                        for (std::size_t j = 0; j < parents.size(); ++j) {
+                            parents[j] = 2 * j + 1 < children.size() ?
+                                             detail::subproduct_tree_multiply(children[2 * j], children[2 * j + 1]) :
+                                             children[2 * j];
+                        }
+                        _levels.push_back(std::move(parents));
+                    }
+                }
+
+                const std::vector<FieldValueType> &points() const {
+                    return _points;
+                }
+
+                polynomial_type vanishing_polynomial() const {
+                    return polynomial_type(_levels.back()[0]);
+                }
+
+                /** @brief Returns f(x_0), ..., f(x_{n-1}). */
+                std::vector<FieldValueType> evaluate(const polynomial_type &f) const {
+                    std::vector<FieldValueType> result(_points.size());
+                    evaluate_node(_levels.size() - 1, 0,
+                                  detail::subproduct_tree_remainder(coefficients_type(f.begin(), f.end()),
+                                                                    _levels.back()[0]),
+                                  result);
+                    return result;
+                }
+
+                /**
+                 * @brief Returns the polynomial of degree < n taking values[i] at x_i.
+                 *
+                 * With m the vanishing polynomial, the result is the sum of values[i] / m'(x_i) * m / (x - x_i).
+                 * Throws std::invalid_argument if the points are not pairwise distinct.
+                 */
+                polynomial_type interpolate(const std::vector<FieldValueType> &values) const {
+                    if (values.size() != _points.size()) {
+                        throw std::invalid_argument("subproduct_tree: expected one value per point");
+                    }
+
+                    const coefficients_type &vanishing = _levels.back()[0];
+                    coefficients_type derivative(vanishing.size() - 1);
+                    for (std::size_t i = 1; i < vanishing.size(); ++i) {
+                        derivative[i - 1] = vanishing[i] * FieldValueType(i);
+                    }
+
+                    std::vector<FieldValueType> weights = evaluate(polynomial_type(derivative));
+                    if (std::any_of(weights.begin(), weights.end(),
+                                    [](const FieldValueType &weight) { return weight.is_zero(); })) {
+                        throw std::invalid_argument("subproduct_tree: interpolation points must be distinct");
+                    }
+                    algebra::batch_inverse(weights);
+
+                    std::vector<coefficients_type> level(_points.size());
+                    for (std::size_t i = 0; i < _points.size(); ++i) {
+                        level[i] = {values[i] * weights[i]};
+                    }
+
+                    for (std::size_t l = 0; l + 1 < _levels.size(); ++l) {
+                        const std::vector<coefficients_type> &nodes = _levels[l];
+                        std::vector<coefficients_type> parents((level.size() + 1) / 2);
+                        for (std::size_t j = 0; j < parents.size(); ++j) {
+                            if (2 * j + 1 == level.size()) {
+                                parents[j] = std::move(level[2 * j]);
+                                continue;
+                            }
+                            coefficients_type left = detail::subproduct_tree_multiply(level[2 * j], nodes[2 * j + 1]);
+                            const coefficients_type right =
+                                detail::subproduct_tree_multiply(level[2 * j + 1], nodes[2 * j]);
+                            left.resize(std::max(left.size(), right.size()), FieldValueType::zero());
+                            for (std::size_t i = 0; i < right.size(); ++i) {
+                                left[i] += right[i];
+                            }
+                            parents[j] = std::move(left);
+                        }
+                        level = std::move(parents);
+                    }
+
+                    polynomial_type result(level[0]);
+                    condense(result);
+                    return result;
+                }
+
+            private:
+                void evaluate_node(std::size_t l, std::size_t j, coefficients_type remainder,
+                                   std::vector<FieldValueType> &result) const {
+                    const std::size_t begin = j << l;
+                    const std::size_t end = std::min(_points.size(), (j + 1) << l);
+
+                    if (end - begin <= detail::subproduct_tree_naive_threshold) {
+                        const polynomial_type r(std::move(remainder));
+                        for (std::size_t i = begin; i < end; ++i) {
+                            result[i] = r.evaluate(_points[i]);
+                        }
+                        return;
+                    }
+
+                    const std::vector<coefficients_type> &children = _levels[l - 1];
+                    if (2 * j + 1 == children.size()) {
+                        evaluate_node(l - 1, 2 * j, std::move(remainder), result);
+                        return;
+                    }
+                    evaluate_node(l - 1, 2 * j, detail::subproduct_tree_remainder(remainder, children[2 * j]),
+                                  result);
+                    evaluate_node(l - 1, 2 * j + 1,
+                                  detail::subproduct_tree_remainder(std::move(remainder), children[2 * j + 1]),
+                                  result);
+                }
+
+                std::vector<FieldValueType> _points;
+                // _levels[0] are the leaves x - x_i, _levels.back() holds the root only
+                std::vector<std::vector<coefficients_type>> _levels;
+            };
+
+            /** @brief Evaluates f at every point, see subproduct_tree. */
+            template<typename FieldValueType>
+            std::vector<FieldValueType> multipoint_evaluation(const polynomial<FieldValueType> &f,
+                                                              const std::vector<FieldValueType> &points) {
+                if (points.empty()) {
+                    return {};
+                }
+                return subproduct_tree<FieldValueType>(points).evaluate(f);
+            }
+
+            /** @brief Returns the polynomial of degree < n through (points[i], values[i]), see subproduct_tree. */
+            template<typename FieldValueType>
+            polynomial<FieldValueType> fast_interpolation(const std::vector<FieldValueType> &points,
+                                                          const std::vector<FieldValueType> &values) {
+                if (points.empty()) {
+                    return polynomial<FieldValueType>();
+                }
+                return subproduct_tree<FieldValueType>(points).interpolate(values);
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_SUBPRODUCT_TREE_HPP
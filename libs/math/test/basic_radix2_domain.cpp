@@ -34,6 +34,7 @@
 
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/coset.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
@@ -149,4 +150,28 @@ BOOST_AUTO_TEST_CASE(fft_vs_multiplication_benchmark) {
              << " ms" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(coset_fft_test) {
+    using value_type = FieldType::value_type;
+    const std::size_t fft_size = 1 << 10;
+
+    std::vector<value_type> coefficients(fft_size);
+    for (std::size_t i = 0; i < fft_size; ++i) {
+        coefficients[i] = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    const value_type g = value_type(fields::arithmetic_params<FieldType>::multiplicative_generator);
+
+    std::shared_ptr<evaluation_domain<FieldType>> domain = make_evaluation_domain<FieldType>(fft_size);
+
+    std::vector<value_type> expected(coefficients);
+    multiply_by_coset(expected, g);
+    domain->fft(expected);
+
+    std::vector<value_type> evaluations(coefficients);
+    domain->coset_fft(evaluations, g);
+    BOOST_CHECK(evaluations == expected);
+
+    domain->inverse_coset_fft(evaluations, g);
+    BOOST_CHECK(evaluations == coefficients);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -44,8 +44,16 @@
 
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/memory/arena_allocator.hpp>
 #include <nil/crypto3/random/algebraic_engine.hpp>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <cstdlib>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 
 // Benchmark test cases integrated to Boost.Test framework, check the examples below
 struct test_case_base {
@@ -144,6 +152,74 @@ struct F {
     std::mt19937 rnd_engine;
 };
 
+// Mimics the gate argument evaluation: every term copies a column value, multiplies it by another one
+// and adds it to the result, so that polynomials of the same size are allocated and freed all the time.
+// The columns have full degree, so every product is resized to the doubled domain first.
+template<typename Allocator, typename FieldValueType>
+polynomial_dfs<FieldValueType, Allocator> evaluate_pairwise_products(
+        const std::vector<polynomial_dfs<FieldValueType>>& columns) {
+    typedef typename FieldValueType::field_type FieldType;
+
+    const std::size_t size = columns[0].size();
+    const std::size_t extended_size = 2 * size;
+    auto domain = make_evaluation_domain<FieldType>(size);
+    auto extended_domain = make_evaluation_domain<FieldType>(extended_size);
+
+    std::vector<polynomial_dfs<FieldValueType, Allocator>> values;
+    for (const auto& column : columns) {
+        values.emplace_back(column.degree(), column.begin(), column.end());
+    }
+
+    polynomial_dfs<FieldValueType, Allocator> result(0, extended_size, FieldValueType::zero());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        for (std::size_t j = i; j < values.size(); ++j) {
+            polynomial_dfs<FieldValueType, Allocator> term = values[i];
+            term.cached_multiplication(values[j], domain, domain, extended_domain);
+            result += term;
+        }
+    }
+    return result;
+}
+
+std::vector<polynomial_dfs<typename F::FieldType::value_type>> generate_columns(
+        nil::crypto3::random::algebraic_engine<F::FieldType>& engine) {
+    std::vector<polynomial_dfs<typename F::FieldType::value_type>> columns;
+    for (std::size_t i = 0; i < 8; ++i) {
+        columns.emplace_back(generate_random_polynomial<F::FieldType>(1u << 16, engine));
+    }
+    return columns;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// Peak RSS is a per process value, so every allocator is measured in a process of its own.
+template<typename Workload>
+void report_peak_rss(const std::string& name, Workload workload) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+        workload();
+        std::_Exit(0);
+    }
+    int status = 0;
+    struct rusage usage;
+    if (pid > 0 && wait4(pid, &status, 0, &usage) == pid) {
+        std::cout << "Peak RSS with " << name << ": " << usage.ru_maxrss << " (KB, bytes on macOS)\n";
+    }
+}
+#endif
+
+struct arena_fixture : public F {
+    ~arena_fixture() {
+        const nil::crypto3::memory::arena_statistics stats = arena.statistics();
+        std::cout << "Arena: " << stats.bytes_allocated / (1024 * 1024) << " MB allocated, "
+                  << stats.peak_bytes_in_use / (1024 * 1024) << " MB peak in use, "
+                  << stats.allocations << " allocations, reuse rate "
+                  << std::setprecision(3) << stats.reuse_rate() << "\n";
+    }
+
+    // Shared by all iterations, like the arena of a prover serving proof after proof
+    nil::crypto3::memory::memory_arena arena;
+};
+
 BOOST_FIXTURE_TEST_SUITE(polynomial_dfs_benchmark_test_suite, F)
 
 BENCHMARK_AUTO_TEST_CASE(dummy_test, 100) {
@@ -212,4 +288,45 @@ BENCHMARK_AUTO_TEST_CASE(polynomial_sum_real_test, 20) {
     BOOST_CHECK_EQUAL(naive_res, res);
 }
 
+BENCHMARK_AUTO_TEST_CASE(polynomial_dfs_std_allocator_test, 10) {
+    using value_type = typename FieldType::value_type;
+
+    const auto columns = generate_columns(alg_rnd_engine);
+
+    START_TIMER("std_allocator")
+    evaluate_pairwise_products<std::allocator<value_type>>(columns);
+    STOP_TIMER("std_allocator")
+}
+
+BENCHMARK_FIXTURE_TEST_CASE(polynomial_dfs_arena_allocator_test, 10, arena_fixture) {
+    using value_type = typename FieldType::value_type;
+
+    const auto columns = generate_columns(alg_rnd_engine);
+
+    nil::crypto3::memory::scoped_memory_arena scope(arena);
+    START_TIMER("arena_allocator")
+    const auto arena_result = evaluate_pairwise_products<nil::crypto3::memory::arena_allocator<value_type>>(columns);
+    STOP_TIMER("arena_allocator")
+
+    const auto std_result = evaluate_pairwise_products<std::allocator<value_type>>(columns);
+    BOOST_CHECK(std::equal(std_result.begin(), std_result.end(), arena_result.begin(), arena_result.end()));
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+BOOST_AUTO_TEST_CASE(polynomial_dfs_allocators_peak_rss_test) {
+    using value_type = typename FieldType::value_type;
+
+    report_peak_rss("std::allocator", [this]() {
+        const auto columns = generate_columns(alg_rnd_engine);
+        evaluate_pairwise_products<std::allocator<value_type>>(columns);
+    });
+    report_peak_rss("memory::arena_allocator", [this]() {
+        nil::crypto3::memory::memory_arena arena;
+        nil::crypto3::memory::scoped_memory_arena scope(arena);
+        const auto columns = generate_columns(alg_rnd_engine);
+        evaluate_pairwise_products<nil::crypto3::memory::arena_allocator<value_type>>(columns);
+    });
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -154,6 +154,30 @@ void test_inverse_fft_of_fft() {
     }
 }
 
+template<typename FieldType>
+void test_prepare_fft_cache(std::size_t m) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<value_type> f(m);
+    for (std::size_t i = 0; i < m; i++) {
+        f[i] = value_type(2 * i + 1);
+    }
+
+    std::shared_ptr<evaluation_domain<FieldType>> lazy_domain = make_evaluation_domain<FieldType>(m);
+    std::shared_ptr<evaluation_domain<FieldType>> prepared_domain = make_evaluation_domain<FieldType>(m);
+    prepared_domain->prepare_fft_cache();
+    // A second call keeps the tables that are already there
+    prepared_domain->prepare_fft_cache();
+
+    std::vector<value_type> a(f), b(f);
+    lazy_domain->fft(a);
+    prepared_domain->fft(b);
+    BOOST_CHECK(a == b);
+
+    prepared_domain->inverse_fft(b);
+    BOOST_CHECK(b == f);
+}
+
 template<typename FieldType>
 void test_inverse_coset_ftt_of_coset_fft() {
     typedef typename FieldType::value_type value_type;
@@ -404,6 +428,13 @@ BOOST_AUTO_TEST_CASE(inverse_fft_to_fft) {
     test_inverse_fft_of_fft<fields::goldilocks64>();
 }
 
+BOOST_AUTO_TEST_CASE(prepare_fft_cache) {
+    for (std::size_t m : {4, 16}) {
+        test_prepare_fft_cache<fields::bls12<381>>(m);
+        test_prepare_fft_cache<fields::goldilocks64>(m);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(inverse_coset_ftt_to_coset_fft) {
     test_inverse_coset_ftt_of_coset_fft<fields::bls12<381>>();
     test_inverse_coset_ftt_of_coset_fft<fields::mnt4<298>>();
@@ -34,15 +34,22 @@
 #include <boost/test/data/monomorphic.hpp>
 
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/secp/secp_k1/scalar_field.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
+#include <nil/crypto3/math/polynomial/subproduct_tree.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
 
 BOOST_AUTO_TEST_SUITE(polynomial_lagrange_interpolation_test_suite)
 
+static_assert(detail::subproduct_tree_fft_log_size<fields::bls12_fr<381>>::value > 0,
+              "bls12-381 scalar field supports FFT products");
+static_assert(detail::subproduct_tree_fft_log_size<fields::secp_k1_fr<256>>::value == 0,
+              "secp256k1 scalar field has no FFT support");
+
 BOOST_AUTO_TEST_CASE(polynomial_lagrange_interpolation_manual_test) {
     using field_type = fields::bls12_fr<381>;
     using integral_type = typename field_type::integral_type;
@@ -94,4 +101,53 @@ BOOST_AUTO_TEST_CASE(polynomial_lagrange_interpolation_random_test) {
     }
 }
 
+template<typename FieldType>
+void test_subproduct_tree() {
+    using field_type = FieldType;
+    using value_type = typename field_type::value_type;
+
+    // Large enough for the FFT products and the Newton division, odd to leave unpaired nodes
+    const std::size_t n = 301;
+    std::vector<value_type> pts(n), values(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        pts[i] = nil::crypto3::algebra::random_element<field_type>();
+        values[i] = nil::crypto3::algebra::random_element<field_type>();
+    }
+    subproduct_tree<value_type> tree(pts);
+
+    polynomial<value_type> vanishing = tree.vanishing_polynomial();
+    BOOST_CHECK_EQUAL(vanishing.degree(), n);
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK(vanishing.evaluate(pts[i]).is_zero());
+    }
+
+    polynomial<value_type> interpolant = tree.interpolate(values);
+    BOOST_CHECK(interpolant.degree() < n);
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK(interpolant.evaluate(pts[i]) == values[i]);
+    }
+
+    std::vector<value_type> f_coeffs(3 * n);
+    for (auto &coeff : f_coeffs) {
+        coeff = nil::crypto3::algebra::random_element<field_type>();
+    }
+    polynomial<value_type> f = {f_coeffs.begin(), f_coeffs.end()};
+    std::vector<value_type> evals = tree.evaluate(f);
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK(evals[i] == f.evaluate(pts[i]));
+    }
+
+    pts[1] = pts[0];
+    BOOST_CHECK_THROW(fast_interpolation(pts, values), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_subproduct_tree_test) {
+    test_subproduct_tree<fields::bls12_fr<381>>();
+}
+
+// No arithmetic_params specialization, so every product is a schoolbook one
+BOOST_AUTO_TEST_CASE(polynomial_subproduct_tree_no_fft_test) {
+    test_subproduct_tree<fields::secp_k1_fr<256>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -40,6 +40,7 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/memory/arena_allocator.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
@@ -1409,3 +1410,65 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_equality_check_perf_test, *boost::unit_test:
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_arena_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_arena_arithmetic) {
+    typedef typename FieldType::value_type value_type;
+    typedef polynomial_dfs<value_type, nil::crypto3::memory::arena_allocator<value_type>> arena_polynomial_dfs;
+
+    std::vector<value_type> a_values(4), b_values(8);
+    for (auto &value : a_values) {
+        value = random_element<FieldType>();
+    }
+    for (auto &value : b_values) {
+        value = random_element<FieldType>();
+    }
+    polynomial_dfs<value_type> a(3, a_values.begin(), a_values.end());
+    polynomial_dfs<value_type> b(7, b_values.begin(), b_values.end());
+
+    nil::crypto3::memory::memory_arena arena;
+    {
+        nil::crypto3::memory::scoped_memory_arena scope(arena);
+
+        arena_polynomial_dfs arena_a(3, a_values.begin(), a_values.end());
+        arena_polynomial_dfs arena_b(7, b_values.begin(), b_values.end());
+        BOOST_CHECK(arena_a.get_allocator().arena() == &arena);
+
+        auto check_equal = [](const polynomial_dfs<value_type> &expected, const arena_polynomial_dfs &actual) {
+            BOOST_CHECK_EQUAL(expected.degree(), actual.degree());
+            BOOST_CHECK(std::equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+        };
+
+        // Both multiplications resize a through the evaluation domains
+        check_equal(a * b, arena_a * arena_b);
+        check_equal(a + b, arena_a + arena_b);
+        check_equal(a - b, arena_a - arena_b);
+        check_equal(a * value_type(5u), arena_a * value_type(5u));
+        check_equal(polynomial_product<FieldType>({a, b, a}),
+                    polynomial_product<FieldType>(std::vector<arena_polynomial_dfs>({arena_a, arena_b, arena_a})));
+        check_equal(polynomial_sum<FieldType>({a, b, a}),
+                    polynomial_sum<FieldType>(std::vector<arena_polynomial_dfs>({arena_a, arena_b, arena_a})));
+
+        // Resizing transforms the arena storage in place
+        polynomial_dfs<value_type> c = a;
+        c.resize(16);
+        arena_polynomial_dfs arena_c = arena_a;
+        arena_c.reserve(16);
+        const value_type *arena_c_data = &*arena_c.begin();
+        arena_c.resize(16);
+        BOOST_CHECK(arena_c_data == &*arena_c.begin());
+        check_equal(c, arena_c);
+
+        // Arena polynomials are accumulated into std storage without a conversion
+        polynomial_dfs<value_type> d = a;
+        d += arena_b;
+        BOOST_CHECK(d == a + b);
+    }
+
+    const nil::crypto3::memory::arena_statistics stats = arena.statistics();
+    BOOST_CHECK_EQUAL(stats.bytes_in_use, 0);
+    BOOST_CHECK(stats.reuses > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
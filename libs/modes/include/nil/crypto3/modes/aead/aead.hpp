@@ -26,6 +26,7 @@
 #define CRYPTO3_MODE_AEAD_MODE_HPP
 
 #include <memory>
+#include <vector>
 
 #include <boost/integer.hpp>
 
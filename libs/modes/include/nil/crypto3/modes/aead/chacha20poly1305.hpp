@@ -25,19 +25,187 @@
 #ifndef CRYPTO3_MODE_AEAD_CHACHA20_POLY1305_HPP
 #define CRYPTO3_MODE_AEAD_CHACHA20_POLY1305_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/endian/conversion.hpp>
+
 #include <nil/crypto3/modes/aead/aead.hpp>
 
+#include <nil/crypto3/mac/detail/poly1305/poly1305_functions.hpp>
+
+#include <nil/crypto3/stream/detail/chacha/chacha_functions.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace mac {
             class poly_1305;
         }
         namespace stream {
-            template<std::size_t IVBits = 64, std::size_t KeyBits = 128, std::size_t Rounds = 20>
+            template<std::size_t IVBits, std::size_t KeyBits, std::size_t Rounds>
             class chacha;
 
             namespace modes {
                 namespace detail {
+                    /*!
+                     * @brief Single pass ChaCha20-Poly1305 (RFC 8439) over a contiguous buffer.
+                     *
+                     * Keystream is generated eight ChaCha blocks at a time. Each 512-byte chunk is
+                     * authenticated right after it has been encrypted (or right before it gets decrypted),
+                     * while it is still hot in L1, and the vectorized Poly1305 absorbs the whole chunk in
+                     * one call.
+                     *
+                     * @tparam Rounds ChaCha rounds amount
+                     */
+                    template<std::size_t Rounds = 20>
+                    struct chacha20poly1305_stitched {
+                        typedef stream::detail::chacha_functions<Rounds, 96, 256> chacha_functions_type;
+                        typedef typename chacha_functions_type::impl_type chacha_impl_type;
+                        typedef typename chacha_functions_type::key_schedule_type chacha_schedule_type;
+
+                        typedef mac::detail::poly1305_functions poly1305_functions_type;
+                        typedef typename poly1305_functions_type::key_schedule_type poly1305_schedule_type;
+
+                        constexpr static const std::size_t chunk_size = chacha_functions_type::block_size * 8;
+                        constexpr static const std::size_t poly1305_block_size = 16;
+
+                        constexpr static const std::size_t key_size = 32;
+                        typedef std::array<std::uint8_t, key_size> key_type;
+
+                        constexpr static const std::size_t nonce_size = 12;
+                        typedef std::array<std::uint8_t, nonce_size> nonce_type;
+
+                        constexpr static const std::size_t tag_size = 16;
+                        typedef std::array<std::uint8_t, tag_size> tag_type;
+
+                        typedef std::array<std::uint8_t, chunk_size> keystream_type;
+
+                        /*!
+                         * @brief The 32-bit block counter bounds a message to 2^32 - 1 keystream blocks
+                         * (block 0 keys Poly1305). Past that the counter would carry into the nonce words.
+                         */
+                        constexpr static const std::uint64_t max_message_size =
+                            std::uint64_t(0xffffffff) * chacha_functions_type::block_size;
+
+                        /*!
+                         * @brief Encrypts buf in place and writes the authentication tag.
+                         * @throws std::invalid_argument if len exceeds max_message_size
+                         */
+                        static void seal(const key_type &key, const nonce_type &nonce, const std::uint8_t *ad,
+                                         std::size_t ad_len, std::uint8_t *buf, std::size_t len, tag_type &tag) {
+                            process<true>(key, nonce, ad, ad_len, buf, len, tag);
+                        }
+
+                        /*!
+                         * @brief Decrypts buf in place and checks the tag in constant time. On mismatch
+                         * the buffer is wiped and false is returned.
+                         * @throws std::invalid_argument if len exceeds max_message_size
+                         */
+                        static bool open(const key_type &key, const nonce_type &nonce, const std::uint8_t *ad,
+                                         std::size_t ad_len, std::uint8_t *buf, std::size_t len,
+                                         const tag_type &tag) {
+                            tag_type computed;
+                            process<false>(key, nonce, ad, ad_len, buf, len, computed);
+
+                            std::uint8_t diff = 0;
+                            for (std::size_t i = 0; i != tag_size; ++i) {
+                                diff |= computed[i] ^ tag[i];
+                            }
+
+                            if (diff != 0) {
+                                std::fill(buf, buf + len, 0);
+                                return false;
+                            }
+                            return true;
+                        }
+
+                    protected:
+                        static void absorb_padded(poly1305_schedule_type &ps, const std::uint8_t *in, std::size_t len) {
+                            const std::size_t full_blocks = len / poly1305_block_size;
+                            const std::size_t remaining = len % poly1305_block_size;
+
+                            if (full_blocks) {
+                                poly1305_functions_type::poly1305_blocks(ps, in, full_blocks);
+                            }
+                            if (remaining) {
+                                std::array<std::uint8_t, poly1305_block_size> last = {0};
+                                std::copy(in + full_blocks * poly1305_block_size, in + len, last.begin());
+                                poly1305_functions_type::poly1305_blocks(ps, last.data(), 1);
+                            }
+                        }
+
+                        template<bool Encrypt>
+                        static void process(const key_type &key, const nonce_type &nonce, const std::uint8_t *ad,
+                                            std::size_t ad_len, std::uint8_t *buf, std::size_t len, tag_type &tag) {
+                            if (static_cast<std::uint64_t>(len) > max_message_size) {
+                                throw std::invalid_argument("ChaCha20-Poly1305 message exceeds 2^32 - 1 blocks");
+                            }
+
+                            chacha_schedule_type cs;
+                            poly1305_schedule_type ps;
+                            keystream_type ks;
+
+                            for (std::size_t i = 0; i != 4; ++i) {
+                                cs[i] = chacha_functions_type::sigma()[i];
+                            }
+                            for (std::size_t i = 0; i != 8; ++i) {
+                                cs[4 + i] = boost::endian::load_little_u32(key.data() + 4 * i);
+                            }
+                            cs[12] = 0;
+                            for (std::size_t i = 0; i != 3; ++i) {
+                                cs[13 + i] = boost::endian::load_little_u32(nonce.data() + 4 * i);
+                            }
+
+                            // Block 0 keys Poly1305, blocks 1..7 of the same batch encrypt the first bytes
+                            chacha_impl_type::chacha_x8(ks, cs);
+
+                            typename poly1305_functions_type::key_type poly1305_key;
+                            std::copy(ks.begin(), ks.begin() + poly1305_key.size(), poly1305_key.begin());
+                            poly1305_functions_type::poly1305_init(ps, poly1305_key);
+                            std::fill(poly1305_key.begin(), poly1305_key.end(), 0);
+
+                            absorb_padded(ps, ad, ad_len);
+
+                            std::size_t offset = chacha_functions_type::block_size;
+                            std::size_t remaining = len;
+                            std::uint8_t *p = buf;
+
+                            while (remaining) {
+                                const std::size_t n = std::min(remaining, chunk_size - offset);
+
+                                if (!Encrypt) {
+                                    absorb_padded(ps, p, n);
+                                }
+                                for (std::size_t i = 0; i != n; ++i) {
+                                    p[i] ^= ks[offset + i];
+                                }
+                                if (Encrypt) {
+                                    absorb_padded(ps, p, n);
+                                }
+
+                                p += n;
+                                remaining -= n;
+                                offset = 0;
+
+                                if (remaining) {
+                                    chacha_impl_type::chacha_x8(ks, cs);
+                                }
+                            }
+
+                            std::array<std::uint8_t, poly1305_block_size> lengths;
+                            boost::endian::store_little_u64(lengths.data(), ad_len);
+                            boost::endian::store_little_u64(lengths.data() + 8, len);
+                            poly1305_functions_type::poly1305_blocks(ps, lengths.data(), 1);
+                            poly1305_functions_type::poly1305_finish(ps, tag.data());
+
+                            std::fill(ks.begin(), ks.end(), 0);
+                            std::fill(cs.begin(), cs.end(), 0);
+                        }
+                    };
+
                     template<typename Padding,
                              std::size_t NonceBits,
                              std::size_t TagBits,
@@ -52,11 +220,21 @@ namespace nil {
                         typedef MessageAuthenticationCode mac_type;
                         typedef Padding padding_type;
 
+                        typedef chacha20poly1305_stitched<stream_cipher_type::rounds> functions_type;
+
                         constexpr static const std::size_t nonce_bits = NonceBits;
                         constexpr static const std::size_t nonce_size = nonce_bits / CHAR_BIT;
-                        typedef std::array<std::uint8_t, nonce_size> nonce_type;
+                        typedef typename functions_type::nonce_type nonce_type;
+
+                        BOOST_STATIC_ASSERT_MSG(nonce_bits == 12 * CHAR_BIT,
+                                                "Only the RFC 8439 construction with 96-bit nonce is supported");
+
+                        constexpr static const std::size_t tag_bits = TagBits;
+                        typedef typename functions_type::tag_type tag_type;
+
+                        BOOST_STATIC_ASSERT(tag_bits == functions_type::tag_size * CHAR_BIT);
 
-                        BOOST_STATIC_ASSERT(nonce_bits == 8 * CHAR_BIT || nonce_bits == 12 * CHAR_BIT);
+                        typedef typename functions_type::key_type key_type;
 
                         typedef std::vector<boost::uint_t<CHAR_BIT>, Allocator<boost::uint_t<CHAR_BIT>>>
                             associated_data_type;
@@ -84,75 +262,21 @@ namespace nil {
                                                         Allocator>
                             policy_type;
 
-                        typedef typename policy_type::stream_cipher_type stream_cipher_type;
-                        typedef typename policy_type::padding_type padding_type;
+                        typedef typename policy_type::functions_type functions_type;
 
-                        typedef typename policy_type::associated_data_type associated_data_type;
+                        typedef typename policy_type::key_type key_type;
                         typedef typename policy_type::nonce_type nonce_type;
+                        typedef typename policy_type::tag_type tag_type;
+                        typedef typename policy_type::associated_data_type associated_data_type;
 
-                        constexpr static const std::size_t block_bits = policy_type::block_bits;
-                        constexpr static const std::size_t block_words = policy_type::block_words;
-                        typedef typename policy_type::block_type block_type;
-
-                        inline static block_type begin_message(const stream_cipher_type &cipher,
-                                                               const block_type &plaintext) {
-                            block_type block = {0};
-
-                            m_ctext_len = 0;
-                            m_nonce_len = nonce_len;
-
-                            m_chacha->set_iv(nonce, nonce_len);
-
-                            secure_vector<uint8_t> init(64); // zeros
-                            m_chacha->encrypt(init);
-
-                            m_poly1305->set_key(init.data(), 32);
-                            // Remainder of output is discard
-
-                            m_poly1305->update(m_ad);
-
-                            if (cfrg_version()) {
-                                if (m_ad.size() % 16) {
-                                    const uint8_t zeros[16] = {0};
-                                    m_poly1305->update(zeros, 16 - m_ad.size() % 16);
-                                }
-                            } else {
-                                update_len(m_ad.size());
-                            }
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type process_block(const stream_cipher_type &cipher,
-                                                               const block_type &plaintext) {
-                            block_type block = {0};
-
-                            m_chacha->cipher1(buf, sz);
-                            m_poly1305->update(buf, sz); // poly1305 of ciphertext
-                            m_ctext_len += sz;
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type end_message(const stream_cipher_type &cipher,
-                                                             const block_type &plaintext) {
-                            block_type result = {0};
-
-                            update(buffer, offset);
-                            if (cfrg_version()) {
-                                if (m_ctext_len % 16) {
-                                    const uint8_t zeros[16] = {0};
-                                    m_poly1305->update(zeros, 16 - m_ctext_len % 16);
-                                }
-                                update_len(m_ad.size());
-                            }
-                            update_len(m_ctext_len);
-
-                            const secure_vector<uint8_t> mac = m_poly1305->final();
-                            buffer += std::make_pair(mac.data(), tag_size());
-                            m_ctext_len = 0;
-
-                            return result;
+                        /*!
+                         * @brief Encrypts the buffer in place, tag receives the authentication tag.
+                         */
+                        inline static bool process(const key_type &key, const nonce_type &nonce,
+                                                   const associated_data_type &ad, std::uint8_t *buf,
+                                                   std::size_t len, tag_type &tag) {
+                            functions_type::seal(key, nonce, ad.data(), ad.size(), buf, len, tag);
+                            return true;
                         }
                     };
 
@@ -178,92 +302,21 @@ namespace nil {
                                                         Allocator>
                             policy_type;
 
-                        typedef typename policy_type::stream_cipher_type cipher_type;
-                        typedef typename policy_type::padding_type padding_type;
+                        typedef typename policy_type::functions_type functions_type;
 
-                        typedef typename policy_type::associated_data_type associated_data_type;
+                        typedef typename policy_type::key_type key_type;
                         typedef typename policy_type::nonce_type nonce_type;
+                        typedef typename policy_type::tag_type tag_type;
+                        typedef typename policy_type::associated_data_type associated_data_type;
 
-                        constexpr static const std::size_t block_bits = policy_type::block_bits;
-                        constexpr static const std::size_t block_words = policy_type::block_words;
-                        typedef typename policy_type::block_type block_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type block = {0};
-
-                            m_ctext_len = 0;
-                            m_nonce_len = nonce_len;
-
-                            m_chacha->set_iv(nonce, nonce_len);
-
-                            secure_vector<uint8_t> init(64); // zeros
-                            m_chacha->encrypt(init);
-
-                            m_poly1305->set_key(init.data(), 32);
-                            // Remainder of output is discard
-
-                            m_poly1305->update(m_ad);
-
-                            if (cfrg_version()) {
-                                if (m_ad.size() % 16) {
-                                    const uint8_t zeros[16] = {0};
-                                    m_poly1305->update(zeros, 16 - m_ad.size() % 16);
-                                }
-                            } else {
-                                update_len(m_ad.size());
-                            }
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type block = {0};
-
-                            m_poly1305->update(buf, sz); // poly1305 of ciphertext
-                            m_chacha->cipher1(buf, sz);
-                            m_ctext_len += sz;
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type result = {0};
-
-                            BOOST_ASSERT_MSG(buffer.size() >= offset, "Offset is sane");
-                            const size_t sz = buffer.size() - offset;
-                            uint8_t *buf = buffer.data() + offset;
-
-                            BOOST_ASSERT_MSG(sz >= tag_size(), "Have the tag as part of final input");
-
-                            const size_t remaining = sz - tag_size();
-
-                            if (remaining) {
-                                m_poly1305->update(buf, remaining); // poly1305 of ciphertext
-                                m_chacha->cipher1(buf, remaining);
-                                m_ctext_len += remaining;
-                            }
-
-                            if (cfrg_version()) {
-                                if (m_ctext_len % 16) {
-                                    const uint8_t zeros[16] = {0};
-                                    m_poly1305->update(zeros, 16 - m_ctext_len % 16);
-                                }
-                                update_len(m_ad.size());
-                            }
-
-                            update_len(m_ctext_len);
-                            const secure_vector<uint8_t> mac = m_poly1305->final();
-
-                            const uint8_t *included_tag = &buf[remaining];
-
-                            m_ctext_len = 0;
-
-                            if (!constant_time_compare(mac.data(), included_tag, tag_size())) {
-                                throw integrity_failure("ChaCha20Poly1305 tag check failed");
-                            }
-                            buffer.resize(offset + remaining);
-
-                            return result;
+                        /*!
+                         * @brief Decrypts the buffer in place and verifies tag against it. The buffer is
+                         * wiped if verification fails.
+                         */
+                        inline static bool process(const key_type &key, const nonce_type &nonce,
+                                                   const associated_data_type &ad, std::uint8_t *buf,
+                                                   std::size_t len, tag_type &tag) {
+                            return functions_type::open(key, nonce, ad.data(), ad.size(), buf, len, tag);
                         }
                     };
 
@@ -276,61 +329,57 @@ namespace nil {
                         typedef typename policy_type::padding_type padding_type;
                         typedef typename policy_type::mac_type mac_type;
 
-                        typedef typename stream_cipher_type::key_type key_type;
+                        typedef typename policy_type::key_type key_type;
+                        typedef typename policy_type::nonce_type nonce_type;
+                        typedef typename policy_type::tag_type tag_type;
                         typedef typename policy_type::associated_data_type associated_data_type;
 
-                        constexpr static const std::size_t block_bits = policy_type::block_bits;
-                        constexpr static const std::size_t block_words = policy_type::block_words;
-                        typedef typename stream_cipher_type::block_type block_type;
-
                         template<typename AssociatedDataContainer>
-                        chacha20poly1305(const stream_cipher_type &cipher,
+                        chacha20poly1305(const key_type &key, const nonce_type &nonce,
                                          const AssociatedDataContainer &associated_data) :
-                            cipher(cipher) {
+                            key(key),
+                            nonce(nonce) {
                             schedule_associated_data(associated_data);
                         }
 
-                        inline block_type begin_message(const block_type &plaintext) {
-                            return policy_type::begin_message(cipher, plaintext, ad);
-                        }
-
-                        inline block_type process_block(const block_type &plaintext) {
-                            return policy_type::process_block(cipher, plaintext, ad);
-                        }
-
-                        inline block_type end_message(const block_type &plaintext) {
-                            return policy_type::end_message(cipher, plaintext, ad);
+                        /*!
+                         * @brief Encrypts or decrypts (depending on the policy) the buffer in one pass.
+                         * @return false if the decryption policy rejected the tag
+                         */
+                        inline bool process(std::uint8_t *buf, std::size_t len, tag_type &tag) const {
+                            return policy_type::process(key, nonce, ad, buf, len, tag);
                         }
 
                         inline static std::size_t required_output_size(std::size_t inputlen) {
-                            return padding_type::required_output_size(inputlen);
+                            return inputlen;
                         }
 
                     protected:
                         template<typename AssociatedDataContainer>
                         inline void schedule_associated_data(const AssociatedDataContainer &iad) {
+                            ad.assign(std::begin(iad), std::end(iad));
                         }
 
+                        key_type key;
+                        nonce_type nonce;
                         associated_data_type ad;
-
-                        stream_cipher_type cipher;
-                        mac_type mac;
                     };
                 }    // namespace detail
 
                 /*!
-                 * @brief See draft-irtf-cfrg-chacha20-poly1305-03 for specification
-                 * If a nonce of 64 bits is used the older version described in
-                 * draft-agl-tls-chacha20poly1305-04 is used instead.
+                 * @brief See RFC 8439 for specification. Encryption and authentication are performed
+                 * in a single pass over the buffer.
                  *
-                 * @tparam StreamCipher
                  * @tparam Padding
-                 * @tparam CiphertextStealingMode
+                 * @tparam NonceBits Only 96-bit nonces (RFC 8439) are supported
+                 * @tparam TagBits
+                 * @tparam StreamCipher
+                 * @tparam MessageAuthenticationCode
                  */
                 template<template<typename> class Padding,
-                         std::size_t NonceBits,
+                         std::size_t NonceBits = 12 * CHAR_BIT,
                          std::size_t TagBits = 16 * CHAR_BIT,
-                         typename StreamCipher = stream::chacha<>,
+                         typename StreamCipher = stream::chacha<12 * CHAR_BIT, 256, 20>,
                          typename MessageAuthenticationCode = mac::poly_1305,
                          template<typename> class Allocator = std::allocator>
                 struct chacha20poly1305 {
@@ -353,12 +402,9 @@ namespace nil {
                                                                        Allocator>
                         decryption_policy;
 
-                    template<template<typename, typename, std::size_t, std::size_t, template<typename> class>
-                             class Policy>
+                    template<typename Policy>
                     struct bind {
-                        typedef detail::chacha20poly1305<
-                            Policy<stream_cipher_type, padding_type, NonceBits, TagBits, Allocator>>
-                            type;
+                        typedef detail::chacha20poly1305<Policy> type;
                     };
                 };
             }    // namespace modes
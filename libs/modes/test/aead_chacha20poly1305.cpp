@@ -25,16 +25,159 @@
 
 #define BOOST_TEST_MODULE aead_chacha20poly1305_test
 
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <nil/crypto3/modes/aead/chacha20poly1305.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
+using namespace nil::crypto3;
+
+typedef stream::modes::detail::chacha20poly1305_stitched<> stitched_type;
+
+template<typename Container>
+Container from_hex(const std::string &hex) {
+    Container result(hex.size() / 2);
+    for (std::size_t i = 0; i != result.size(); ++i) {
+        result[i] = static_cast<typename Container::value_type>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return result;
+}
+
+template<std::size_t N>
+std::array<std::uint8_t, N> array_from_hex(const std::string &hex) {
+    std::vector<std::uint8_t> v = from_hex<std::vector<std::uint8_t>>(hex);
+    std::array<std::uint8_t, N> result{};
+    std::copy(v.begin(), v.end(), result.begin());
+    return result;
+}
+
 BOOST_AUTO_TEST_SUITE(chacha20poly1305_mode_test_suite)
 
-    BOOST_AUTO_TEST_CASE(chacha20poly1305_mode_test_case) {
+    // RFC 8439, section 2.8.2
+    BOOST_AUTO_TEST_CASE(chacha20poly1305_rfc8439_test_case) {
+        const stitched_type::key_type key =
+            array_from_hex<32>("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f");
+        const stitched_type::nonce_type nonce = array_from_hex<12>("070000004041424344454647");
+        const std::vector<std::uint8_t> ad = from_hex<std::vector<std::uint8_t>>("50515253c0c1c2c3c4c5c6c7");
+
+        const std::string plaintext =
+            "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, "
+            "sunscreen would be it.";
+        const std::vector<std::uint8_t> ciphertext = from_hex<std::vector<std::uint8_t>>(
+            "d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d63dbea45e8ca9671282fafb69da92728b1a71de0a9e0"
+            "60b2905d6a5b67ecd3b3692ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc3ff4def08e4b7a9de576d2"
+            "6586cec64b6116");
+        const stitched_type::tag_type expected_tag = array_from_hex<16>("1ae10b594f09e26a7e902ecbd0600691");
+
+        std::vector<std::uint8_t> buf(plaintext.begin(), plaintext.end());
+        stitched_type::tag_type tag;
+
+        stitched_type::seal(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag);
+        BOOST_CHECK(buf == ciphertext);
+        BOOST_CHECK(tag == expected_tag);
+
+        BOOST_CHECK(stitched_type::open(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag));
+        BOOST_CHECK(std::string(buf.begin(), buf.end()) == plaintext);
+    }
+
+    BOOST_AUTO_TEST_CASE(chacha20poly1305_multi_chunk_test_case) {
+        stitched_type::key_type key;
+        stitched_type::nonce_type nonce;
+        for (std::size_t i = 0; i != key.size(); ++i) {
+            key[i] = static_cast<std::uint8_t>(3 * i + 1);
+        }
+        for (std::size_t i = 0; i != nonce.size(); ++i) {
+            nonce[i] = static_cast<std::uint8_t>(i);
+        }
+        const std::vector<std::uint8_t> ad(37, 0xaa);
+
+        for (std::size_t len : {0, 1, 15, 16, 447, 448, 449, 960, 4099}) {
+            std::vector<std::uint8_t> plaintext(len);
+            for (std::size_t i = 0; i != len; ++i) {
+                plaintext[i] = static_cast<std::uint8_t>(i * 7);
+            }
+
+            std::vector<std::uint8_t> buf = plaintext;
+            stitched_type::tag_type tag;
+            stitched_type::seal(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag);
+            BOOST_CHECK(stitched_type::open(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag));
+            BOOST_CHECK(buf == plaintext);
+
+            stitched_type::seal(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag);
+            tag[0] ^= 1;
+            BOOST_CHECK(!stitched_type::open(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag));
+        }
+    }
+
+    // Lengths past the first 448-byte batch run through several stitched 512-byte chunks. Expected values
+    // come from a plain one-block-at-a-time RFC 8439 implementation.
+    BOOST_AUTO_TEST_CASE(chacha20poly1305_multi_chunk_known_answer_test_case) {
+        stitched_type::key_type key;
+        stitched_type::nonce_type nonce;
+        for (std::size_t i = 0; i != key.size(); ++i) {
+            key[i] = static_cast<std::uint8_t>(3 * i + 1);
+        }
+        for (std::size_t i = 0; i != nonce.size(); ++i) {
+            nonce[i] = static_cast<std::uint8_t>(i);
+        }
+        const std::vector<std::uint8_t> ad(37, 0xaa);
+
+        const std::vector<std::pair<std::size_t, std::string>> expected_tags = {
+            {449, "f49cc1be7fcd4821192ff0ea12f7c155"},  {512, "a4663a5342a33a699f4d1049992d177e"},
+            {520, "14602ae233c5d393a21fc9b99ad56590"},  {960, "edc91238fae46f32dfac38e072b3fcd2"},
+            {1023, "53866720427ca21f04e4336a5f3bf2b1"}, {4099, "81f457d541438ee4ed41e90835f7ff7d"}};
+
+        const std::vector<std::uint8_t> ciphertext_520 = from_hex<std::vector<std::uint8_t>>(
+            "4f0294e64e10aa7faf688a917a33a7c20be7496eb9447592f4e74ce4ed2ef19c16e7872c811242c549a814c5bb99147c5154501a6f4e"
+            "284b463f5f5bb771a60be402601351d0bdd658cb5974def0d59c3e9bc3ecd7236abcd95bdc47888f7c4a3e42f47f38afc47973dfb04f"
+            "81ebe40f63a961f06c3dbbee635d9c5a22b55073143256b544de34e80051b1b3e232f8b713eea7cd873edf220e5bb65063c8ce0e2ac1"
+            "57c564b42d95608e318ba428d4ee0085375c4c4026feba744ca7424f6d3362abbbcf680109a6012611e4e8e9f9856f7b6a9c8f37c7f6"
+            "5c74c534eacad2603a329e42b2eb3c625c302613ce92846c7dc23287ca9b8586971321a4e1a92f8dd9ab9e8fea7d489b6df80155f135"
+            "76f0dc43ab68a2b6cf9306ef4e0802e9846ed298ff8eaee8d396077a620c7a2a57b55bda74bc165e22b3f8eaca31eb3234add829fd66"
+            "57868bfecfb71364463193d84bda9e403bd2f7e9a86d4d78530cf60b7a6fc4d8fc1e23c4aee2f67bc29e4e517d21a1edb320cfe844bf"
+            "c108c50b872ca54a491736083318897341158d6b92fb39bf784e7b0e28eade9fbb4ed79d792a5d629639601d0f82e7c9ce93c4cf23ab"
+            "656cf930a1235bb8ca5179f21c14f5883f46703dbfe63b049d2221dbc5d4b0c1a544f62a8ecf00bbb7766803fc5555534d842eddfdaa"
+            "9a2f37ed6bfe8720c036a9a39e67f45e4a0aeb0fb105462b8f5bc9aae9c5f46f9f23");
+
+        for (const auto &expected : expected_tags) {
+            std::vector<std::uint8_t> plaintext(expected.first);
+            for (std::size_t i = 0; i != plaintext.size(); ++i) {
+                plaintext[i] = static_cast<std::uint8_t>(i * 7);
+            }
+
+            std::vector<std::uint8_t> buf = plaintext;
+            stitched_type::tag_type tag;
+            stitched_type::seal(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag);
+            BOOST_CHECK(tag == array_from_hex<16>(expected.second));
+            if (expected.first == ciphertext_520.size()) {
+                BOOST_CHECK(buf == ciphertext_520);
+            }
+
+            BOOST_CHECK(stitched_type::open(key, nonce, ad.data(), ad.size(), buf.data(), buf.size(), tag));
+            BOOST_CHECK(buf == plaintext);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(chacha20poly1305_message_size_limit_test_case) {
+        if (std::numeric_limits<std::size_t>::max() <= stitched_type::max_message_size) {
+            return;
+        }
+
+        const stitched_type::key_type key = {0};
+        const stitched_type::nonce_type nonce = {0};
+        std::uint8_t byte = 0;
+        stitched_type::tag_type tag = {0};
 
+        // The length is rejected before the buffer is touched
+        const std::size_t too_long = static_cast<std::size_t>(stitched_type::max_message_size + 1);
+        BOOST_CHECK_THROW(stitched_type::seal(key, nonce, nullptr, 0, &byte, too_long, tag), std::invalid_argument);
+        BOOST_CHECK_THROW(stitched_type::open(key, nonce, nullptr, 0, &byte, too_long, tag), std::invalid_argument);
     }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,309 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MULTIPRECISION_MODULAR_BACKENDS_INVERSE_SAFEGCD_HPP
+#define CRYPTO3_MULTIPRECISION_MODULAR_BACKENDS_INVERSE_SAFEGCD_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include <boost/multiprecision/detail/number_base.hpp>
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+            /*
+             * Constant-time modular inversion for odd moduli of at most Bits bits, following
+             * "Fast constant-time gcd computation and modular inversion" by Daniel J. Bernstein and Bo-Yin Yang,
+             * https://gcd.cr.yp.to/safegcd-20190413.pdf
+             *
+             * The values are kept in signed 62-bit limbs. Divsteps are applied in batches of 62, each batch
+             * working on the lowest limbs only and producing a 2x2 transition matrix, which is then applied
+             * to the full f, g and to the Bezout coefficients d, e. The number of batches depends on Bits only,
+             * and every step is branch-free, so the running time does not depend on the input value.
+             */
+            template<unsigned Bits>
+            struct safegcd_inverse {
+                typedef __int128 int128_type;
+                typedef unsigned __int128 uint128_type;
+
+                constexpr static const unsigned limb_bits = 62;
+                constexpr static const std::uint64_t limb_mask = (std::uint64_t(1) << limb_bits) - 1;
+                // f and g stay within (-2^(Bits+1), 2^(Bits+1)), the top limb keeps the sign.
+                constexpr static const unsigned limbs_count = Bits / limb_bits + 1;
+
+                // Upper bound on the divstep count for a Bits-bit modulus, theorem 11.2 of the paper.
+                constexpr static const unsigned divsteps_count =
+                    (Bits < 46) ? (49 * Bits + 80) / 17 : (49 * Bits + 57) / 17;
+                constexpr static const unsigned rounds_count = (divsteps_count + limb_bits - 1) / limb_bits;
+
+                struct signed62_type {
+                    std::int64_t v[limbs_count];
+                };
+
+                // Transition matrix of 62 divsteps, scaled by 2^62.
+                struct trans2x2_type {
+                    std::int64_t u, v, q, r;
+                };
+
+                // Backend limbs are consumed in pieces of at most 64 bits, so trivial backends with wide
+                // limbs are handled as well.
+                template<typename Backend>
+                BOOST_MP_CXX14_CONSTEXPR static void load(signed62_type &out, const Backend &in) {
+                    uint128_type acc = 0;
+                    unsigned acc_bits = 0, j = 0;
+
+                    for (unsigned i = 0; i < in.size() && j < limbs_count; ++i) {
+                        for (unsigned p = 0; p < Backend::limb_bits && j < limbs_count; p += 64) {
+                            const unsigned piece_bits = (Backend::limb_bits - p < 64) ? Backend::limb_bits - p : 64;
+                            acc |= static_cast<uint128_type>(static_cast<std::uint64_t>(in.limbs()[i] >> p))
+                                   << acc_bits;
+                            acc_bits += piece_bits;
+                            while (acc_bits >= limb_bits && j < limbs_count) {
+                                out.v[j++] = static_cast<std::int64_t>(static_cast<std::uint64_t>(acc) & limb_mask);
+                                acc >>= limb_bits;
+                                acc_bits -= limb_bits;
+                            }
+                        }
+                    }
+                    for (; j < limbs_count; ++j) {
+                        out.v[j] = static_cast<std::int64_t>(static_cast<std::uint64_t>(acc) & limb_mask);
+                        acc >>= limb_bits;
+                    }
+                }
+
+                // Requires a normalized value, i.e. all limbs in [0, 2^62).
+                template<typename Backend>
+                BOOST_MP_CXX14_CONSTEXPR static void store(Backend &out, const signed62_type &in) {
+                    typedef typename std::remove_cv<
+                        typename std::remove_pointer<decltype(out.limbs())>::type>::type limb_type;
+
+                    uint128_type acc = 0;
+                    unsigned acc_bits = 0, j = 0;
+
+                    for (unsigned i = 0; i < out.size(); ++i) {
+                        limb_type limb = 0;
+                        for (unsigned p = 0; p < Backend::limb_bits; p += 64) {
+                            const unsigned piece_bits = (Backend::limb_bits - p < 64) ? Backend::limb_bits - p : 64;
+                            while (acc_bits < piece_bits && j < limbs_count) {
+                                acc |= static_cast<uint128_type>(static_cast<std::uint64_t>(in.v[j++])) << acc_bits;
+                                acc_bits += limb_bits;
+                            }
+                            limb |= static_cast<limb_type>(static_cast<std::uint64_t>(acc)) << p;
+                            acc >>= piece_bits;
+                            acc_bits = acc_bits > piece_bits ? acc_bits - piece_bits : 0;
+                        }
+                        out.limbs()[i] = limb;
+                    }
+                }
+
+                // Inverse of an odd m0 modulo 2^62 by Newton iteration, every step doubles the correct bits.
+                BOOST_MP_CXX14_CONSTEXPR static std::uint64_t inverse_limb(std::uint64_t m0) {
+                    std::uint64_t x = m0;
+                    for (unsigned i = 0; i < 5; ++i) {
+                        x *= 2 - m0 * x;
+                    }
+                    return x & limb_mask;
+                }
+
+                /*
+                 * Performs 62 divsteps on the lowest limbs f0, g0 and returns the new zeta. zeta = -delta, so
+                 * "delta > 0" becomes a sign test. The matrix entries are computed modulo 2^64, which keeps the
+                 * left shifts well-defined, and fit into [-2^62, 2^62] in the end.
+                 */
+                BOOST_MP_CXX14_CONSTEXPR static std::int64_t divsteps(std::int64_t zeta, std::uint64_t f0,
+                                                                      std::uint64_t g0, trans2x2_type &t) {
+                    std::uint64_t u = 1, v = 0, q = 0, r = 1;
+                    std::uint64_t f = f0, g = g0;
+
+                    for (unsigned i = 0; i < limb_bits; ++i) {
+                        // c1 is set when delta > 0, c2 when g is odd.
+                        std::uint64_t c1 = static_cast<std::uint64_t>(zeta >> 63);
+                        const std::uint64_t c2 = -(g & 1);
+
+                        const std::uint64_t x = (f ^ c1) - c1;
+                        const std::uint64_t y = (u ^ c1) - c1;
+                        const std::uint64_t z = (v ^ c1) - c1;
+
+                        g += x & c2;
+                        q += y & c2;
+                        r += z & c2;
+
+                        // c1 is now the swap condition: delta becomes 1 - delta, otherwise 1 + delta.
+                        c1 &= c2;
+                        zeta = (zeta ^ static_cast<std::int64_t>(c1)) - 1 - static_cast<std::int64_t>(c1);
+
+                        f += g & c1;
+                        u += q & c1;
+                        v += r & c1;
+
+                        g >>= 1;
+                        u <<= 1;
+                        v <<= 1;
+                    }
+
+                    t.u = static_cast<std::int64_t>(u);
+                    t.v = static_cast<std::int64_t>(v);
+                    t.q = static_cast<std::int64_t>(q);
+                    t.r = static_cast<std::int64_t>(r);
+
+                    return zeta;
+                }
+
+                // (f, g) = t * (f, g) / 2^62, the division is exact.
+                BOOST_MP_CXX14_CONSTEXPR static void update_fg(signed62_type &f, signed62_type &g,
+                                                               const trans2x2_type &t) {
+                    int128_type cf = static_cast<int128_type>(t.u) * f.v[0] + static_cast<int128_type>(t.v) * g.v[0];
+                    int128_type cg = static_cast<int128_type>(t.q) * f.v[0] + static_cast<int128_type>(t.r) * g.v[0];
+                    cf >>= limb_bits;
+                    cg >>= limb_bits;
+
+                    for (unsigned i = 1; i < limbs_count; ++i) {
+                        cf += static_cast<int128_type>(t.u) * f.v[i] + static_cast<int128_type>(t.v) * g.v[i];
+                        cg += static_cast<int128_type>(t.q) * f.v[i] + static_cast<int128_type>(t.r) * g.v[i];
+                        f.v[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(cf) & limb_mask);
+                        g.v[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(cg) & limb_mask);
+                        cf >>= limb_bits;
+                        cg >>= limb_bits;
+                    }
+
+                    f.v[limbs_count - 1] = static_cast<std::int64_t>(cf);
+                    g.v[limbs_count - 1] = static_cast<std::int64_t>(cg);
+                }
+
+                /*
+                 * (d, e) = t * (d, e) / 2^62 mod m. Multiples of m are added so that the low 62 bits vanish,
+                 * plus one more m per negative input, which keeps d and e within (-2m, m).
+                 */
+                BOOST_MP_CXX14_CONSTEXPR static void update_de(signed62_type &d, signed62_type &e,
+                                                               const trans2x2_type &t, const signed62_type &m,
+                                                               std::uint64_t m_inv) {
+                    const std::int64_t sd = d.v[limbs_count - 1] >> 63;
+                    const std::int64_t se = e.v[limbs_count - 1] >> 63;
+
+                    std::int64_t md = (t.u & sd) + (t.v & se);
+                    std::int64_t me = (t.q & sd) + (t.r & se);
+
+                    int128_type cd = static_cast<int128_type>(t.u) * d.v[0] + static_cast<int128_type>(t.v) * e.v[0];
+                    int128_type ce = static_cast<int128_type>(t.q) * d.v[0] + static_cast<int128_type>(t.r) * e.v[0];
+
+                    md -= static_cast<std::int64_t>(
+                        (m_inv * static_cast<std::uint64_t>(cd) + static_cast<std::uint64_t>(md)) & limb_mask);
+                    me -= static_cast<std::int64_t>(
+                        (m_inv * static_cast<std::uint64_t>(ce) + static_cast<std::uint64_t>(me)) & limb_mask);
+
+                    cd += static_cast<int128_type>(m.v[0]) * md;
+                    ce += static_cast<int128_type>(m.v[0]) * me;
+                    cd >>= limb_bits;
+                    ce >>= limb_bits;
+
+                    for (unsigned i = 1; i < limbs_count; ++i) {
+                        cd += static_cast<int128_type>(t.u) * d.v[i] + static_cast<int128_type>(t.v) * e.v[i] +
+                              static_cast<int128_type>(m.v[i]) * md;
+                        ce += static_cast<int128_type>(t.q) * d.v[i] + static_cast<int128_type>(t.r) * e.v[i] +
+                              static_cast<int128_type>(m.v[i]) * me;
+                        d.v[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(cd) & limb_mask);
+                        e.v[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(ce) & limb_mask);
+                        cd >>= limb_bits;
+                        ce >>= limb_bits;
+                    }
+
+                    d.v[limbs_count - 1] = static_cast<std::int64_t>(cd);
+                    e.v[limbs_count - 1] = static_cast<std::int64_t>(ce);
+                }
+
+                BOOST_MP_CXX14_CONSTEXPR static void propagate_carries(signed62_type &r) {
+                    for (unsigned i = 0; i + 1 < limbs_count; ++i) {
+                        r.v[i + 1] += r.v[i] >> limb_bits;
+                        r.v[i] &= static_cast<std::int64_t>(limb_mask);
+                    }
+                }
+
+                // Brings r from (-2m, m) to [0, m), negating it first if sign is negative.
+                BOOST_MP_CXX14_CONSTEXPR static void normalize(signed62_type &r, std::int64_t sign,
+                                                               const signed62_type &m) {
+                    std::int64_t cond_add = r.v[limbs_count - 1] >> 63;
+                    for (unsigned i = 0; i < limbs_count; ++i) {
+                        r.v[i] += m.v[i] & cond_add;
+                    }
+
+                    const std::int64_t cond_negate = sign >> 63;
+                    for (unsigned i = 0; i < limbs_count; ++i) {
+                        r.v[i] = (r.v[i] ^ cond_negate) - cond_negate;
+                    }
+                    propagate_carries(r);
+
+                    cond_add = r.v[limbs_count - 1] >> 63;
+                    for (unsigned i = 0; i < limbs_count; ++i) {
+                        r.v[i] += m.v[i] & cond_add;
+                    }
+                    propagate_carries(r);
+                }
+
+                BOOST_MP_CXX14_CONSTEXPR static bool is_unit(const signed62_type &f) {
+                    bool is_one = f.v[0] == 1, is_minus_one = f.v[limbs_count - 1] == -1;
+                    for (unsigned i = 1; i < limbs_count; ++i) {
+                        is_one = is_one && f.v[i] == 0;
+                    }
+                    for (unsigned i = 0; i + 1 < limbs_count; ++i) {
+                        is_minus_one = is_minus_one && f.v[i] == static_cast<std::int64_t>(limb_mask);
+                    }
+                    return is_one || is_minus_one;
+                }
+
+                /*
+                 * result = x^{-1} mod m for an odd m < 2^Bits and x < m. Returns false and sets result to zero
+                 * when x is not invertible.
+                 */
+                BOOST_MP_CXX14_CONSTEXPR static bool process(signed62_type &result, const signed62_type &x,
+                                                             const signed62_type &m) {
+                    signed62_type d = {}, e = {}, f = m, g = x;
+                    e.v[0] = 1;
+
+                    const std::uint64_t m_inv = inverse_limb(static_cast<std::uint64_t>(m.v[0]));
+                    std::int64_t zeta = -1;    // delta = 1
+
+                    for (unsigned i = 0; i < rounds_count; ++i) {
+                        trans2x2_type t = {0, 0, 0, 0};
+                        zeta = divsteps(zeta, static_cast<std::uint64_t>(f.v[0]), static_cast<std::uint64_t>(g.v[0]), t);
+                        update_de(d, e, t, m, m_inv);
+                        update_fg(f, g, t);
+                    }
+
+                    // Now g = 0 and f = +-gcd(x, m), d * x = f mod m.
+                    if (!is_unit(f)) {
+                        result = signed62_type {};
+                        return false;
+                    }
+
+                    normalize(d, f.v[limbs_count - 1], m);
+                    result = d;
+                    return true;
+                }
+            };
+
+            /*
+             * Constant-time inversion of n modulo an odd mod of at most Bits bits. n must be reduced,
+             * the result is zero if n is not invertible.
+             */
+            template<unsigned Bits, typename Backend>
+            BOOST_MP_CXX14_CONSTEXPR void eval_inverse_mod_safegcd(Backend &result, const Backend &n,
+                                                                   const Backend &mod) {
+                typedef safegcd_inverse<Bits> safegcd_type;
+
+                typename safegcd_type::signed62_type x = {}, m = {}, r = {};
+                safegcd_type::load(x, n);
+                safegcd_type::load(m, mod);
+                safegcd_type::process(r, x, m);
+                safegcd_type::store(result, r);
+            }
+        }    // namespace backends
+    }        // namespace multiprecision
+}    // namespace boost
+
+#endif    // CRYPTO3_MULTIPRECISION_MODULAR_BACKENDS_INVERSE_SAFEGCD_HPP
@@ -12,6 +12,7 @@
 #define CRYPTO3_MULTIPRECISION_MODULAR_ADAPTOR_FIXED_PRECISION_HPP
 
 #include <nil/crypto3/multiprecision/modular/modular_params_fixed.hpp>
+#include <nil/crypto3/multiprecision/modular/inverse_safegcd.hpp>
 #include <nil/crypto3/multiprecision/traits/is_backend.hpp>
 
 namespace boost {
@@ -351,7 +352,12 @@ namespace boost {
                 Backend_padded_limbs new_base, res, tmp = input.mod_data().get_mod();
 
                 input.mod_data().adjust_regular(new_base, input.base_data());
-                eval_inverse_mod(res, new_base, tmp);
+                if (tmp.limbs()[0] & 1u) {
+                    // Odd modulus, which covers every prime field: constant-time safegcd
+                    eval_inverse_mod_safegcd<Bits>(res, new_base, tmp);
+                } else {
+                    eval_inverse_mod(res, new_base, tmp);
+                }
                 assign_components(result, res, input.mod_data().get_mod());
             }
 
@@ -198,5 +198,48 @@ BOOST_AUTO_TEST_CASE(modular_adaptor_number_mult_perf_test) {
     std::cout << x << std::endl;
 }
 
+// Compares the constant-time safegcd inversion used by modular_adaptor with the previous
+// variable-time path through signed cpp_int.
+BOOST_AUTO_TEST_CASE(modular_adaptor_inverse_perf_test) {
+    using Backend = cpp_int_modular_backend<256>;
+    using Backend_padded_limbs = typename modular_params<Backend>::policy_type::Backend_padded_limbs;
+    using standart_number = boost::multiprecision::number<Backend>;
+    using params_safe_type = modular_params_rt<Backend>;
+    using modular_backend = modular_adaptor<Backend, params_safe_type>;
+    using modular_number = boost::multiprecision::number<modular_backend>;
+    constexpr standart_number modulus = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppui_modular256;
+    constexpr standart_number x_value = 0xb5d724ce6f44c3c587867bbcb417e9eb6fa05e7e2ef029166568f14eb3161387_cppui_modular256;
+    modular_number x(modular_backend(x_value.backend(), modulus.backend()));
+
+    int SAMPLES = 100000;
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (int i = 0; i < SAMPLES; ++i) {
+        x = inverse_mod(x);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Safegcd inversion time: " << std::fixed << std::setprecision(3)
+        << std::dec << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    // Print something so the whole computation is not optimized out.
+    std::cout << x << std::endl;
+
+    Backend_padded_limbs base, res, mod = modulus.backend();
+    x.backend().mod_data().adjust_regular(base, x.backend().base_data());
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < SAMPLES; ++i) {
+        eval_inverse_mod(res, base, mod);
+        base = res;
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Extended Euclidean inversion time: " << std::fixed << std::setprecision(3)
+        << std::dec << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    std::cout << standart_number(base) << std::endl;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -224,6 +224,47 @@ BOOST_AUTO_TEST_CASE(test_cpp_int_modular_backend_6_bits) {
     BOOST_CHECK_EQUAL(number<T>(res.backend()), number<T>(26u));
 }
 
+BOOST_AUTO_TEST_CASE(test_safegcd_modular_adaptor_fixed) {
+    using namespace boost::multiprecision;
+
+    using Backend = cpp_int_modular_backend<381>;
+    using standart_number = number<Backend>;
+    using modular_backend = backends::modular_adaptor<Backend, backends::modular_params_rt<Backend>>;
+    using modular_number = number<modular_backend>;
+
+    // BLS12-381 base field modulus, secp256k1 base field modulus and a tiny one, all odd.
+    const standart_number moduli[] = {
+        0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab_cppui_modular381,
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppui_modular381,
+        0x25_cppui_modular381};
+
+    for (const auto &modulus : moduli) {
+        const modular_number one(modular_backend(standart_number(1u).backend(), modulus.backend()));
+        const modular_number zero(modular_backend(standart_number(0u).backend(), modulus.backend()));
+        modular_number x(modular_backend(standart_number(3u).backend(), modulus.backend()));
+
+        for (std::size_t i = 0; i < 64; ++i) {
+            x = x * x + one;
+            if (x == zero) {
+                continue;
+            }
+            BOOST_CHECK_EQUAL(x * inverse_mod(x), one);
+        }
+
+        BOOST_CHECK_EQUAL(inverse_mod(one), one);
+        BOOST_CHECK_EQUAL(inverse_mod(zero), zero);
+    }
+
+    // The constant-time path agrees with the generic one on a raw backend.
+    Backend r1, r2;
+    const standart_number n = 0x435b21e35ccd62dbdbafa1368cf742f0_cppui_modular381;
+    const standart_number m = 0x7fffffffffffffffffffffffffffffff_cppui_modular381;
+    backends::eval_inverse_mod_safegcd<127>(r1, n.backend(), m.backend());
+    backends::eval_inverse_mod(r2, n.backend(), m.backend());
+    BOOST_CHECK_EQUAL(standart_number(r1), 0x604ddb74e5a55e559a7320e45b06eaf6_cppui_modular381);
+    BOOST_CHECK_EQUAL(standart_number(r1), standart_number(r2));
+}
+
 //BOOST_AUTO_TEST_CASE(test_cpp_int_modular_backend_6_bits) {
 //    using namespace boost::multiprecision;
 //    using T = boost::multiprecision::cpp_int_modular_modular_backend<6>;
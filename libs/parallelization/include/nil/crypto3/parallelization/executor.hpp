@@ -0,0 +1,291 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_PARALLELIZATION_EXECUTOR_HPP
+#define CRYPTO3_PARALLELIZATION_EXECUTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace parallelization {
+            /** @brief Runs tasks submitted by the parallel algorithms.
+             *
+             * run_until lets a thread waiting for its own tasks execute queued work and sleep when there is
+             * none, which is what keeps nested parallel loops from deadlocking on a fixed number of threads.
+             * Submitted tasks must not throw, task_group catches exceptions on their behalf.
+             */
+            class executor {
+            public:
+                virtual ~executor() = default;
+
+                virtual void submit(std::function<void()> task) = 0;
+
+                // Runs queued tasks until done() holds, blocking while the queues are empty
+                virtual void run_until(const std::function<bool()> &done) = 0;
+
+                // Wakes the threads blocked in run_until, so that they check done() again
+                virtual void notify_waiters() = 0;
+
+                // Number of threads the work should be split for
+                virtual std::size_t concurrency() const = 0;
+            };
+
+            /** @brief Executes every task on the submitting thread. */
+            class inline_executor final : public executor {
+            public:
+                void submit(std::function<void()> task) override {
+                    task();
+                }
+
+                void run_until(const std::function<bool()> &) override {
+                }
+
+                void notify_waiters() override {
+                }
+
+                std::size_t concurrency() const override {
+                    return 1;
+                }
+            };
+
+            class thread_pool;
+
+            namespace detail {
+                inline executor *&current_executor_slot() {
+                    static thread_local executor *current = nullptr;
+                    return current;
+                }
+
+                struct worker_identity {
+                    const thread_pool *pool = nullptr;
+                    std::size_t index = 0;
+                };
+
+                inline worker_identity &current_worker() {
+                    static thread_local worker_identity worker;
+                    return worker;
+                }
+            }    // namespace detail
+
+            /** @brief Fixed set of worker threads with a work-stealing deque each.
+             *
+             * A worker pushes and pops its own tasks at the back of its deque and steals from the front
+             * of the others' deques when it runs dry, so the tasks spawned by a parallel loop stay on the
+             * thread that spawned them unless another thread is idle. Tasks submitted from outside the pool
+             * are spread round robin over the deques.
+             *
+             * If cpus is not empty, worker i is pinned to cpus[i % cpus.size()] (Linux only, ignored
+             * elsewhere). Workers make the pool their current executor, so parallel algorithms called from
+             * a task stay on the same pool.
+             */
+            class thread_pool final : public executor {
+            public:
+                explicit thread_pool(std::size_t threads_count = std::thread::hardware_concurrency(),
+                                     const std::vector<std::size_t> &cpus = {}) :
+                    _queues(threads_count == 0 ? 1 : threads_count) {
+                    for (std::size_t i = 0; i < _queues.size(); ++i) {
+                        _workers.emplace_back([this, i]() { worker_loop(i); });
+#ifdef __linux__
+                        if (!cpus.empty()) {
+                            cpu_set_t cpu_set;
+                            CPU_ZERO(&cpu_set);
+                            CPU_SET(cpus[i % cpus.size()], &cpu_set);
+                            pthread_setaffinity_np(_workers.back().native_handle(), sizeof(cpu_set_t), &cpu_set);
+                        }
+#endif
+                    }
+                }
+
+                thread_pool(const thread_pool &) = delete;
+                thread_pool &operator=(const thread_pool &) = delete;
+
+                ~thread_pool() override {
+                    {
+                        std::lock_guard<std::mutex> lock(_wake_mutex);
+                        _stop = true;
+                    }
+                    _wake.notify_all();
+                    for (std::thread &worker : _workers) {
+                        worker.join();
+                    }
+                }
+
+                void submit(std::function<void()> task) override {
+                    const detail::worker_identity &worker = detail::current_worker();
+                    const std::size_t index =
+                        worker.pool == this ? worker.index : _next_queue.fetch_add(1) % _queues.size();
+                    {
+                        std::lock_guard<std::mutex> lock(_queues[index].mutex);
+                        _queues[index].tasks.push_back(std::move(task));
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(_wake_mutex);
+                        ++_queued;
+                    }
+                    _wake.notify_one();
+                }
+
+                void run_until(const std::function<bool()> &done) override {
+                    while (!done()) {
+                        std::function<void()> task;
+                        if (pop(task)) {
+                            task();
+                            continue;
+                        }
+
+                        std::unique_lock<std::mutex> lock(_wake_mutex);
+                        _wake.wait(lock, [this, &done]() { return _queued > 0 || done(); });
+                    }
+                }
+
+                void notify_waiters() override {
+                    // Taking the lock orders the notification after a waiter that found done() false went to sleep
+                    { std::lock_guard<std::mutex> lock(_wake_mutex); }
+                    _wake.notify_all();
+                }
+
+                std::size_t concurrency() const override {
+                    return _queues.size();
+                }
+
+            private:
+                struct task_queue {
+                    std::mutex mutex;
+                    std::deque<std::function<void()>> tasks;
+                };
+
+                bool pop(std::function<void()> &task) {
+                    const detail::worker_identity &worker = detail::current_worker();
+                    const std::size_t own = worker.pool == this ? worker.index : 0;
+
+                    for (std::size_t k = 0; k < _queues.size(); ++k) {
+                        task_queue &queue = _queues[(own + k) % _queues.size()];
+                        std::lock_guard<std::mutex> lock(queue.mutex);
+                        if (queue.tasks.empty()) {
+                            continue;
+                        }
+                        // LIFO on the own deque keeps the working set hot, FIFO steals take the biggest chunks
+                        if (k == 0 && worker.pool == this) {
+                            task = std::move(queue.tasks.back());
+                            queue.tasks.pop_back();
+                        } else {
+                            task = std::move(queue.tasks.front());
+                            queue.tasks.pop_front();
+                        }
+                        std::lock_guard<std::mutex> wake_lock(_wake_mutex);
+                        --_queued;
+                        return true;
+                    }
+                    return false;
+                }
+
+                void worker_loop(std::size_t index) {
+                    detail::current_worker() = {this, index};
+                    detail::current_executor_slot() = this;
+
+                    while (true) {
+                        std::function<void()> task;
+                        if (pop(task)) {
+                            task();
+                            continue;
+                        }
+
+                        std::unique_lock<std::mutex> lock(_wake_mutex);
+                        _wake.wait(lock, [this]() { return _stop || _queued > 0; });
+                        if (_stop && _queued == 0) {
+                            return;
+                        }
+                    }
+                }
+
+                std::vector<task_queue> _queues;
+                std::vector<std::thread> _workers;
+                std::atomic<std::size_t> _next_queue {0};
+
+                std::mutex _wake_mutex;
+                std::condition_variable _wake;
+                std::size_t _queued = 0;
+                bool _stop = false;
+            };
+
+            /** @brief Executor used when none was installed with scoped_executor.
+             *
+             * A process-wide thread_pool over all hardware threads when built with MULTICORE, the calling
+             * thread otherwise, which keeps single-threaded builds free of worker threads.
+             */
+            inline executor &default_executor() {
+#ifdef MULTICORE
+                static thread_pool pool;
+#else
+                static inline_executor pool;
+#endif
+                return pool;
+            }
+
+            inline executor &current_executor() {
+                executor *current = detail::current_executor_slot();
+                return current != nullptr ? *current : default_executor();
+            }
+
+            /** @brief Makes exec the current executor of the calling thread for the lifetime of the object.
+             *
+             * This is how a prover instance is bound to its own pool, e.g. in a server running several
+             * provers with separate thread counts and CPU sets.
+             */
+            class scoped_executor {
+            public:
+                explicit scoped_executor(executor &exec) : _previous(detail::current_executor_slot()) {
+                    detail::current_executor_slot() = &exec;
+                }
+
+                scoped_executor(const scoped_executor &) = delete;
+                scoped_executor &operator=(const scoped_executor &) = delete;
+
+                ~scoped_executor() {
+                    detail::current_executor_slot() = _previous;
+                }
+
+            private:
+                executor *_previous;
+            };
+        }    // namespace parallelization
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PARALLELIZATION_EXECUTOR_HPP
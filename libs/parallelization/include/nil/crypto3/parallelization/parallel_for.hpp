@@ -0,0 +1,185 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_PARALLELIZATION_PARALLEL_FOR_HPP
+#define CRYPTO3_PARALLELIZATION_PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/parallelization/executor.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace parallelization {
+            /** @brief Set of tasks that can be waited for together.
+             *
+             * wait() runs queued tasks of the executor while the group is not done and sleeps while there are
+             * none, then rethrows the first exception thrown by a task of the group. The destructor waits as
+             * well, but drops exceptions.
+             */
+            class task_group {
+            public:
+                explicit task_group(executor &exec = current_executor()) : _executor(exec) {
+                }
+
+                task_group(const task_group &) = delete;
+                task_group &operator=(const task_group &) = delete;
+
+                ~task_group() {
+                    wait_for_tasks();
+                }
+
+                template<typename Function>
+                void run(Function &&function) {
+                    _pending.fetch_add(1, std::memory_order_relaxed);
+                    executor &exec = _executor;
+                    exec.submit([this, &exec, function = std::forward<Function>(function)]() mutable {
+                        try {
+                            function();
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(_exception_mutex);
+                            if (!_exception) {
+                                _exception = std::current_exception();
+                            }
+                        }
+                        // The group may be gone once the counter drops to zero, only exec is used past this point
+                        if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                            exec.notify_waiters();
+                        }
+                    });
+                }
+
+                void wait() {
+                    wait_for_tasks();
+                    if (_exception) {
+                        std::rethrow_exception(std::exchange(_exception, nullptr));
+                    }
+                }
+
+                executor &get_executor() const {
+                    return _executor;
+                }
+
+            private:
+                void wait_for_tasks() {
+                    _executor.run_until([this]() { return _pending.load(std::memory_order_acquire) == 0; });
+                }
+
+                executor &_executor;
+                std::atomic<std::size_t> _pending {0};
+                std::mutex _exception_mutex;
+                std::exception_ptr _exception;
+            };
+
+            namespace detail {
+                // A few chunks per thread, so that stealing can even out chunks of uneven cost
+                inline std::size_t chunks_count(std::size_t size, const executor &exec) {
+                    return std::min(size, 4 * exec.concurrency());
+                }
+            }    // namespace detail
+
+            /** @brief Calls function(begin, end) for consecutive chunks covering [begin, end).
+             *
+             * The calling thread processes the last chunk itself. Runs in place on single-threaded executors.
+             */
+            template<typename RangeFunction>
+            void parallel_for_chunks(std::size_t begin, std::size_t end, const RangeFunction &function,
+                                     executor &exec = current_executor()) {
+                if (begin >= end) {
+                    return;
+                }
+
+                const std::size_t size = end - begin;
+                const std::size_t chunks_count = detail::chunks_count(size, exec);
+                if (chunks_count <= 1) {
+                    function(begin, end);
+                    return;
+                }
+
+                task_group group(exec);
+                for (std::size_t i = 0; i + 1 < chunks_count; ++i) {
+                    const std::size_t chunk_begin = begin + size * i / chunks_count;
+                    const std::size_t chunk_end = begin + size * (i + 1) / chunks_count;
+                    group.run([&function, chunk_begin, chunk_end]() { function(chunk_begin, chunk_end); });
+                }
+                function(begin + size * (chunks_count - 1) / chunks_count, end);
+                group.wait();
+            }
+
+            /** @brief Calls function(i) for every i in [begin, end), possibly on several threads. */
+            template<typename Function>
+            void parallel_for(std::size_t begin, std::size_t end, const Function &function,
+                              executor &exec = current_executor()) {
+                parallel_for_chunks(
+                    begin, end,
+                    [&function](std::size_t chunk_begin, std::size_t chunk_end) {
+                        for (std::size_t i = chunk_begin; i < chunk_end; ++i) {
+                            function(i);
+                        }
+                    },
+                    exec);
+            }
+
+            /** @brief Folds [begin, end) into one value.
+             *
+             * partial(chunk_begin, chunk_end) reduces one chunk, combine(a, b) merges two partial results.
+             * Partial results are combined in chunk order, so the result does not depend on scheduling.
+             */
+            template<typename ValueType, typename RangeFunction, typename Combine>
+            ValueType parallel_reduce(std::size_t begin, std::size_t end, ValueType identity,
+                                      const RangeFunction &partial, const Combine &combine,
+                                      executor &exec = current_executor()) {
+                if (begin >= end) {
+                    return identity;
+                }
+
+                const std::size_t size = end - begin;
+                const std::size_t chunks_count = std::max<std::size_t>(detail::chunks_count(size, exec), 1);
+                std::vector<ValueType> partials(chunks_count, identity);
+
+                parallel_for(
+                    0, chunks_count,
+                    [&](std::size_t i) {
+                        partials[i] = partial(begin + size * i / chunks_count, begin + size * (i + 1) / chunks_count);
+                    },
+                    exec);
+
+                ValueType result = std::move(identity);
+                for (ValueType &value : partials) {
+                    result = combine(std::move(result), std::move(value));
+                }
+                return result;
+            }
+        }    // namespace parallelization
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PARALLELIZATION_PARALLEL_FOR_HPP
@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE parallelization_parallel_for_test
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/parallelization/executor.hpp>
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+using namespace nil::crypto3::parallelization;
+
+BOOST_AUTO_TEST_SUITE(parallelization_test_suite)
+
+BOOST_AUTO_TEST_CASE(parallel_for_visits_every_index_once) {
+    thread_pool pool(4);
+
+    std::vector<std::atomic<std::size_t>> visits(10007);
+    parallel_for(0, visits.size(), [&](std::size_t i) { visits[i].fetch_add(1); }, pool);
+
+    for (const auto &count : visits) {
+        BOOST_CHECK_EQUAL(count.load(), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(nested_parallel_for) {
+    // Inner loops run on the workers of the pool, which must help instead of waiting
+    thread_pool pool(2);
+    scoped_executor scope(pool);
+
+    std::atomic<std::size_t> total {0};
+    parallel_for(0, 64, [&](std::size_t) {
+        parallel_for(0, 64, [&](std::size_t) { total.fetch_add(1); });
+    });
+
+    BOOST_CHECK_EQUAL(total.load(), 64 * 64);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_reduce_sum) {
+    thread_pool pool(3);
+
+    const std::size_t n = 100000;
+    const std::size_t sum = parallel_reduce(
+        0, n, std::size_t(0),
+        [](std::size_t begin, std::size_t end) {
+            std::size_t partial = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                partial += i;
+            }
+            return partial;
+        },
+        [](std::size_t a, std::size_t b) { return a + b; }, pool);
+
+    BOOST_CHECK_EQUAL(sum, n * (n - 1) / 2);
+}
+
+BOOST_AUTO_TEST_CASE(task_group_rethrows) {
+    thread_pool pool(2);
+    task_group group(pool);
+
+    std::atomic<std::size_t> done {0};
+    for (std::size_t i = 0; i < 16; ++i) {
+        group.run([&done, i]() {
+            if (i == 5) {
+                throw std::runtime_error("task failed");
+            }
+            done.fetch_add(1);
+        });
+    }
+
+    BOOST_CHECK_THROW(group.wait(), std::runtime_error);
+    BOOST_CHECK_EQUAL(done.load(), 15);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
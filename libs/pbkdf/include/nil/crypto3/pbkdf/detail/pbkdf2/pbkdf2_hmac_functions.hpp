@@ -0,0 +1,249 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_PBKDF_PBKDF2_HMAC_FUNCTIONS_HPP
+#define CRYPTO3_PBKDF_PBKDF2_HMAC_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/octet.hpp>
+#include <nil/crypto3/detail/pack.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pbkdf {
+            namespace detail {
+                /*!
+                 * @brief PBKDF2 over HMAC driven directly by the Merkle-Damgård construction of Hash.
+                 *
+                 * The inner and outer key pads are compressed once per password and their chaining
+                 * states (midstates) are reused for every HMAC invocation. Each PBKDF2 iteration then
+                 * costs exactly two compressions instead of four, and the iterated value is kept as
+                 * a block of hash words so no byte buffers get allocated in the loop.
+                 *
+                 * @tparam Hash Merkle-Damgård hash (SHA-1, SHA-2, MD5, ...)
+                 */
+                template<typename Hash>
+                struct pbkdf2_hmac_functions {
+                    typedef Hash hash_type;
+                    typedef typename hash_type::construction::type construction_type;
+                    typedef typename construction_type::endian_type endian_type;
+
+                    constexpr static const std::size_t word_bits = construction_type::word_bits;
+                    typedef typename construction_type::word_type word_type;
+
+                    constexpr static const std::size_t block_bits = construction_type::block_bits;
+                    constexpr static const std::size_t block_words = construction_type::block_words;
+                    constexpr static const std::size_t block_octets = block_bits / octet_bits;
+                    typedef typename construction_type::block_type block_type;
+
+                    typedef typename construction_type::state_type state_type;
+
+                    constexpr static const std::size_t digest_bits = construction_type::digest_bits;
+                    constexpr static const std::size_t digest_octets = digest_bits / octet_bits;
+                    constexpr static const std::size_t digest_words = digest_bits / word_bits;
+                    typedef typename construction_type::digest_type digest_type;
+
+                    // The iterated HMAC message (one digest) plus padding has to fit into a single block
+                    BOOST_STATIC_ASSERT(digest_bits % word_bits == 0);
+                    BOOST_STATIC_ASSERT(2 * digest_bits <= block_bits);
+
+                    typedef std::array<std::uint8_t, block_octets> octet_block_type;
+
+                    struct midstate_type {
+                        state_type inner;
+                        state_type outer;
+                    };
+
+                    /*!
+                     * @brief Compresses the HMAC key pads of password once.
+                     */
+                    template<typename PasswordRange>
+                    static midstate_type precompute(const PasswordRange &password) {
+                        constexpr std::uint8_t ipad = 0x36;
+                        constexpr std::uint8_t opad = 0x5C;
+
+                        octet_block_type key;
+                        key.fill(0);
+
+                        if (static_cast<std::size_t>(std::distance(std::begin(password), std::end(password))) >
+                            block_octets) {
+                            digest_type hashed_key = hash<hash_type>(password);
+                            std::copy(hashed_key.begin(), hashed_key.end(), key.begin());
+                        } else {
+                            std::copy(std::begin(password), std::end(password), key.begin());
+                        }
+
+                        octet_block_type pad;
+                        block_type block;
+                        midstate_type m;
+                        construction_type c;
+
+                        std::transform(key.begin(), key.end(), pad.begin(),
+                                       [](std::uint8_t v) { return static_cast<std::uint8_t>(v ^ ipad); });
+                        ::nil::crypto3::detail::pack_to<endian_type, octet_bits, word_bits>(pad.begin(), pad.end(),
+                                                                                          block.begin());
+                        c.reset();
+                        c.process_block(block);
+                        m.inner = c.state();
+
+                        std::transform(key.begin(), key.end(), pad.begin(),
+                                       [](std::uint8_t v) { return static_cast<std::uint8_t>(v ^ opad); });
+                        ::nil::crypto3::detail::pack_to<endian_type, octet_bits, word_bits>(pad.begin(), pad.end(),
+                                                                                          block.begin());
+                        c.reset();
+                        c.process_block(block);
+                        m.outer = c.state();
+
+                        key.fill(0);
+                        pad.fill(0);
+
+                        return m;
+                    }
+
+                    /*!
+                     * @brief HMAC of an arbitrary message under cached midstates.
+                     */
+                    static digest_type hmac(const midstate_type &m, const std::uint8_t *message, std::size_t length) {
+                        construction_type c;
+                        octet_block_type octets;
+                        block_type block;
+
+                        c.reset(m.inner);
+                        std::size_t processed = 0;
+                        for (; length - processed >= block_octets; processed += block_octets) {
+                            ::nil::crypto3::detail::pack_to<endian_type, octet_bits, word_bits>(
+                                message + processed, message + processed + block_octets, block.begin());
+                            c.process_block(block);
+                        }
+
+                        octets.fill(0);
+                        std::copy(message + processed, message + length, octets.begin());
+                        ::nil::crypto3::detail::pack_to<endian_type, octet_bits, word_bits>(octets.begin(), octets.end(),
+                                                                                          block.begin());
+                        digest_type inner = c.digest(block, block_bits + length * octet_bits);
+
+                        return outer_digest(m, inner, block);
+                    }
+
+                    /*!
+                     * @brief One PBKDF2 output block T_index = U_1 ^ U_2 ^ ... ^ U_iterations.
+                     * @throws std::invalid_argument if iterations is 0
+                     */
+                    template<typename SaltRange>
+                    static void derive_block(const midstate_type &m, const SaltRange &salt, std::size_t iterations,
+                                             std::uint32_t index, std::uint8_t *out, std::size_t out_len) {
+                        check_iterations(iterations);
+
+                        std::vector<std::uint8_t> message(std::begin(salt), std::end(salt));
+                        message.push_back(static_cast<std::uint8_t>(index >> 24));
+                        message.push_back(static_cast<std::uint8_t>(index >> 16));
+                        message.push_back(static_cast<std::uint8_t>(index >> 8));
+                        message.push_back(static_cast<std::uint8_t>(index));
+
+                        digest_type u = hmac(m, message.data(), message.size());
+                        digest_type t = u;
+
+                        block_type block;
+                        std::fill(block.begin(), block.end(), 0);
+
+                        construction_type c;
+                        for (std::size_t i = 1; i != iterations; ++i) {
+                            ::nil::crypto3::detail::pack_to<endian_type, octet_bits, word_bits>(u.begin(), u.end(),
+                                                                                              block.begin());
+                            c.reset(m.inner);
+                            u = outer_digest(m, c.digest(block, block_bits + digest_bits), block);
+
+                            for (std::size_t j = 0; j != digest_octets; ++j) {
+                                t[j] ^= u[j];
+                            }
+                        }
+
+                        std::copy(t.begin(), t.begin() + out_len, out);
+                    }
+
+                    /*!
+                     * @brief Full PBKDF2 output, independent output blocks are computed in parallel.
+                     * @throws std::invalid_argument if iterations is 0
+                     */
+                    template<typename SaltRange>
+                    static void derive(const midstate_type &m, const SaltRange &salt, std::size_t iterations,
+                                       std::uint8_t *out, std::size_t out_len) {
+                        check_iterations(iterations);
+                        check_key_length(out_len);
+
+                        const std::size_t blocks = (out_len + digest_octets - 1) / digest_octets;
+
+                        parallelization::parallel_for(0, blocks, [&](std::size_t i) {
+                            const std::size_t offset = i * digest_octets;
+                            derive_block(m, salt, iterations, static_cast<std::uint32_t>(i + 1), out + offset,
+                                         std::min(digest_octets, out_len - offset));
+                        });
+                    }
+
+                    static void check_iterations(std::size_t iterations) {
+                        if (iterations == 0) {
+                            throw std::invalid_argument("PBKDF2 iteration count must be positive");
+                        }
+                    }
+
+                    // RFC 8018, section 5.2, step 1: at most 2^32 - 1 blocks, the block index is 32 bits wide
+                    static void check_key_length(std::size_t out_len) {
+                        if (out_len / digest_octets + (out_len % digest_octets != 0) >
+                            std::numeric_limits<std::uint32_t>::max()) {
+                            throw std::invalid_argument("PBKDF2 derived key too long");
+                        }
+                    }
+
+                protected:
+                    static digest_type outer_digest(const midstate_type &m, const digest_type &inner,
+                                                    block_type &block) {
+                        construction_type c;
+
+                        std::fill(block.begin(), block.end(), 0);
+                        ::nil::crypto3::detail::pack_to<endian_type, octet_bits, word_bits>(inner.begin(), inner.end(),
+                                                                                          block.begin());
+                        c.reset(m.outer);
+                        return c.digest(block, block_bits + digest_bits);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace pbkdf
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PBKDF_PBKDF2_HMAC_FUNCTIONS_HPP
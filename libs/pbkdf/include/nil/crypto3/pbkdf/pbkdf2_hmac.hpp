@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_PBKDF_PBKDF2_HMAC_HPP
+#define CRYPTO3_PBKDF_PBKDF2_HMAC_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <nil/crypto3/pbkdf/detail/pbkdf2/pbkdf2_hmac_functions.hpp>
+
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pbkdf {
+            /*!
+             * @brief PBKDF2 (RFC 8018) with HMAC over a Merkle-Damgård hash. The password's HMAC midstates
+             * are computed once on construction, so one instance derives keys for many salts/iterations
+             * without re-hashing the key pads.
+             * @tparam Hash
+             * @ingroup pbkdf
+             */
+            template<typename Hash>
+            class pbkdf2_hmac {
+                typedef detail::pbkdf2_hmac_functions<Hash> policy_type;
+
+            public:
+                typedef typename policy_type::hash_type hash_type;
+                typedef typename policy_type::midstate_type midstate_type;
+
+                constexpr static const std::size_t digest_bits = policy_type::digest_bits;
+                typedef typename policy_type::digest_type digest_type;
+
+                template<typename PasswordRange>
+                explicit pbkdf2_hmac(const PasswordRange &password) : midstate(policy_type::precompute(password)) {
+                }
+
+                /*!
+                 * @brief Writes std::distance(first, last) bytes of derived key. Throws std::invalid_argument
+                 * for a zero iteration count or a key longer than 2^32 - 1 digests.
+                 */
+                template<typename SaltRange, typename OutputIterator>
+                void derive(const SaltRange &salt, std::size_t iterations, OutputIterator first,
+                            OutputIterator last) const {
+                    policy_type::check_key_length(std::distance(first, last));
+                    std::vector<std::uint8_t> out(std::distance(first, last));
+                    policy_type::derive(midstate, salt, iterations, out.data(), out.size());
+                    std::copy(out.begin(), out.end(), first);
+                }
+
+                template<typename SaltRange>
+                std::vector<std::uint8_t> derive(const SaltRange &salt, std::size_t iterations,
+                                                 std::size_t length) const {
+                    policy_type::check_key_length(length);
+                    std::vector<std::uint8_t> out(length);
+                    policy_type::derive(midstate, salt, iterations, out.data(), out.size());
+                    return out;
+                }
+
+                /*!
+                 * @brief Checks a batch of credentials. Each element has to expose password, salt,
+                 * iterations and derived_key members. Credentials are independent and get checked in
+                 * parallel; the comparison of derived keys is constant time. Credentials with a zero
+                 * iteration count are rejected.
+                 * @return Vector of flags, non-zero where the stored derived key matches
+                 */
+                template<typename CredentialRange>
+                static std::vector<std::uint8_t> verify(const CredentialRange &credentials) {
+                    typedef typename std::iterator_traits<decltype(std::begin(credentials))>::value_type
+                        credential_type;
+
+                    std::vector<const credential_type *> items;
+                    for (const auto &credential : credentials) {
+                        items.push_back(&credential);
+                    }
+
+                    const std::size_t n = items.size();
+                    std::vector<std::uint8_t> result(n, 0);
+
+                    parallelization::parallel_for(0, n, [&](std::size_t i) {
+                        const credential_type &credential = *items[i];
+                        if (credential.iterations == 0) {
+                            return;
+                        }
+
+                        const midstate_type m = policy_type::precompute(credential.password);
+                        const std::size_t length =
+                            std::distance(std::begin(credential.derived_key), std::end(credential.derived_key));
+                        std::vector<std::uint8_t> derived(length);
+                        policy_type::derive(m, credential.salt, credential.iterations, derived.data(), length);
+
+                        std::uint8_t diff = 0;
+                        auto expected = std::begin(credential.derived_key);
+                        for (std::size_t j = 0; j != length; ++j, ++expected) {
+                            diff |= derived[j] ^ static_cast<std::uint8_t>(*expected);
+                        }
+                        result[i] = (diff == 0);
+                    });
+
+                    return result;
+                }
+
+            protected:
+                midstate_type midstate;
+            };
+        }    // namespace pbkdf
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PBKDF_PBKDF2_HMAC_HPP
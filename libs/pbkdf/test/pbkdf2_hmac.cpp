@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE pbkdf2_hmac_test
+
+#include <nil/crypto3/pbkdf/pbkdf2_hmac.hpp>
+
+#include <nil/crypto3/hash/sha1.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/data/monomorphic.hpp>
+
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace nil::crypto3;
+
+std::string to_hex(const std::vector<std::uint8_t> &v) {
+    static const char *digits = "0123456789abcdef";
+    std::string result;
+    for (std::uint8_t b : v) {
+        result.push_back(digits[b >> 4]);
+        result.push_back(digits[b & 0x0f]);
+    }
+    return result;
+}
+
+struct credential {
+    std::string password;
+    std::string salt;
+    std::size_t iterations;
+    std::vector<std::uint8_t> derived_key;
+};
+
+BOOST_AUTO_TEST_SUITE(pbkdf2_hmac_test_suite)
+
+    // RFC 6070
+    BOOST_AUTO_TEST_CASE(pbkdf2_hmac_sha1_test) {
+        pbkdf::pbkdf2_hmac<hashes::sha1> kdf(std::string("password"));
+
+        BOOST_CHECK_EQUAL(to_hex(kdf.derive(std::string("salt"), 1, 20)), "0c60c80f961f0e71f3a9b524af6012062fe037a6");
+        BOOST_CHECK_EQUAL(to_hex(kdf.derive(std::string("salt"), 2, 20)), "ea6c014dc72d6f8ccd1ed92ace1d41f0d8de8957");
+        BOOST_CHECK_EQUAL(to_hex(kdf.derive(std::string("salt"), 4096, 20)),
+                          "4b007901b765489abead49d926f721d065a429c1");
+
+        pbkdf::pbkdf2_hmac<hashes::sha1> long_kdf(std::string("passwordPASSWORDpassword"));
+        BOOST_CHECK_EQUAL(to_hex(long_kdf.derive(std::string("saltSALTsaltSALTsaltSALTsaltSALTsalt"), 4096, 25)),
+                          "3d2eec4fe41c849b80c8d83662c0e44a8b291a964cf2f07038");
+    }
+
+    // RFC 7914, section 11
+    BOOST_AUTO_TEST_CASE(pbkdf2_hmac_sha256_test) {
+        pbkdf::pbkdf2_hmac<hashes::sha2<256>> kdf(std::string("passwd"));
+
+        BOOST_CHECK_EQUAL(to_hex(kdf.derive(std::string("salt"), 1, 64)),
+                          "55ac046e56e3089fec1691c22544b605f94185216dde0465e68b9d57c20dacbc"
+                          "49ca9cccf179b645991664b39d77ef317c71b845b1e30bd509112041d3a19783");
+    }
+
+    BOOST_AUTO_TEST_CASE(pbkdf2_hmac_verify_test) {
+        pbkdf::pbkdf2_hmac<hashes::sha2<256>> kdf(std::string("passwd"));
+
+        std::vector<credential> credentials = {
+            {"passwd", "salt", 3, kdf.derive(std::string("salt"), 3, 40)},
+            {"wrong", "salt", 3, kdf.derive(std::string("salt"), 3, 40)},
+            {"passwd", "pepper", 7, kdf.derive(std::string("pepper"), 7, 32)},
+        };
+
+        std::vector<std::uint8_t> result = pbkdf::pbkdf2_hmac<hashes::sha2<256>>::verify(credentials);
+        BOOST_CHECK(result == std::vector<std::uint8_t>({1, 0, 1}));
+    }
+
+    BOOST_AUTO_TEST_CASE(pbkdf2_hmac_key_too_long_test) {
+        pbkdf::pbkdf2_hmac<hashes::sha2<256>> kdf(std::string("passwd"));
+
+        // RFC 8018, section 5.2, step 1: dkLen > (2^32 - 1) * hLen
+        const std::uint64_t max_length = std::uint64_t(std::numeric_limits<std::uint32_t>::max()) * 32;
+        if (max_length < std::numeric_limits<std::size_t>::max()) {
+            BOOST_CHECK_THROW(kdf.derive(std::string("salt"), 1, std::size_t(max_length + 1)), std::invalid_argument);
+            BOOST_CHECK_THROW(kdf.derive(std::string("salt"), 1, std::numeric_limits<std::size_t>::max()),
+                              std::invalid_argument);
+        }
+        BOOST_CHECK(kdf.derive(std::string("salt"), 1, 33).size() == 33);
+    }
+
+    BOOST_AUTO_TEST_CASE(pbkdf2_hmac_zero_iterations_test) {
+        pbkdf::pbkdf2_hmac<hashes::sha2<256>> kdf(std::string("passwd"));
+
+        BOOST_CHECK_THROW(kdf.derive(std::string("salt"), 0, 32), std::invalid_argument);
+
+        std::list<credential> credentials = {
+            {"passwd", "salt", 0, kdf.derive(std::string("salt"), 1, 32)},
+            {"passwd", "salt", 2, kdf.derive(std::string("salt"), 2, 32)},
+        };
+
+        std::vector<std::uint8_t> result = pbkdf::pbkdf2_hmac<hashes::sha2<256>>::verify(credentials);
+        BOOST_CHECK(result == std::vector<std::uint8_t>({0, 1}));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,9 +26,16 @@
 #ifndef CRYPTO3_PUBKEY_FELDMAN_SSS_HPP
 #define CRYPTO3_PUBKEY_FELDMAN_SSS_HPP
 
+#include <algorithm>
+
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
 
 #include <nil/crypto3/pubkey/operations/verify_share_op.hpp>
+#include <nil/crypto3/pubkey/operations/batch_verify_shares_op.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -198,6 +205,198 @@ namespace nil {
                 }
             };
 
+            /**
+             * Verifies n shares against t public coefficients at once. Shares are combined with random weights
+             * r_k, so that for secret shares it is enough to check
+             *     (sum_k r_k * s_k) * G == sum_j (sum_k r_k * i_k^j) * C_j,
+             * that is one multiexponentiation of size t and one fixed-base multiplication instead of n * t
+             * multiplications. Public shares are folded into the multiexponentiation itself, which then has to
+             * give zero. A failed check is bisected with the same weights to find the invalid shares.
+             */
+            template<typename Group>
+            struct batch_verify_shares_op<feldman_sss<Group>> {
+                typedef feldman_sss<Group> scheme_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+                typedef typename scheme_type::public_element_type public_element_type;
+                // indexes of the invalid shares, empty if all of them are valid
+                typedef std::vector<std::size_t> result_type;
+
+            protected:
+                typedef std::pair<std::size_t, private_element_type> indexed_private_element_type;
+                typedef std::pair<std::size_t, public_element_type> indexed_public_element_type;
+
+                template<typename Generator =
+                             random::algebraic_random_device<typename private_element_type::field_type>>
+                static inline std::vector<private_element_type> _get_weights(std::size_t n) {
+                    std::vector<private_element_type> weights;
+                    weights.reserve(n);
+                    Generator gen;
+                    for (std::size_t k = 0; k < n; ++k) {
+                        weights.emplace_back(gen());
+                    }
+                    return weights;
+                }
+
+                // exps[j] = sum_k r_k * i_k^j over shares [first, last)
+                template<typename PublicCoeffs, typename IndexedElement>
+                static inline std::vector<private_element_type>
+                    _get_exps(const PublicCoeffs &public_coeffs, const std::vector<IndexedElement> &shares,
+                              const std::vector<private_element_type> &weights, std::size_t first, std::size_t last) {
+                    std::vector<private_element_type> exps(std::size(public_coeffs), private_element_type::zero());
+                    for (std::size_t k = first; k < last; ++k) {
+                        const private_element_type index(shares[k].first);
+                        private_element_type power = weights[k];
+                        for (auto &exp : exps) {
+                            exp += power;
+                            power *= index;
+                        }
+                    }
+                    return exps;
+                }
+
+                template<typename PublicCoeffs>
+                static inline bool _check(const PublicCoeffs &public_coeffs,
+                                          const std::vector<indexed_private_element_type> &shares,
+                                          const std::vector<private_element_type> &weights, std::size_t first,
+                                          std::size_t last) {
+                    private_element_type combined_share = private_element_type::zero();
+                    for (std::size_t k = first; k < last; ++k) {
+                        combined_share += weights[k] * shares[k].second;
+                    }
+                    std::vector<private_element_type> exps = _get_exps(public_coeffs, shares, weights, first, last);
+
+                    return algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                               std::cbegin(public_coeffs), std::cend(public_coeffs), exps.cbegin(), exps.cend(),
+                               1) == scheme_type::get_public_element(combined_share);
+                }
+
+                template<typename PublicCoeffs>
+                static inline bool _check(const PublicCoeffs &public_coeffs,
+                                          const std::vector<indexed_public_element_type> &public_shares,
+                                          const std::vector<private_element_type> &weights, std::size_t first,
+                                          std::size_t last) {
+                    std::vector<public_element_type> bases(std::cbegin(public_coeffs), std::cend(public_coeffs));
+                    std::vector<private_element_type> exps =
+                        _get_exps(public_coeffs, public_shares, weights, first, last);
+                    for (std::size_t k = first; k < last; ++k) {
+                        bases.emplace_back(public_shares[k].second);
+                        exps.emplace_back(-weights[k]);
+                    }
+
+                    return algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                               bases.cbegin(), bases.cend(), exps.cbegin(), exps.cend(), 1)
+                        .is_zero();
+                }
+
+                // Appends the positions of the invalid shares in [first, last). If the check of the left half passes,
+                // the right half is known to be invalid and is split without checking it as a whole.
+                template<typename PublicCoeffs, typename IndexedElement>
+                static inline void _find_invalid(const PublicCoeffs &public_coeffs,
+                                                 const std::vector<IndexedElement> &shares,
+                                                 const std::vector<private_element_type> &weights, std::size_t first,
+                                                 std::size_t last, bool is_invalid, std::vector<std::size_t> &invalid) {
+                    if (first == last || (!is_invalid && _check(public_coeffs, shares, weights, first, last))) {
+                        return;
+                    }
+                    if (last - first == 1) {
+                        invalid.emplace_back(first);
+                        return;
+                    }
+
+                    std::size_t middle = first + (last - first) / 2;
+                    bool is_left_valid = _check(public_coeffs, shares, weights, first, middle);
+                    if (!is_left_valid) {
+                        _find_invalid(public_coeffs, shares, weights, first, middle, true, invalid);
+                    }
+                    _find_invalid(public_coeffs, shares, weights, middle, last, is_left_valid, invalid);
+                }
+
+                // The random weights only bind the prime order component of a point, so points with a small order
+                // component are rejected before they reach a batch
+                template<typename PublicCoeffs>
+                static inline bool _is_admissible_coeffs(const PublicCoeffs &public_coeffs) {
+                    for (const auto &coeff : public_coeffs) {
+                        if (!algebra::curves::detail::subgroup_check(coeff)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                static inline bool _is_admissible_share(const private_element_type &) {
+                    return true;
+                }
+
+                static inline bool _is_admissible_share(const public_element_type &public_share) {
+                    return algebra::curves::detail::subgroup_check(public_share);
+                }
+
+                // shares are (index, value) pairs of single shamir shares, owners[k] is the index reported for shares[k]
+                template<typename PublicCoeffs, typename IndexedElement>
+                static inline result_type _process(const PublicCoeffs &public_coeffs,
+                                                   const std::vector<IndexedElement> &shares,
+                                                   const std::vector<std::size_t> &owners) {
+                    assert(std::size(shares) == std::size(owners));
+
+                    result_type result;
+                    if (!_is_admissible_coeffs(public_coeffs)) {
+                        // no share can be verified against such coefficients
+                        result = owners;
+                    } else {
+                        std::vector<IndexedElement> admitted_shares;
+                        std::vector<std::size_t> admitted_owners;
+                        for (std::size_t k = 0; k < std::size(shares); ++k) {
+                            if (_is_admissible_share(shares[k].second)) {
+                                admitted_shares.emplace_back(shares[k]);
+                                admitted_owners.emplace_back(owners[k]);
+                            } else {
+                                result.emplace_back(owners[k]);
+                            }
+                        }
+
+                        std::vector<std::size_t> invalid;
+                        _find_invalid(public_coeffs, admitted_shares, _get_weights(std::size(admitted_shares)), 0,
+                                      std::size(admitted_shares), false, invalid);
+                        for (std::size_t k : invalid) {
+                            result.emplace_back(admitted_owners[k]);
+                        }
+                    }
+
+                    std::sort(result.begin(), result.end());
+                    result.erase(std::unique(result.begin(), result.end()), result.end());
+                    return result;
+                }
+
+                template<typename PublicCoeffs, typename Shares>
+                static inline result_type _process(const PublicCoeffs &public_coeffs, const Shares &shares) {
+                    typedef typename std::iterator_traits<decltype(std::cbegin(shares))>::value_type share_type;
+                    typedef std::pair<std::size_t, typename share_type::value_type> indexed_element_type;
+
+                    std::vector<indexed_element_type> indexed_shares;
+                    std::vector<std::size_t> owners;
+                    for (const auto &share : shares) {
+                        indexed_shares.emplace_back(share.get_index(), share.get_value());
+                        owners.emplace_back(share.get_index());
+                    }
+                    return _process(public_coeffs, indexed_shares, owners);
+                }
+
+            public:
+                /**
+                 * @param public_coeffs public coefficients of the dealt polynomial
+                 * @param shares range of share_sss or public_share_sss of the scheme
+                 * @return sorted indexes of the shares which do not lie on the polynomial or are not in the prime
+                 * order subgroup, or of all shares if a public coefficient is not in it
+                 */
+                template<typename PublicCoeffs, typename Shares>
+                static inline result_type process(const PublicCoeffs &public_coeffs, const Shares &shares) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicCoeffs>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Shares>));
+
+                    return _process(public_coeffs, shares);
+                }
+            };
+
             template<typename Group>
             struct reconstruct_public_secret_op<feldman_sss<Group>>
                 : public reconstruct_public_secret_op<shamir_sss<Group>> {
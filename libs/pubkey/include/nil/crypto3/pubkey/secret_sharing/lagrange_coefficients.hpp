@@ -0,0 +1,186 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_HPP
+#define CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/algebra/algorithms/batch_inverse.hpp>
+
+#include <nil/crypto3/math/polynomial/subproduct_tree.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            /**
+             * Lagrange coefficients at zero for sets of participant indexes:
+             *     lambda_i = prod_{j != i} x_j / (x_j - x_i).
+             * Numerators are built from prefix and suffix products of the indexes. With m = prod_j (x - x_j),
+             * the denominators are (-1)^(t - 1) m'(x_i), evaluated at all indexes at once over a subproduct
+             * tree and inverted with one batch inversion, O(t log^2 t) for a set of t indexes.
+             *
+             * For participants 1..n the inverted denominators of the full set,
+             *     1 / prod_{j in [1, n], j != i} (j - i) = (-1)^(i - 1) / ((i - 1)! * (n - i)!),
+             * are cached on construction with a single inversion. A set S which misses fewer indexes than it
+             * contains only multiplies back the factors prod_m (m - i) of the missing indexes m, which is the
+             * vanishing polynomial of the missing indexes evaluated at S, and needs no inversion. Build one
+             * instance per n and reuse it.
+             */
+            template<typename FieldType>
+            class lagrange_coefficients {
+            public:
+                typedef FieldType field_type;
+                typedef typename field_type::value_type value_type;
+
+                explicit lagrange_coefficients(std::size_t n = 0) : inversed_denoms(n) {
+                    if (n == 0) {
+                        return;
+                    }
+
+                    // inversed_factorials[k] = 1 / k!
+                    std::vector<value_type> inversed_factorials(n, value_type::one());
+                    for (std::size_t k = 1; k < n; ++k) {
+                        inversed_factorials[k] = inversed_factorials[k - 1] * value_type(k);
+                    }
+                    inversed_factorials[n - 1] = inversed_factorials[n - 1].inversed();
+                    for (std::size_t k = n - 1; k > 1; --k) {
+                        inversed_factorials[k - 1] = inversed_factorials[k] * value_type(k);
+                    }
+
+                    for (std::size_t i = 1; i <= n; ++i) {
+                        inversed_denoms[i - 1] = inversed_factorials[i - 1] * inversed_factorials[n - i];
+                        if (i % 2 == 0) {
+                            inversed_denoms[i - 1] = -inversed_denoms[i - 1];
+                        }
+                    }
+                }
+
+                inline std::size_t max_index() const {
+                    return inversed_denoms.size();
+                }
+
+                /**
+                 * @param indexes distinct non-zero participant indexes
+                 * @return coefficients in the order of indexes
+                 * @throws std::invalid_argument if indexes contains 0
+                 */
+                template<typename Indexes>
+                std::vector<value_type> operator()(const Indexes &indexes) const {
+                    std::vector<std::size_t> xs(std::cbegin(indexes), std::cend(indexes));
+                    const std::size_t t = xs.size();
+                    if (t == 0) {
+                        return {};
+                    }
+                    if (std::find(xs.cbegin(), xs.cend(), 0) != xs.cend()) {
+                        throw std::invalid_argument("lagrange_coefficients: participant index 0 is not allowed");
+                    }
+
+                    // numerators[k] = prod_{l != k} x_l
+                    std::vector<value_type> numerators(t, value_type::one());
+                    value_type acc = value_type::one();
+                    for (std::size_t k = 0; k < t; ++k) {
+                        numerators[k] = acc;
+                        acc = acc * value_type(xs[k]);
+                    }
+                    acc = value_type::one();
+                    for (std::size_t k = t; k > 0; --k) {
+                        numerators[k - 1] = numerators[k - 1] * acc;
+                        acc = acc * value_type(xs[k - 1]);
+                    }
+
+                    std::vector<value_type> points;
+                    points.reserve(t);
+                    for (std::size_t x : xs) {
+                        points.emplace_back(x);
+                    }
+
+                    const std::size_t max_x = *std::max_element(xs.cbegin(), xs.cend());
+                    const std::size_t n = max_index();
+                    if (max_x <= n && n - t < t) {
+                        std::vector<bool> is_present(n + 1, false);
+                        for (std::size_t x : xs) {
+                            is_present[x] = true;
+                        }
+                        std::vector<value_type> missing;
+                        for (std::size_t m = 1; m <= n; ++m) {
+                            if (!is_present[m]) {
+                                missing.emplace_back(m);
+                            }
+                        }
+
+                        for (std::size_t k = 0; k < t; ++k) {
+                            numerators[k] = numerators[k] * inversed_denoms[xs[k] - 1];
+                        }
+                        if (missing.empty()) {
+                            return numerators;
+                        }
+
+                        // prod_m (m - x_k) = (-1)^|missing| * prod_m (x_k - m)
+                        const std::vector<value_type> missing_factors =
+                            math::subproduct_tree<value_type>(points).evaluate(
+                                math::subproduct_tree<value_type>(missing).vanishing_polynomial());
+                        for (std::size_t k = 0; k < t; ++k) {
+                            numerators[k] = numerators[k] * missing_factors[k];
+                            if (missing.size() % 2 == 1) {
+                                numerators[k] = -numerators[k];
+                            }
+                        }
+                        return numerators;
+                    }
+
+                    typedef math::subproduct_tree<value_type> tree_type;
+
+                    const tree_type tree(points);
+                    const typename tree_type::polynomial_type vanishing = tree.vanishing_polynomial();
+                    std::vector<value_type> derivative(vanishing.size() - 1);
+                    for (std::size_t i = 1; i < vanishing.size(); ++i) {
+                        derivative[i - 1] = vanishing[i] * value_type(i);
+                    }
+
+                    // prod_{l != k} (x_l - x_k) = (-1)^(t - 1) m'(x_k)
+                    std::vector<value_type> denoms = tree.evaluate(typename tree_type::polynomial_type(derivative));
+                    algebra::batch_inverse(denoms, 1);
+                    for (std::size_t k = 0; k < t; ++k) {
+                        numerators[k] = numerators[k] * denoms[k];
+                        if (t % 2 == 0) {
+                            numerators[k] = -numerators[k];
+                        }
+                    }
+                    return numerators;
+                }
+
+            private:
+                // inversed_denoms[i - 1] = 1 / prod_{j in [1, n], j != i} (j - i)
+                std::vector<value_type> inversed_denoms;
+            };
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_HPP
@@ -201,6 +201,21 @@ namespace nil {
                 }
             };
 
+            template<typename Group>
+            struct batch_verify_shares_op<pedersen_dkg<Group>> : public batch_verify_shares_op<feldman_sss<Group>> {
+                typedef batch_verify_shares_op<feldman_sss<Group>> base_type;
+                typedef pedersen_dkg<Group> scheme_type;
+                typedef typename base_type::result_type result_type;
+
+                template<typename PublicCoeffs, typename Shares>
+                static inline result_type process(const PublicCoeffs &public_coeffs, const Shares &shares) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicCoeffs>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Shares>));
+
+                    return base_type::_process(public_coeffs, shares);
+                }
+            };
+
             template<typename Group>
             struct reconstruct_public_secret_op<pedersen_dkg<Group>>
                 : public reconstruct_public_secret_op<shamir_sss<Group>> {
@@ -27,6 +27,7 @@
 #define CRYPTO3_PUBKEY_SHAMIR_SSS_HPP
 
 #include <vector>
+#include <algorithm>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -40,6 +41,9 @@
 
 #include <nil/crypto3/random/algebraic_random_device.hpp>
 
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
 #include <nil/crypto3/pubkey/operations/deal_shares_op.hpp>
 #include <nil/crypto3/pubkey/operations/reconstruct_secret_op.hpp>
 #include <nil/crypto3/pubkey/operations/reconstruct_public_secret_op.hpp>
@@ -50,6 +54,7 @@
 #include <nil/crypto3/pubkey/keys/public_secret_sss.hpp>
 
 #include <nil/crypto3/pubkey/secret_sharing/weighted_basic_policy.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/lagrange_coefficients.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -70,14 +75,75 @@ namespace nil {
                     assert(basic_policy::check_participant_index(i));
 
                     typename basic_policy::private_element_type e_i(i);
-                    typename basic_policy::private_element_type result = basic_policy::private_element_type::one();
+                    typename basic_policy::private_element_type nom = basic_policy::private_element_type::one();
+                    typename basic_policy::private_element_type denom = basic_policy::private_element_type::one();
 
+                    // accumulate numerator and denominator separately to pay for a single inversion
                     for (auto j : indexes) {
                         if (j != i) {
-                            result = result * (typename basic_policy::private_element_type(j) *
-                                               (typename basic_policy::private_element_type(j) - e_i).inversed());
+                            nom = nom * typename basic_policy::private_element_type(j);
+                            denom = denom * (typename basic_policy::private_element_type(j) - e_i);
                         }
                     }
+                    return nom * denom.inversed();
+                }
+
+                typedef lagrange_coefficients<typename basic_policy::private_element_type::field_type>
+                    lagrange_coefficients_type;
+
+                // per-thread Lagrange coefficients instance covering participants 1..n, rebuilt only when a larger
+                // participant index is requested. Its size follows the largest index, so sets whose largest index
+                // exceeds lagrange_cache_factor times their size use an empty instance, which falls back to the
+                // subproduct tree.
+                constexpr static const std::size_t lagrange_cache_factor = 4;
+
+                static inline const lagrange_coefficients_type &
+                    get_lagrange_coefficients(const typename basic_policy::indexes_type &indexes) {
+                    static thread_local lagrange_coefficients_type coefficients;
+                    static const lagrange_coefficients_type uncached;
+                    const std::size_t n = indexes.empty() ? 0 : *indexes.rbegin();
+                    if (n > lagrange_cache_factor * indexes.size()) {
+                        return uncached;
+                    }
+                    if (coefficients.max_index() < n) {
+                        coefficients = lagrange_coefficients_type(n);
+                    }
+                    return coefficients;
+                }
+
+                // basis polynomials of all indexes evaluated at zero, in increasing order of indexes
+                static inline std::vector<typename basic_policy::private_element_type>
+                    eval_basis_polys(const lagrange_coefficients_type &coefficients,
+                                     const typename basic_policy::indexes_type &indexes) {
+                    return coefficients(indexes);
+                }
+
+                static inline std::vector<typename basic_policy::private_element_type>
+                    eval_basis_polys(const typename basic_policy::indexes_type &indexes) {
+                    return eval_basis_polys(get_lagrange_coefficients(indexes), indexes);
+                }
+
+                // basis polynomials of the set indexes evaluated at zero, in the order of selected_indexes
+                static inline std::vector<typename basic_policy::private_element_type>
+                    eval_basis_polys(const typename basic_policy::indexes_type &indexes,
+                                     const std::vector<std::size_t> &selected_indexes) {
+                    return eval_basis_polys(get_lagrange_coefficients(indexes), indexes, selected_indexes);
+                }
+
+                static inline std::vector<typename basic_policy::private_element_type>
+                    eval_basis_polys(const lagrange_coefficients_type &coefficients,
+                                     const typename basic_policy::indexes_type &indexes,
+                                     const std::vector<std::size_t> &selected_indexes) {
+                    std::vector<std::size_t> sorted_indexes(std::cbegin(indexes), std::cend(indexes));
+                    auto basis_polys = eval_basis_polys(coefficients, indexes);
+
+                    std::vector<typename basic_policy::private_element_type> result;
+                    result.reserve(selected_indexes.size());
+                    for (std::size_t i : selected_indexes) {
+                        auto pos = std::lower_bound(sorted_indexes.cbegin(), sorted_indexes.cend(), i);
+                        assert(pos != sorted_indexes.cend() && *pos == i);
+                        result.emplace_back(basis_polys[std::distance(sorted_indexes.cbegin(), pos)]);
+                    }
                     return result;
                 }
 
@@ -308,13 +374,19 @@ namespace nil {
                                                                            const indexes_type &indexes) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<PublicShareIt>));
 
-                    public_secret_type public_secret = public_secret_type::zero();
+                    std::vector<public_secret_type> public_shares;
+                    std::vector<std::size_t> shares_indexes;
                     for (auto it = first; it != last; it++) {
-                        public_secret =
-                            public_secret + it->get_value() * scheme_type::eval_basis_poly(indexes, it->get_index());
+                        public_shares.emplace_back(it->get_value());
+                        shares_indexes.emplace_back(it->get_index());
+                    }
+                    if (public_shares.empty()) {
+                        return public_secret_type::zero();
                     }
+                    auto basis_polys = scheme_type::eval_basis_polys(indexes, shares_indexes);
 
-                    return public_secret;
+                    return algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                        public_shares.cbegin(), public_shares.cend(), basis_polys.cbegin(), basis_polys.cend(), 1);
                 }
 
                 public_secret_type public_secret;
@@ -391,9 +463,17 @@ namespace nil {
                 static inline secret_type reconstruct_secret(ShareIt first, ShareIt last, const indexes_type &indexes) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
 
-                    secret_type secret = secret_type::zero();
+                    std::vector<secret_type> shares;
+                    std::vector<std::size_t> shares_indexes;
                     for (auto it = first; it != last; it++) {
-                        secret = secret + it->get_value() * scheme_type::eval_basis_poly(indexes, it->get_index());
+                        shares.emplace_back(it->get_value());
+                        shares_indexes.emplace_back(it->get_index());
+                    }
+                    auto basis_polys = scheme_type::eval_basis_polys(indexes, shares_indexes);
+
+                    secret_type secret = secret_type::zero();
+                    for (std::size_t k = 0; k < shares.size(); ++k) {
+                        secret = secret + shares[k] * basis_polys[k];
                     }
 
                     return secret;
@@ -27,6 +27,7 @@
 #define CRYPTO3_PUBKEY_WEIGHTED_SHAMIR_SSS_HPP
 
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -277,9 +278,17 @@ namespace nil {
                 static inline secret_type reconstruct_secret(ShareIt first, ShareIt last, const indexes_type &indexes) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
 
-                    secret_type secret = secret_type::zero();
+                    std::vector<secret_type> shares;
+                    std::vector<std::size_t> shares_indexes;
                     for (auto it = first; it != last; it++) {
-                        secret = secret + it->get_value() * scheme_type::eval_basis_poly(indexes, it->get_index());
+                        shares.emplace_back(it->get_value());
+                        shares_indexes.emplace_back(it->get_index());
+                    }
+                    auto basis_polys = scheme_type::eval_basis_polys(indexes, shares_indexes);
+
+                    secret_type secret = secret_type::zero();
+                    for (std::size_t k = 0; k < shares.size(); ++k) {
+                        secret = secret + shares[k] * basis_polys[k];
                     }
 
                     return secret;
@@ -318,6 +327,37 @@ namespace nil {
                 }
             };
 
+            //
+            // Part shares of all participants are verified as one batch, an invalid part share marks its owner
+            //
+            template<typename Group>
+            struct batch_verify_shares_op<weighted_shamir_sss<Group>>
+                : public batch_verify_shares_op<feldman_sss<Group>> {
+                typedef batch_verify_shares_op<feldman_sss<Group>> base_type;
+                typedef weighted_shamir_sss<Group> scheme_type;
+                typedef typename base_type::result_type result_type;
+
+                template<typename PublicCoeffs, typename Shares>
+                static inline result_type process(const PublicCoeffs &public_coeffs, const Shares &shares) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicCoeffs>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Shares>));
+
+                    typedef typename std::iterator_traits<decltype(std::cbegin(shares))>::value_type share_type;
+                    typedef typename share_type::value_type::value_type part_share_type;
+                    typedef std::pair<std::size_t, typename part_share_type::value_type> indexed_element_type;
+
+                    std::vector<indexed_element_type> part_shares;
+                    std::vector<std::size_t> owners;
+                    for (const auto &share : shares) {
+                        for (const auto &part_share : share.get_value()) {
+                            part_shares.emplace_back(part_share.get_index(), part_share.get_value());
+                            owners.emplace_back(share.get_index());
+                        }
+                    }
+                    return base_type::_process(public_coeffs, part_shares, owners);
+                }
+            };
+
             template<typename Group>
             struct reconstruct_secret_op<weighted_shamir_sss<Group>> {
                 typedef weighted_shamir_sss<Group> scheme_type;
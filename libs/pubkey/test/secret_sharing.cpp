@@ -35,20 +35,26 @@
 #include <boost/test/data/monomorphic.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/lagrange_coefficients.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/pedersen.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/weighted_shamir.hpp>
 
+#include <nil/crypto3/pubkey/operations/batch_verify_shares_op.hpp>
+
 #include <nil/crypto3/pubkey/algorithm/deal_shares.hpp>
 #include <nil/crypto3/pubkey/algorithm/verify_share.hpp>
 #include <nil/crypto3/pubkey/algorithm/reconstruct_secret.hpp>
 #include <nil/crypto3/pubkey/algorithm/deal_share.hpp>
+#include <nil/crypto3/algebra/test_tools/curve_points.hpp>
 // #include <nil/crypto3/pubkey/algorithm/recover_polynomial.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::pubkey;
+using nil::crypto3::algebra::test_tools::small_order_point;
 
 template<typename FieldParams>
 void print_field_element(std::ostream &os, const typename fields::detail::element_fp<FieldParams> &e) {
@@ -146,6 +152,76 @@ class TD;
 // TODO: add verification of wrong values
 BOOST_AUTO_TEST_SUITE(secret_sharing_base_functional_self_tests)
 
+BOOST_AUTO_TEST_CASE(lagrange_coefficients_sss) {
+    using curve_type = curves::bls12_381;
+    using group_type = typename curve_type::g1_type<>;
+    using scheme_type = nil::crypto3::pubkey::shamir_sss<group_type>;
+    using field_type = typename scheme_type::private_element_type::field_type;
+
+    std::size_t n = 20;
+    std::vector<typename scheme_type::indexes_type> indexes_sets = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20},
+        {2, 3, 5, 7, 11, 13, 17, 19, 20, 1, 4, 6, 8},
+        {1, 20},
+        {3, 7, 25, 31},
+    };
+    for (const auto &indexes : indexes_sets) {
+        // with denominators cached for 1..n and without them
+        auto basis_polys = nil::crypto3::pubkey::lagrange_coefficients<field_type>(n)(indexes);
+        auto basis_polys1 = nil::crypto3::pubkey::lagrange_coefficients<field_type>()(indexes);
+        BOOST_CHECK_EQUAL(basis_polys.size(), indexes.size());
+        BOOST_CHECK(basis_polys == basis_polys1);
+        BOOST_CHECK(basis_polys == scheme_type::eval_basis_polys(indexes));
+        BOOST_CHECK(basis_polys == scheme_type::eval_basis_polys(scheme_type::get_lagrange_coefficients(indexes), indexes));
+
+        auto basis_polys_it = basis_polys.cbegin();
+        for (auto i : indexes) {
+            BOOST_CHECK_EQUAL(*basis_polys_it++, scheme_type::eval_basis_poly(indexes, i));
+        }
+    }
+
+    // one instance is kept per thread and only rebuilt for a larger participant index
+    typename scheme_type::indexes_type all_indexes, half_indexes;
+    for (std::size_t i = 1; i <= n; ++i) {
+        all_indexes.insert(i);
+        if (i <= n / 2) {
+            half_indexes.insert(i);
+        }
+    }
+    const auto &coefficients = scheme_type::get_lagrange_coefficients(all_indexes);
+    BOOST_CHECK_GE(coefficients.max_index(), n);
+    BOOST_CHECK_EQUAL(&coefficients, &scheme_type::get_lagrange_coefficients(half_indexes));
+
+    // sparse sets with a large index do not grow it
+    typename scheme_type::indexes_type sparse_indexes = {1, 2, 1000000};
+    BOOST_CHECK_EQUAL(scheme_type::get_lagrange_coefficients(sparse_indexes).max_index(), 0);
+    BOOST_CHECK_LT(coefficients.max_index(), 1000000);
+    auto sparse_basis_polys = scheme_type::eval_basis_polys(sparse_indexes);
+    auto sparse_basis_polys_it = sparse_basis_polys.cbegin();
+    for (auto i : sparse_indexes) {
+        BOOST_CHECK_EQUAL(*sparse_basis_polys_it++, scheme_type::eval_basis_poly(sparse_indexes, i));
+    }
+
+    // index 0 is the secret itself and is not a valid participant index
+    typename scheme_type::indexes_type zero_indexes = {0, 1, 2};
+    BOOST_CHECK_THROW(nil::crypto3::pubkey::lagrange_coefficients<field_type>(n)(zero_indexes), std::invalid_argument);
+    BOOST_CHECK_THROW(nil::crypto3::pubkey::lagrange_coefficients<field_type>()(zero_indexes), std::invalid_argument);
+
+    std::size_t big_n = 100;
+    nil::crypto3::pubkey::lagrange_coefficients<field_type> big_coefficients(big_n);
+    for (std::size_t step : {1, 2, 3, 7}) {
+        typename scheme_type::indexes_type indexes;
+        for (std::size_t i = 1; i <= big_n; i += step) {
+            indexes.insert(i);
+        }
+        auto basis_polys = big_coefficients(indexes);
+        auto basis_polys_it = basis_polys.cbegin();
+        for (auto i : indexes) {
+            BOOST_CHECK_EQUAL(*basis_polys_it++, scheme_type::eval_basis_poly(indexes, i));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(feldman_sss) {
     using curve_type = curves::bls12_381;
     using group_type = typename curve_type::g1_type<>;
@@ -236,6 +312,50 @@ BOOST_AUTO_TEST_CASE(feldman_sss) {
         BOOST_CHECK(res_out1.back());
     }
 
+    //===========================================================================
+    // all shares are verified at once, invalid shares are reported by their indexes
+
+    std::vector<public_share_sss<scheme_type>> public_shares;
+    for (const auto &s_i : shares) {
+        public_shares.emplace_back(static_cast<public_share_sss<scheme_type>>(s_i));
+    }
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, shares).empty());
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, public_shares).empty());
+
+    auto wrong_shares = shares;
+    auto wrong_public_shares = public_shares;
+    for (std::size_t k : {2, 3, 7}) {
+        wrong_shares[k] = share_sss<scheme_type>(
+            wrong_shares[k].get_index(), wrong_shares[k].get_value() + scheme_type::private_element_type::one());
+        wrong_public_shares[k] = static_cast<public_share_sss<scheme_type>>(wrong_shares[k]);
+    }
+    std::vector<std::size_t> wrong_indexes;
+    for (const auto &s_i : wrong_shares) {
+        if (!static_cast<bool>(
+                nil::crypto3::verify_share<scheme_type>(pub_coeffs, static_cast<public_share_sss<scheme_type>>(s_i)))) {
+            wrong_indexes.emplace_back(s_i.get_index());
+        }
+    }
+    BOOST_CHECK(wrong_indexes == std::vector<std::size_t>({3, 4, 8}));
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, wrong_shares) == wrong_indexes);
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, wrong_public_shares) == wrong_indexes);
+
+    auto wrong_pub_coeffs = pub_coeffs;
+    wrong_pub_coeffs[0] = scheme_type::public_coeff_type::zero();
+    BOOST_CHECK_EQUAL(batch_verify_shares_op<scheme_type>::process(wrong_pub_coeffs, shares).size(), n);
+
+    // points outside the prime order subgroup are rejected before batching
+    auto small_order_public_shares = public_shares;
+    small_order_public_shares[5] = public_share_sss<scheme_type>(
+        public_shares[5].get_index(), public_shares[5].get_value() + small_order_point<group_type>());
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, small_order_public_shares) ==
+                std::vector<std::size_t>({6}));
+
+    auto small_order_pub_coeffs = pub_coeffs;
+    small_order_pub_coeffs[1] = small_order_pub_coeffs[1] + small_order_point<group_type>();
+    BOOST_CHECK_EQUAL(batch_verify_shares_op<scheme_type>::process(small_order_pub_coeffs, shares).size(), n);
+    BOOST_CHECK_EQUAL(batch_verify_shares_op<scheme_type>::process(small_order_pub_coeffs, public_shares).size(), n);
+
     //===========================================================================
     // reconstructing secret using accumulator
 
@@ -388,6 +508,28 @@ BOOST_AUTO_TEST_CASE(shamir_weighted_sss) {
     BOOST_CHECK(shares == shares_out.back());
     BOOST_CHECK(shares == shares_out1.back());
 
+    //===========================================================================
+    // part shares of all participants are verified at once, invalid shares are reported by participant indexes
+
+    std::vector<public_share_sss<scheme_type>> public_shares;
+    for (const auto &s_i : shares) {
+        public_shares.emplace_back(static_cast<public_share_sss<scheme_type>>(s_i));
+    }
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, shares).empty());
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, shares_one).empty());
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, public_shares).empty());
+
+    auto wrong_shares = shares;
+    auto wrong_public_shares = public_shares;
+    for (std::size_t k : {4, 13}) {
+        wrong_shares[k] = share_sss<scheme_type>(shares[k].get_index(), shares[k].get_weight(), t);
+        wrong_public_shares[k] = static_cast<public_share_sss<scheme_type>>(wrong_shares[k]);
+    }
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, wrong_shares) ==
+                std::vector<std::size_t>({5, 14}));
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(pub_coeffs, wrong_public_shares) ==
+                std::vector<std::size_t>({5, 14}));
+
     //===========================================================================
     // reconstructing secret
 
@@ -571,6 +713,18 @@ BOOST_AUTO_TEST_CASE(pedersen_dkg) {
         BOOST_CHECK(!static_cast<bool>(nil::crypto3::verify_share<scheme_type>(wrong_P_public_polys, i_share)));
     }
 
+    for (auto i = 1; i <= n; i++) {
+        BOOST_CHECK(
+            batch_verify_shares_op<scheme_type>::process(P_public_polys[i - 1], P_generated_shares[i - 1]).empty());
+    }
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(P_public_poly, P_shares).empty());
+
+    auto wrong_P_shares = P_shares;
+    wrong_P_shares[n - 1] = share_sss<scheme_type>(wrong_P_shares[n - 1].get_index(),
+                                                   -wrong_P_shares[n - 1].get_value());
+    BOOST_CHECK(batch_verify_shares_op<scheme_type>::process(P_public_poly, wrong_P_shares) ==
+                std::vector<std::size_t>({static_cast<std::size_t>(n)}));
+
     //===========================================================================
     // calculation of actual secret
     // (which is not calculated directly by the parties in real application)
@@ -53,7 +53,7 @@ namespace nil {
                     typedef typename policy_type::block_type block_type;
 
                     static BOOST_ATTRIBUTE_TARGET("avx2") void chacha_x8(
-                        const std::array<std::uint8_t, block_size * 8> &block,
+                        std::array<std::uint8_t, block_size * 8> &block,
                         key_schedule_type &schedule) {
                         _mm256_zeroupper();
 
@@ -74,16 +74,16 @@ namespace nil {
                         __m256i R09 = _mm256_set1_epi32(schedule[9]);
                         __m256i R10 = _mm256_set1_epi32(schedule[10]);
                         __m256i R11 = _mm256_set1_epi32(schedule[11]);
-                        __m256i R12 = _mm256_set1_epi32(schedule[12]) + CTR0;
-                        __m256i R13 = _mm256_set1_epi32(schedule[13]) + CTR1;
+                        __m256i R12 = _mm256_add_epi32(_mm256_set1_epi32(schedule[12]), CTR0);
+                        __m256i R13 = _mm256_add_epi32(_mm256_set1_epi32(schedule[13]), CTR1);
                         __m256i R14 = _mm256_set1_epi32(schedule[14]);
                         __m256i R15 = _mm256_set1_epi32(schedule[15]);
 
                         for (size_t r = 0; r != rounds / 2; ++r) {
-                            R00 += R04;
-                            R01 += R05;
-                            R02 += R06;
-                            R03 += R07;
+                            R00 = _mm256_add_epi32(R00, R04);
+                            R01 = _mm256_add_epi32(R01, R05);
+                            R02 = _mm256_add_epi32(R02, R06);
+                            R03 = _mm256_add_epi32(R03, R07);
 
                             R12 ^= R00;
                             R13 ^= R01;
@@ -99,10 +99,10 @@ namespace nil {
                             R14 = _mm256_shuffle_epi8(R14, shuf_rotl_16);
                             R15 = _mm256_shuffle_epi8(R15, shuf_rotl_16);
 
-                            R08 += R12;
-                            R09 += R13;
-                            R10 += R14;
-                            R11 += R15;
+                            R08 = _mm256_add_epi32(R08, R12);
+                            R09 = _mm256_add_epi32(R09, R13);
+                            R10 = _mm256_add_epi32(R10, R14);
+                            R11 = _mm256_add_epi32(R11, R15);
 
                             R04 ^= R08;
                             R05 ^= R09;
@@ -114,10 +114,10 @@ namespace nil {
                             R06 = _mm256_or_si256(_mm256_slli_epi32(R06, 12), _mm256_srli_epi32(R06, 32 - 12));
                             R07 = _mm256_or_si256(_mm256_slli_epi32(R07, 12), _mm256_srli_epi32(R07, 32 - 12));
 
-                            R00 += R04;
-                            R01 += R05;
-                            R02 += R06;
-                            R03 += R07;
+                            R00 = _mm256_add_epi32(R00, R04);
+                            R01 = _mm256_add_epi32(R01, R05);
+                            R02 = _mm256_add_epi32(R02, R06);
+                            R03 = _mm256_add_epi32(R03, R07);
 
                             R12 ^= R00;
                             R13 ^= R01;
@@ -133,10 +133,10 @@ namespace nil {
                             R14 = _mm256_shuffle_epi8(R14, shuf_rotl_8);
                             R15 = _mm256_shuffle_epi8(R15, shuf_rotl_8);
 
-                            R08 += R12;
-                            R09 += R13;
-                            R10 += R14;
-                            R11 += R15;
+                            R08 = _mm256_add_epi32(R08, R12);
+                            R09 = _mm256_add_epi32(R09, R13);
+                            R10 = _mm256_add_epi32(R10, R14);
+                            R11 = _mm256_add_epi32(R11, R15);
 
                             R04 ^= R08;
                             R05 ^= R09;
@@ -148,10 +148,10 @@ namespace nil {
                             R06 = _mm256_or_si256(_mm256_slli_epi32(R06, 7), _mm256_srli_epi32(R06, 32 - 7));
                             R07 = _mm256_or_si256(_mm256_slli_epi32(R07, 7), _mm256_srli_epi32(R07, 32 - 7));
 
-                            R00 += R05;
-                            R01 += R06;
-                            R02 += R07;
-                            R03 += R04;
+                            R00 = _mm256_add_epi32(R00, R05);
+                            R01 = _mm256_add_epi32(R01, R06);
+                            R02 = _mm256_add_epi32(R02, R07);
+                            R03 = _mm256_add_epi32(R03, R04);
 
                             R15 ^= R00;
                             R12 ^= R01;
@@ -163,10 +163,10 @@ namespace nil {
                             R13 = _mm256_shuffle_epi8(R13, shuf_rotl_16);
                             R14 = _mm256_shuffle_epi8(R14, shuf_rotl_16);
 
-                            R10 += R15;
-                            R11 += R12;
-                            R08 += R13;
-                            R09 += R14;
+                            R10 = _mm256_add_epi32(R10, R15);
+                            R11 = _mm256_add_epi32(R11, R12);
+                            R08 = _mm256_add_epi32(R08, R13);
+                            R09 = _mm256_add_epi32(R09, R14);
 
                             R05 ^= R10;
                             R06 ^= R11;
@@ -178,10 +178,10 @@ namespace nil {
                             R07 = _mm256_or_si256(_mm256_slli_epi32(R07, 12), _mm256_srli_epi32(R07, 32 - 12));
                             R04 = _mm256_or_si256(_mm256_slli_epi32(R04, 12), _mm256_srli_epi32(R04, 32 - 12));
 
-                            R00 += R05;
-                            R01 += R06;
-                            R02 += R07;
-                            R03 += R04;
+                            R00 = _mm256_add_epi32(R00, R05);
+                            R01 = _mm256_add_epi32(R01, R06);
+                            R02 = _mm256_add_epi32(R02, R07);
+                            R03 = _mm256_add_epi32(R03, R04);
 
                             R15 ^= R00;
                             R12 ^= R01;
@@ -193,10 +193,10 @@ namespace nil {
                             R13 = _mm256_shuffle_epi8(R13, shuf_rotl_8);
                             R14 = _mm256_shuffle_epi8(R14, shuf_rotl_8);
 
-                            R10 += R15;
-                            R11 += R12;
-                            R08 += R13;
-                            R09 += R14;
+                            R10 = _mm256_add_epi32(R10, R15);
+                            R11 = _mm256_add_epi32(R11, R12);
+                            R08 = _mm256_add_epi32(R08, R13);
+                            R09 = _mm256_add_epi32(R09, R14);
 
                             R05 ^= R10;
                             R06 ^= R11;
@@ -209,22 +209,22 @@ namespace nil {
                             R04 = _mm256_or_si256(_mm256_slli_epi32(R04, 7), _mm256_srli_epi32(R04, 32 - 7));
                         }
 
-                        R00 += _mm256_set1_epi32(schedule[0]);
-                        R01 += _mm256_set1_epi32(schedule[1]);
-                        R02 += _mm256_set1_epi32(schedule[2]);
-                        R03 += _mm256_set1_epi32(schedule[3]);
-                        R04 += _mm256_set1_epi32(schedule[4]);
-                        R05 += _mm256_set1_epi32(schedule[5]);
-                        R06 += _mm256_set1_epi32(schedule[6]);
-                        R07 += _mm256_set1_epi32(schedule[7]);
-                        R08 += _mm256_set1_epi32(schedule[8]);
-                        R09 += _mm256_set1_epi32(schedule[9]);
-                        R10 += _mm256_set1_epi32(schedule[10]);
-                        R11 += _mm256_set1_epi32(schedule[11]);
-                        R12 += _mm256_set1_epi32(schedule[12]) + CTR0;
-                        R13 += _mm256_set1_epi32(schedule[13]) + CTR1;
-                        R14 += _mm256_set1_epi32(schedule[14]);
-                        R15 += _mm256_set1_epi32(schedule[15]);
+                        R00 = _mm256_add_epi32(R00, _mm256_set1_epi32(schedule[0]));
+                        R01 = _mm256_add_epi32(R01, _mm256_set1_epi32(schedule[1]));
+                        R02 = _mm256_add_epi32(R02, _mm256_set1_epi32(schedule[2]));
+                        R03 = _mm256_add_epi32(R03, _mm256_set1_epi32(schedule[3]));
+                        R04 = _mm256_add_epi32(R04, _mm256_set1_epi32(schedule[4]));
+                        R05 = _mm256_add_epi32(R05, _mm256_set1_epi32(schedule[5]));
+                        R06 = _mm256_add_epi32(R06, _mm256_set1_epi32(schedule[6]));
+                        R07 = _mm256_add_epi32(R07, _mm256_set1_epi32(schedule[7]));
+                        R08 = _mm256_add_epi32(R08, _mm256_set1_epi32(schedule[8]));
+                        R09 = _mm256_add_epi32(R09, _mm256_set1_epi32(schedule[9]));
+                        R10 = _mm256_add_epi32(R10, _mm256_set1_epi32(schedule[10]));
+                        R11 = _mm256_add_epi32(R11, _mm256_set1_epi32(schedule[11]));
+                        R12 = _mm256_add_epi32(R12, _mm256_add_epi32(_mm256_set1_epi32(schedule[12]), CTR0));
+                        R13 = _mm256_add_epi32(R13, _mm256_add_epi32(_mm256_set1_epi32(schedule[13]), CTR1));
+                        R14 = _mm256_add_epi32(R14, _mm256_set1_epi32(schedule[14]));
+                        R15 = _mm256_add_epi32(R15, _mm256_set1_epi32(schedule[15]));
 
                         __m256i T0 = _mm256_unpacklo_epi32(R00, R01);
                         __m256i T1 = _mm256_unpacklo_epi32(R02, R03);
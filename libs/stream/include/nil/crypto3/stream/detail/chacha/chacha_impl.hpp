@@ -64,14 +64,17 @@ namespace nil {
                     constexpr static const std::size_t block_size = policy_type::block_size;
                     typedef typename policy_type::block_type block_type;
 
-                    inline static void chacha_x8(const std::array<std::uint8_t, block_size * 8> &block,
+                    inline static void chacha_x8(std::array<std::uint8_t, block_size * 8> &block,
                                                  key_schedule_type &schedule) {
-                        chacha_x4(block, schedule);
-                        chacha_x4(std::array<std::uint8_t, block_size * 4>(block.begin() + block_size * 4, block.end()),
-                                  schedule);
+                        std::array<std::uint8_t, block_size * 4> half;
+
+                        chacha_x4(half, schedule);
+                        std::copy(half.begin(), half.end(), block.begin());
+                        chacha_x4(half, schedule);
+                        std::copy(half.begin(), half.end(), block.begin() + block_size * 4);
                     }
 
-                    static void chacha_x4(const std::array<std::uint8_t, block_size * 4> &block,
+                    static void chacha_x4(std::array<std::uint8_t, block_size * 4> &block,
                                           key_schedule_type &input) {
                         // TODO interleave rounds
                         for (size_t i = 0; i != 4; ++i) {
@@ -109,27 +112,27 @@ namespace nil {
                             x14 += input[14];
                             x15 += input[15];
 
-                            boost::endian::store_little_u32(x00, block + 64 * i + 4 * 0);
-                            boost::endian::store_little_u32(x01, block + 64 * i + 4 * 1);
-                            boost::endian::store_little_u32(x02, block + 64 * i + 4 * 2);
-                            boost::endian::store_little_u32(x03, block + 64 * i + 4 * 3);
-                            boost::endian::store_little_u32(x04, block + 64 * i + 4 * 4);
-                            boost::endian::store_little_u32(x05, block + 64 * i + 4 * 5);
-                            boost::endian::store_little_u32(x06, block + 64 * i + 4 * 6);
-                            boost::endian::store_little_u32(x07, block + 64 * i + 4 * 7);
-                            boost::endian::store_little_u32(x08, block + 64 * i + 4 * 8);
-                            boost::endian::store_little_u32(x09, block + 64 * i + 4 * 9);
-                            boost::endian::store_little_u32(x10, block + 64 * i + 4 * 10);
-                            boost::endian::store_little_u32(x11, block + 64 * i + 4 * 11);
-                            boost::endian::store_little_u32(x12, block + 64 * i + 4 * 12);
-                            boost::endian::store_little_u32(x13, block + 64 * i + 4 * 13);
-                            boost::endian::store_little_u32(x14, block + 64 * i + 4 * 14);
-                            boost::endian::store_little_u32(x15, block + 64 * i + 4 * 15);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 0, x00);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 1, x01);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 2, x02);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 3, x03);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 4, x04);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 5, x05);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 6, x06);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 7, x07);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 8, x08);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 9, x09);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 10, x10);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 11, x11);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 12, x12);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 13, x13);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 14, x14);
+                            boost::endian::store_little_u32(block.data() + 64 * i + 4 * 15, x15);
 
                             input[12]++;
-                            input[13] += input[12] < i;    // carry?
+                            input[13] += (input[12] == 0);
                         }
-                    };
+                    }
                 };
             }    // namespace detail
         }        // namespace stream
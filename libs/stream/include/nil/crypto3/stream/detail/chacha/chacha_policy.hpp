@@ -25,6 +25,8 @@
 #ifndef CRYPTO3_STREAM_CHACHA_POLICY_HPP
 #define CRYPTO3_STREAM_CHACHA_POLICY_HPP
 
+#include <array>
+
 #include <boost/endian/conversion.hpp>
 
 #include <boost/container/small_vector.hpp>
@@ -52,18 +52,21 @@ namespace nil {
                     constexpr static const std::size_t block_size = policy_type::block_size;
                     typedef typename policy_type::block_type block_type;
 
-                    inline static void chacha_x8(const std::array<std::uint8_t, block_size * 8> &block,
+                    inline static void chacha_x8(std::array<std::uint8_t, block_size * 8> &block,
                                                  key_schedule_type &schedule) {
-                        chacha_x4(block, schedule);
-                        chacha_x4(std::array<std::uint8_t, block_size * 4>(block.begin() + block_size * 4, block.end()),
-                                  schedule);
+                        std::array<std::uint8_t, block_size * 4> half;
+
+                        chacha_x4(half, schedule);
+                        std::copy(half.begin(), half.end(), block.begin());
+                        chacha_x4(half, schedule);
+                        std::copy(half.begin(), half.end(), block.begin() + block_size * 4);
                     }
 
                     static BOOST_ATTRIBUTE_TARGET("sse2") void chacha_x4(
-                        const std::array<std::uint8_t, block_size * 4> &block,
+                        std::array<std::uint8_t, block_size * 4> &block,
                         key_schedule_type &schedule) {
-                        const __m128i *input_mm = reinterpret_cast<const __m128i *>(schedule);
-                        __m128i *output_mm = reinterpret_cast<__m128i *>(block);
+                        const __m128i *input_mm = reinterpret_cast<const __m128i *>(schedule.data());
+                        __m128i *output_mm = reinterpret_cast<__m128i *>(block.data());
 
                         __m128i input0 = _mm_loadu_si128(input_mm);
                         __m128i input1 = _mm_loadu_si128(input_mm + 1);
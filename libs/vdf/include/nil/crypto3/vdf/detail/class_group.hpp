@@ -0,0 +1,345 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_VDF_CLASS_GROUP_HPP
+#define CRYPTO3_VDF_CLASS_GROUP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/multiprecision/integer.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/random/mersenne_twister.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace vdf {
+            /*!
+             * @brief Binary quadratic form ax^2 + bxy + cy^2, an element of the class group of its discriminant
+             * b^2 - 4ac. Forms produced by class_group_functions are reduced, so equal classes compare equal.
+             */
+            template<typename IntegerType>
+            struct class_group_form {
+                typedef IntegerType integer_type;
+
+                integer_type a;
+                integer_type b;
+                integer_type c;
+
+                bool operator==(const class_group_form &other) const {
+                    return a == other.a && b == other.b && c == other.c;
+                }
+
+                bool operator!=(const class_group_form &other) const {
+                    return !(*this == other);
+                }
+            };
+
+            namespace detail {
+                /** @brief Arithmetic in the class group of a negative discriminant.
+                 *
+                 * IntegerType is a signed Boost.Multiprecision integer wide enough for the products of two
+                 * coefficients. Composition and reduction follow Cohen, "A Course in Computational Algebraic
+                 * Number Theory", algorithms 5.4.2 and 5.4.7.
+                 */
+                template<typename IntegerType>
+                struct class_group_functions {
+                    typedef IntegerType integer_type;
+                    typedef class_group_form<integer_type> form_type;
+
+                    // Rounds towards minus infinity, divisor must be positive
+                    static integer_type floor_div(const integer_type &a, const integer_type &b) {
+                        integer_type q, r;
+                        boost::multiprecision::divide_qr(a, b, q, r);
+                        if (r < 0) {
+                            --q;
+                        }
+                        return q;
+                    }
+
+                    // Remainder in [0, m), m must be positive
+                    static integer_type mod(const integer_type &a, const integer_type &m) {
+                        integer_type r = a % m;
+                        if (r < 0) {
+                            r += m;
+                        }
+                        return r;
+                    }
+
+                    // d = gcd(a, b) = u * a + v * b, d is non-negative
+                    static void xgcd(const integer_type &a, const integer_type &b, integer_type &d, integer_type &u,
+                                     integer_type &v) {
+                        integer_type r0 = a, r1 = b, s0 = 1, s1 = 0, t0 = 0, t1 = 1, q, tmp;
+                        while (r1 != 0) {
+                            q = r0 / r1;
+                            tmp = r0 - q * r1;
+                            r0 = r1;
+                            r1 = tmp;
+                            tmp = s0 - q * s1;
+                            s0 = s1;
+                            s1 = tmp;
+                            tmp = t0 - q * t1;
+                            t0 = t1;
+                            t1 = tmp;
+                        }
+                        if (r0 < 0) {
+                            r0 = -r0;
+                            s0 = -s0;
+                            t0 = -t0;
+                        }
+                        d = r0;
+                        u = s0;
+                        v = t0;
+                    }
+
+                    static integer_type discriminant(const form_type &f) {
+                        return f.b * f.b - 4 * f.a * f.c;
+                    }
+
+                    // Brings b into (-a, a]
+                    static void normalize(form_type &f) {
+                        if (-f.a < f.b && f.b <= f.a) {
+                            return;
+                        }
+                        const integer_type r = floor_div(f.a - f.b, 2 * f.a);
+                        f.c += r * (f.a * r + f.b);
+                        f.b += 2 * r * f.a;
+                    }
+
+                    static void reduce(form_type &f) {
+                        normalize(f);
+                        while (f.a > f.c || (f.a == f.c && f.b < 0)) {
+                            std::swap(f.a, f.c);
+                            f.b = -f.b;
+                            normalize(f);
+                        }
+                    }
+
+                    static bool is_reduced(const form_type &f) {
+                        return -f.a < f.b && f.b <= f.a && f.a <= f.c && !(f.a == f.c && f.b < 0);
+                    }
+
+                    // Checks that f is a reduced positive definite form of discriminant d
+                    static bool is_valid(const form_type &f, const integer_type &d) {
+                        return f.a > 0 && is_reduced(f) && discriminant(f) == d;
+                    }
+
+                    static form_type identity(const integer_type &d) {
+                        form_type result {1, 1, (1 - d) / 4};
+                        return result;
+                    }
+
+                    // Form (2, 1, c), which exists for d = 1 mod 8
+                    static form_type generator(const integer_type &d) {
+                        if (mod(d, 8) != 1) {
+                            throw std::invalid_argument("Discriminant must be 1 modulo 8");
+                        }
+                        form_type result {2, 1, (1 - d) / 8};
+                        reduce(result);
+                        return result;
+                    }
+
+                    static form_type compose(const form_type &f1, const form_type &f2) {
+                        if (f1.a > f2.a) {
+                            return compose(f2, f1);
+                        }
+
+                        const integer_type s = (f1.b + f2.b) / 2;
+                        const integer_type n = f2.b - s;
+
+                        integer_type y1, d, u, v;
+                        if (f2.a % f1.a == 0) {
+                            y1 = 0;
+                            d = f1.a;
+                        } else {
+                            xgcd(f2.a, f1.a, d, u, v);
+                            y1 = u;
+                        }
+
+                        integer_type x2, y2, d1;
+                        if (s % d == 0) {
+                            y2 = -1;
+                            x2 = 0;
+                            d1 = d;
+                        } else {
+                            xgcd(s, d, d1, x2, y2);
+                            y2 = -y2;
+                        }
+
+                        const integer_type v1 = f1.a / d1;
+                        const integer_type v2 = f2.a / d1;
+                        const integer_type r = mod(y1 * y2 * n - x2 * f2.c, v1);
+
+                        form_type result;
+                        result.a = v1 * v2;
+                        result.b = f2.b + 2 * v2 * r;
+                        result.c = (f2.c * d1 + r * (f2.b + v2 * r)) / v1;
+                        reduce(result);
+                        return result;
+                    }
+
+                    static form_type square(const form_type &f) {
+                        return compose(f, f);
+                    }
+
+                    static form_type inverse(const form_type &f) {
+                        form_type result {f.a, -f.b, f.c};
+                        reduce(result);
+                        return result;
+                    }
+
+                    // f^e for non-negative e
+                    static form_type pow(const form_type &f, const integer_type &e) {
+                        form_type result = identity(discriminant(f));
+                        if (e == 0) {
+                            return result;
+                        }
+                        for (std::size_t i = boost::multiprecision::msb(e) + 1; i-- > 0;) {
+                            result = square(result);
+                            if (boost::multiprecision::bit_test(e, i)) {
+                                result = compose(result, f);
+                            }
+                        }
+                        return result;
+                    }
+
+                    /*!
+                     * @brief Squares x iterations times and stores x^(2^p) for every p in positions.
+                     * @param positions sorted positions of the checkpoints, they may be past iterations
+                     * @return x^(2^iterations)
+                     */
+                    static form_type evaluate(const form_type &x, std::size_t iterations,
+                                              const std::vector<std::size_t> &positions,
+                                              std::vector<form_type> &checkpoints) {
+                        const std::size_t last = std::max(iterations, positions.empty() ? 0 : positions.back());
+                        checkpoints.clear();
+                        checkpoints.reserve(positions.size());
+
+                        form_type current = x, result = x;
+                        auto position = positions.cbegin();
+                        for (std::size_t i = 0;; ++i) {
+                            while (position != positions.cend() && *position == i) {
+                                checkpoints.push_back(current);
+                                ++position;
+                            }
+                            if (i == iterations) {
+                                result = current;
+                            }
+                            if (i == last) {
+                                break;
+                            }
+                            current = square(current);
+                        }
+                        return result;
+                    }
+
+                    // Appends sign, length and big-endian magnitude of x
+                    static void serialize(std::vector<std::uint8_t> &out, const integer_type &x) {
+                        std::vector<std::uint8_t> magnitude;
+                        boost::multiprecision::export_bits(integer_type(abs(x)), std::back_inserter(magnitude), 8);
+                        out.push_back(x < 0 ? 1 : 0);
+                        for (std::size_t i = 4; i-- > 0;) {
+                            out.push_back(static_cast<std::uint8_t>(magnitude.size() >> (8 * i)));
+                        }
+                        out.insert(out.end(), magnitude.begin(), magnitude.end());
+                    }
+
+                    static void serialize(std::vector<std::uint8_t> &out, const form_type &f) {
+                        serialize(out, f.a);
+                        serialize(out, f.b);
+                    }
+
+                    // Expands the hash of data into a bits long non-negative integer
+                    template<typename Hash>
+                    static integer_type hash_to_integer(const std::vector<std::uint8_t> &data, std::size_t bits) {
+                        std::vector<std::uint8_t> expanded, block = data;
+                        block.push_back(0);
+                        for (std::uint8_t counter = 0; expanded.size() * 8 < bits; ++counter) {
+                            block.back() = counter;
+                            typename Hash::digest_type digest = crypto3::hash<Hash>(block);
+                            expanded.insert(expanded.end(), digest.begin(), digest.end());
+                        }
+                        integer_type result;
+                        boost::multiprecision::import_bits(result, expanded.begin(), expanded.end(), 8);
+                        return result >> (expanded.size() * 8 - bits);
+                    }
+
+                    // Prime with exactly bits bits derived from data
+                    template<typename Hash>
+                    static integer_type hash_to_prime(std::vector<std::uint8_t> data, std::size_t bits) {
+                        // miller_rabin_test without a generator shares a static one, proofs run on several threads
+                        boost::random::mt19937 generator;
+                        data.insert(data.end(), 8, 0);
+                        for (std::uint64_t counter = 0;; ++counter) {
+                            for (std::size_t i = 0; i < 8; ++i) {
+                                data[data.size() - 8 + i] = static_cast<std::uint8_t>(counter >> (8 * (7 - i)));
+                            }
+                            integer_type candidate = hash_to_integer<Hash>(data, bits);
+                            boost::multiprecision::bit_set(candidate, bits - 1);
+                            boost::multiprecision::bit_set(candidate, 0);
+                            if (boost::multiprecision::miller_rabin_test(candidate, 25, generator)) {
+                                return candidate;
+                            }
+                        }
+                    }
+
+                    /*!
+                     * @brief Derives a discriminant -p with p prime, p = 7 mod 8 and bits bits long. Its class
+                     * group has unknown order and contains generator().
+                     */
+                    template<typename Hash>
+                    static integer_type create_discriminant(const std::vector<std::uint8_t> &seed, std::size_t bits) {
+                        integer_type p = hash_to_integer<Hash>(seed, bits);
+                        boost::multiprecision::bit_set(p, bits - 1);
+                        p += 7 - mod(p, 8);
+                        boost::random::mt19937 generator;
+                        while (!boost::multiprecision::miller_rabin_test(p, 25, generator)) {
+                            p += 8;
+                        }
+                        return -p;
+                    }
+                };
+
+                // Squares with class_group_functions of the integer type of the forms
+                struct class_group_evaluator {
+                    template<typename IntegerType>
+                    static class_group_form<IntegerType> evaluate(const class_group_form<IntegerType> &x,
+                                                                  std::size_t iterations,
+                                                                  const std::vector<std::size_t> &positions,
+                                                                  std::vector<class_group_form<IntegerType>> &checkpoints) {
+                        return class_group_functions<IntegerType>::evaluate(x, iterations, positions, checkpoints);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace vdf
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_VDF_CLASS_GROUP_HPP
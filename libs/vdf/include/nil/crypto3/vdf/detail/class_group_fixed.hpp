@@ -0,0 +1,460 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_VDF_CLASS_GROUP_FIXED_HPP
+#define CRYPTO3_VDF_CLASS_GROUP_FIXED_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/integer.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+#include <nil/crypto3/vdf/detail/class_group.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace vdf {
+            namespace detail {
+                /** @brief Class group squaring on fixed-width integers, for the VDF evaluation loop.
+                 *
+                 * Coefficients are stored in two's complement in Bits-bit wrap-around unsigned integers, so
+                 * squarings never allocate. Squaring is NUDUPL (Jacobson, van der Poorten, "Computational
+                 * aspects of NUCOMP") with a Lehmer partial extended gcd, followed by a reduction driven by
+                 * 64-bit approximations of the coefficients, as in chia_functions.
+                 *
+                 * Intermediate values reach about |D| * 2^64, Bits must exceed the discriminant size by at
+                 * least reserve_bits.
+                 */
+                template<unsigned Bits,
+                         typename IntegerType = boost::multiprecision::number<
+                             boost::multiprecision::backends::cpp_int_modular_backend<Bits>>>
+                struct class_group_fixed_functions {
+                    typedef IntegerType integer_type;
+                    typedef class_group_form<integer_type> form_type;
+
+                    constexpr static const std::size_t reserve_bits = 68;
+                    // Bound of the reduction cofactors, keeps their pairwise products in 63 bits
+                    constexpr static const std::int64_t threshold = std::int64_t(1) << 30;
+                    // Largest spread of the coefficient exponents for which the approximations stay non-zero
+                    constexpr static const std::int64_t exp_threshold = 60;
+
+                    static bool is_negative(const integer_type &x) {
+                        return boost::multiprecision::bit_test(x, Bits - 1);
+                    }
+
+                    static integer_type negate(const integer_type &x) {
+                        return integer_type(0u) - x;
+                    }
+
+                    static integer_type abs(const integer_type &x) {
+                        return is_negative(x) ? negate(x) : x;
+                    }
+
+                    static bool is_positive(const integer_type &x) {
+                        return !is_negative(x) && !x.is_zero();
+                    }
+
+                    // a < b, valid while |a - b| < 2^(Bits - 1)
+                    static bool less(const integer_type &a, const integer_type &b) {
+                        return is_negative(a - b);
+                    }
+
+                    static std::size_t bits(const integer_type &x) {
+                        return x.is_zero() ? 0 : boost::multiprecision::msb(x) + 1;
+                    }
+
+                    static integer_type mul_si(const integer_type &x, std::int64_t s) {
+                        return s < 0 ? negate(x * (std::uint64_t(0) - static_cast<std::uint64_t>(s))) :
+                                       x * static_cast<std::uint64_t>(s);
+                    }
+
+                    // Rounds towards zero
+                    static integer_type tdiv(const integer_type &a, const integer_type &b) {
+                        const integer_type q = abs(a) / abs(b);
+                        return is_negative(a) != is_negative(b) ? negate(q) : q;
+                    }
+
+                    // Rounds towards minus infinity, divisor must be positive
+                    static integer_type fdiv(const integer_type &a, const integer_type &b) {
+                        if (!is_negative(a)) {
+                            return a / b;
+                        }
+                        integer_type q, r;
+                        boost::multiprecision::divide_qr(negate(a), b, q, r);
+                        return r.is_zero() ? negate(q) : negate(q) - 1u;
+                    }
+
+                    // Remainder in [0, m), m must be positive
+                    static integer_type mod(const integer_type &a, const integer_type &m) {
+                        if (!is_negative(a)) {
+                            return a % m;
+                        }
+                        const integer_type r = negate(a) % m;
+                        return r.is_zero() ? r : m - r;
+                    }
+
+                    /*!
+                     * @brief Signed approximation m of x and exponent e with x ~ m * 2^(e - 63), |m| < 2^63.
+                     * e is the bit length of |x|.
+                     */
+                    static std::int64_t approximate(const integer_type &x, std::int64_t &e) {
+                        const integer_type m = abs(x);
+                        e = static_cast<std::int64_t>(bits(m));
+                        const std::uint64_t top = e > 63 ? static_cast<std::uint64_t>(m >> (e - 63)) :
+                                                           static_cast<std::uint64_t>(m) << (63 - e);
+                        return is_negative(x) ? -static_cast<std::int64_t>(top) : static_cast<std::int64_t>(top);
+                    }
+
+                    // Brings b into (-a, a]
+                    static void normalize(form_type &f) {
+                        if (less(negate(f.a), f.b) && !less(f.a, f.b)) {
+                            return;
+                        }
+                        const integer_type r = fdiv(f.a - f.b, f.a << 1);
+                        f.c += r * (f.a * r + f.b);
+                        f.b += (r * f.a) << 1;
+                    }
+
+                    /*!
+                     * @brief Tests if f is reduced. When only the order of a and c or the sign of b is off,
+                     * fixes them and reports f as reduced.
+                     */
+                    static bool test_reduction(form_type &f) {
+                        const integer_type abs_b = abs(f.b);
+                        if (abs(f.a) < abs_b || abs(f.c) < abs_b) {
+                            return false;
+                        }
+                        if (less(f.c, f.a)) {
+                            std::swap(f.a, f.c);
+                            f.b = negate(f.b);
+                        }
+                        if ((f.a == f.c && is_negative(f.b)) || f.b == negate(f.a)) {
+                            f.b = negate(f.b);
+                        }
+                        return true;
+                    }
+
+                    static void reduce(form_type &f) {
+                        std::int64_t a_exp, b_exp, c_exp;
+                        while (!test_reduction(f)) {
+                            std::int64_t a = approximate(f.a, a_exp);
+                            std::int64_t b = approximate(f.b, b_exp);
+                            std::int64_t c = approximate(f.c, c_exp);
+
+                            std::int64_t max_exp = std::max(a_exp, c_exp), min_exp = std::min(a_exp, c_exp);
+                            if (b != 0) {
+                                max_exp = std::max(max_exp, b_exp);
+                                min_exp = std::min(min_exp, b_exp);
+                            }
+
+                            std::int64_t u = 1, v = 0, w = 0, x = 1;
+                            std::size_t steps = 0;
+                            if (max_exp - min_exp <= exp_threshold) {
+                                // a : b : c ratios are the ones of f.a : f.b : f.c, magnitudes are below 2^62
+                                ++max_exp;
+                                a >>= (max_exp - a_exp);
+                                b = b == 0 ? 0 : b >> (max_exp - b_exp);
+                                c >>= (max_exp - c_exp);
+
+                                // Steps (a, b, c) -> (c, 2c * delta - b, c * delta^2 - b * delta + a) on the
+                                // approximations, accumulated into the transformation [[u, v], [w, x]]
+                                while (a > c && c > 0) {
+                                    const std::int64_t delta = b >= 0 ? (b + c) / (2 * c) : -(-b + c) / (2 * c);
+                                    if (delta > threshold || delta < -threshold) {
+                                        break;
+                                    }
+                                    const std::int64_t v_ = -u + delta * v, x_ = -w + delta * x;
+                                    if (v_ > threshold || v_ < -threshold || x_ > threshold || x_ < -threshold) {
+                                        break;
+                                    }
+
+                                    const std::int64_t c_delta = c * delta;
+                                    const std::int64_t gamma = b - c_delta;
+                                    const std::int64_t a_ = c;
+                                    const std::int64_t b_ = 2 * c_delta - b;
+                                    c = a - delta * gamma;
+                                    a = a_;
+                                    b = b_;
+
+                                    u = v;
+                                    v = v_;
+                                    w = x;
+                                    x = x_;
+                                    ++steps;
+                                }
+                            }
+
+                            if (steps == 0) {
+                                // No approximate step was possible, make one exact step
+                                if (less(f.a, abs(f.b)) || f.b == negate(f.a)) {
+                                    normalize(f);
+                                } else {
+                                    std::swap(f.a, f.c);
+                                    f.b = negate(f.b);
+                                    normalize(f);
+                                }
+                                continue;
+                            }
+
+                            const integer_type fa = f.a, fb = f.b, fc = f.c;
+                            f.a = mul_si(fa, u * u) + mul_si(fb, u * w) + mul_si(fc, w * w);
+                            f.b = mul_si(fa, 2 * u * v) + mul_si(fb, u * x + v * w) + mul_si(fc, 2 * w * x);
+                            f.c = mul_si(fa, v * v) + mul_si(fb, v * x) + mul_si(fc, x * x);
+                        }
+                    }
+
+                    /*!
+                     * @brief Lehmer extended Euclid on (by, bx), by >= bx >= 0, until bx <= bound.
+                     *
+                     * Keeps by = -y * bx_0 and bx = -x * bx_0 modulo by_0, starting from y = 0, x = -1.
+                     * Single-word quotient sequences are accepted under Jebelean's condition.
+                     */
+                    static void xgcd_partial(integer_type &by, integer_type &bx, integer_type &y, integer_type &x,
+                                             const integer_type &bound) {
+                        y = 0u;
+                        x = negate(integer_type(1u));
+
+                        integer_type r, q;
+                        while (!bx.is_zero() && bound < bx) {
+                            const std::size_t max_bits = std::max(bits(by), bits(bx));
+                            const std::size_t shift = max_bits > 63 ? max_bits - 63 : 0;
+
+                            std::int64_t rr2 = static_cast<std::int64_t>(static_cast<std::uint64_t>(by >> shift));
+                            std::int64_t rr1 = static_cast<std::int64_t>(static_cast<std::uint64_t>(bx >> shift));
+                            const integer_type shifted_bound = bound >> shift;
+                            const std::int64_t bb =
+                                bits(shifted_bound) > 63 ?
+                                    std::numeric_limits<std::int64_t>::max() :
+                                    static_cast<std::int64_t>(static_cast<std::uint64_t>(shifted_bound));
+
+                            std::int64_t aa2 = 0, aa1 = 1, bb2 = 1, bb1 = 0;
+                            std::size_t i = 0;
+                            for (; rr1 != 0 && rr1 > bb; ++i) {
+                                const std::int64_t qq = rr2 / rr1;
+                                const std::int64_t t1 = rr2 - qq * rr1;
+                                const std::int64_t t2 = aa2 - qq * aa1;
+                                const std::int64_t t3 = bb2 - qq * bb1;
+
+                                if (i & 1) {
+                                    if (t1 < -t3 || rr1 - t1 < t2 - aa1) {
+                                        break;
+                                    }
+                                } else {
+                                    if (t1 < -t2 || rr1 - t1 < t3 - bb1) {
+                                        break;
+                                    }
+                                }
+
+                                rr2 = rr1;
+                                rr1 = t1;
+                                aa2 = aa1;
+                                aa1 = t2;
+                                bb2 = bb1;
+                                bb1 = t3;
+                            }
+
+                            if (i == 0) {
+                                boost::multiprecision::divide_qr(by, bx, q, r);
+                                by = bx;
+                                bx = r;
+                                r = y - x * q;
+                                y = x;
+                                x = r;
+                            } else {
+                                r = mul_si(by, bb2) + mul_si(bx, aa2);
+                                bx = mul_si(bx, aa1) + mul_si(by, bb1);
+                                by = r;
+                                r = mul_si(y, bb2) + mul_si(x, aa2);
+                                x = mul_si(x, aa1) + mul_si(y, bb1);
+                                y = r;
+                                if (is_negative(bx)) {
+                                    x = negate(x);
+                                    bx = negate(bx);
+                                }
+                                if (is_negative(by)) {
+                                    y = negate(y);
+                                    by = negate(by);
+                                }
+                            }
+                        }
+
+                        if (is_negative(by)) {
+                            y = negate(y);
+                            x = negate(x);
+                            by = negate(by);
+                        }
+                    }
+
+                    /*!
+                     * @brief f^2 before reduction.
+                     * @param bound floor(|D|^(1/4)), where the partial gcd stops
+                     */
+                    static void nudupl(form_type &f, const integer_type &bound) {
+                        // G = gcd(a, b) = y * b mod a
+                        integer_type G = f.a, bx = mod(f.b, f.a), y, x;
+                        xgcd_partial(G, bx, y, x, integer_type(0u));
+                        y = negate(y);
+
+                        const integer_type By = f.a / G;
+                        const integer_type Dy = tdiv(f.b, G);
+
+                        bx = mod(y * f.c, By);
+                        integer_type by = By;
+
+                        if (!(bound < by)) {
+                            const integer_type dx = tdiv(bx * Dy - f.c, By);
+                            f.a = by * by;
+                            f.c = bx * bx;
+                            const integer_type t = bx + by;
+                            f.b = f.b - t * t + f.a + f.c;
+                            f.c -= G * dx;
+                            return;
+                        }
+
+                        xgcd_partial(by, bx, y, x, bound);
+
+                        x = negate(x);
+                        if (is_positive(x)) {
+                            y = negate(y);
+                        } else {
+                            by = negate(by);
+                        }
+
+                        const integer_type ax = G * x;
+                        const integer_type ay = G * y;
+
+                        const integer_type dx = tdiv(Dy * bx - f.c * x, By);
+                        const integer_type Q1 = y * dx;
+                        integer_type dy = Q1 + Dy;
+                        f.b = G * (dy + Q1);
+                        dy = tdiv(dy, x);
+                        f.a = by * by;
+                        f.c = bx * bx;
+                        const integer_type t = bx + by;
+                        f.b = f.b - t * t + f.a + f.c;
+                        f.a -= ay * dy;
+                        f.c -= ax * dx;
+                    }
+
+                    static void square(form_type &f, const integer_type &bound) {
+                        nudupl(f, bound);
+                        reduce(f);
+                    }
+
+                    template<typename SignedIntegerType>
+                    static integer_type from_signed(const SignedIntegerType &x) {
+                        std::vector<std::uint8_t> magnitude;
+                        boost::multiprecision::export_bits(SignedIntegerType(boost::multiprecision::abs(x)),
+                                                           std::back_inserter(magnitude), 8);
+                        integer_type result;
+                        boost::multiprecision::import_bits(result, magnitude.begin(), magnitude.end(), 8);
+                        return x < 0 ? negate(result) : result;
+                    }
+
+                    template<typename SignedIntegerType>
+                    static SignedIntegerType to_signed(const integer_type &x) {
+                        std::vector<std::uint8_t> magnitude;
+                        boost::multiprecision::export_bits(abs(x), std::back_inserter(magnitude), 8);
+                        SignedIntegerType result;
+                        boost::multiprecision::import_bits(result, magnitude.begin(), magnitude.end(), 8);
+                        return is_negative(x) ? SignedIntegerType(-result) : result;
+                    }
+
+                    template<typename SignedIntegerType>
+                    static form_type from_signed(const class_group_form<SignedIntegerType> &f) {
+                        return form_type {from_signed(f.a), from_signed(f.b), from_signed(f.c)};
+                    }
+
+                    template<typename SignedIntegerType>
+                    static class_group_form<SignedIntegerType> to_signed(const form_type &f) {
+                        return class_group_form<SignedIntegerType> {to_signed<SignedIntegerType>(f.a),
+                                                                    to_signed<SignedIntegerType>(f.b),
+                                                                    to_signed<SignedIntegerType>(f.c)};
+                    }
+
+                    /*!
+                     * @brief Same as class_group_functions::evaluate, with the squarings done in Bits-bit
+                     * integers. Only the inputs and the checkpoints are converted.
+                     */
+                    template<typename SignedIntegerType>
+                    static class_group_form<SignedIntegerType>
+                        evaluate(const class_group_form<SignedIntegerType> &x, std::size_t iterations,
+                                 const std::vector<std::size_t> &positions,
+                                 std::vector<class_group_form<SignedIntegerType>> &checkpoints) {
+                        const SignedIntegerType d = class_group_functions<SignedIntegerType>::discriminant(x);
+                        const SignedIntegerType abs_d = -d;
+                        if (boost::multiprecision::msb(abs_d) + 1 + reserve_bits > Bits) {
+                            throw std::invalid_argument("Discriminant is too large for the fixed-width class group");
+                        }
+                        const integer_type bound = from_signed(SignedIntegerType(sqrt(SignedIntegerType(sqrt(abs_d)))));
+
+                        const std::size_t last = std::max(iterations, positions.empty() ? 0 : positions.back());
+                        std::vector<form_type> fixed_checkpoints;
+                        fixed_checkpoints.reserve(positions.size());
+
+                        form_type current = from_signed(x), result = current;
+                        auto position = positions.cbegin();
+                        for (std::size_t i = 0;; ++i) {
+                            while (position != positions.cend() && *position == i) {
+                                fixed_checkpoints.push_back(current);
+                                ++position;
+                            }
+                            if (i == iterations) {
+                                result = current;
+                            }
+                            if (i == last) {
+                                break;
+                            }
+                            square(current, bound);
+                        }
+
+                        checkpoints.clear();
+                        checkpoints.reserve(fixed_checkpoints.size());
+                        for (const form_type &checkpoint : fixed_checkpoints) {
+                            checkpoints.push_back(to_signed<SignedIntegerType>(checkpoint));
+                        }
+                        return to_signed<SignedIntegerType>(result);
+                    }
+                };
+            }    // namespace detail
+
+            /*!
+             * @brief Evaluator for wesolowski and pietrzak which squares in Bits-bit cpp_int_modular integers.
+             * Bits must exceed the discriminant size by reserve_bits.
+             */
+            template<unsigned Bits>
+            using fixed_class_group_evaluator = detail::class_group_fixed_functions<Bits>;
+        }    // namespace vdf
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_VDF_CLASS_GROUP_FIXED_HPP
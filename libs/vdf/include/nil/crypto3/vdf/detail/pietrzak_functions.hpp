@@ -22,19 +22,209 @@
 // SOFTWARE.
 //---------------------------------------------------------------------------//
 
-#ifndef CRYPTO3_PIETRZAK_FUNCTIONS_HPP
-#define CRYPTO3_PIETRZAK_FUNCTIONS_HPP
+#ifndef CRYPTO3_VDF_PIETRZAK_FUNCTIONS_HPP
+#define CRYPTO3_VDF_PIETRZAK_FUNCTIONS_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+#include <nil/crypto3/vdf/detail/class_group.hpp>
 #include <nil/crypto3/vdf/detail/pietrzak_policy.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace vdf {
             namespace detail {
-                struct pietrzak_functions : public pietrzak_policy { };
+                /** @brief Pietrzak proofs of y = x^(2^T) in a class group.
+                 *
+                 * Every round halves the claim y = x^(2^t): the prover sends mu = x^(2^(t / 2)) and both sides
+                 * continue with x^r * mu and mu^r * y for a challenge r, squaring y first when t is odd. The
+                 * proof is the list of mu.
+                 *
+                 * In the first rounds x_i is a product of x^(2^p) with exponents made of challenges, so mu_i is
+                 * folded from checkpoints stored during the evaluation instead of being squared again. Folding
+                 * round i costs 2^i exponentiations by challenges, which run in parallel; the remaining rounds
+                 * square x_i directly.
+                 */
+                struct pietrzak_functions : public pietrzak_policy {
+                    typedef pietrzak_policy policy_type;
+
+                    template<typename IntegerType>
+                    struct proof_type {
+                        class_group_form<IntegerType> y;
+                        std::vector<class_group_form<IntegerType>> intermediates;
+
+                        bool operator==(const proof_type &other) const {
+                            return y == other.y && intermediates == other.intermediates;
+                        }
+
+                        bool operator!=(const proof_type &other) const {
+                            return !(*this == other);
+                        }
+                    };
+
+                    // Halves t_i / 2 of the rounds, where t_i is the even claim length of round i
+                    static std::vector<std::size_t> halves(std::size_t iterations) {
+                        std::vector<std::size_t> result;
+                        for (std::size_t t = iterations; t > 1; t /= 2) {
+                            if (t % 2 != 0) {
+                                ++t;
+                            }
+                            result.push_back(t / 2);
+                        }
+                        return result;
+                    }
+
+                    // Balances T / 2^d squarings of the direct rounds against about 2^d exponentiations
+                    static std::size_t default_folded_rounds(std::size_t iterations, std::size_t rounds) {
+                        std::size_t result = 0;
+                        while (result < rounds &&
+                               (std::size_t(1) << (2 * result + 2)) * 3 * challenge_bits / 2 <= iterations) {
+                            ++result;
+                        }
+                        return result;
+                    }
+
+                    template<typename Hash, typename IntegerType>
+                    static IntegerType challenge(const IntegerType &d, const class_group_form<IntegerType> &x,
+                                                 const class_group_form<IntegerType> &y,
+                                                 const class_group_form<IntegerType> &mu, std::size_t t) {
+                        typedef class_group_functions<IntegerType> group_type;
+
+                        std::vector<std::uint8_t> data;
+                        group_type::serialize(data, d);
+                        group_type::serialize(data, x);
+                        group_type::serialize(data, y);
+                        group_type::serialize(data, mu);
+                        group_type::serialize(data, IntegerType(t));
+                        return group_type::template hash_to_integer<Hash>(data, challenge_bits);
+                    }
+
+                    template<typename Hash, typename Evaluator, typename IntegerType>
+                    static proof_type<IntegerType> prove(const IntegerType &d, const class_group_form<IntegerType> &x,
+                                                         std::size_t iterations, std::size_t folded_rounds) {
+                        typedef class_group_functions<IntegerType> group_type;
+                        typedef class_group_form<IntegerType> form_type;
+
+                        if (iterations == 0) {
+                            throw std::invalid_argument("VDF needs at least one iteration");
+                        }
+
+                        const std::vector<std::size_t> h = halves(iterations);
+                        folded_rounds = std::min(
+                            folded_rounds != 0 ? folded_rounds : default_folded_rounds(iterations, h.size()),
+                            h.size());
+
+                        // Checkpoint of round i and subset m of the previous rounds is x^(2^(h_i + sum_m h_j))
+                        std::vector<std::vector<std::size_t>> offsets(folded_rounds);
+                        std::vector<std::size_t> positions;
+                        for (std::size_t i = 0; i < folded_rounds; ++i) {
+                            offsets[i].resize(std::size_t(1) << i);
+                            for (std::size_t m = 0; m < offsets[i].size(); ++m) {
+                                std::size_t offset = h[i];
+                                for (std::size_t j = 0; j < i; ++j) {
+                                    if ((m >> j) & 1) {
+                                        offset += h[j];
+                                    }
+                                }
+                                offsets[i][m] = offset;
+                                positions.push_back(offset);
+                            }
+                        }
+                        std::sort(positions.begin(), positions.end());
+                        positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+
+                        std::vector<form_type> checkpoints;
+                        proof_type<IntegerType> result;
+                        result.y = Evaluator::evaluate(x, iterations, positions, checkpoints);
+                        result.intermediates.reserve(h.size());
+
+                        auto checkpoint = [&](std::size_t position) -> const form_type & {
+                            return checkpoints[std::lower_bound(positions.begin(), positions.end(), position) -
+                                               positions.begin()];
+                        };
+
+                        std::vector<IntegerType> challenges;
+                        form_type xi = x, yi = result.y;
+                        std::size_t t = iterations;
+                        for (std::size_t i = 0; i < h.size(); ++i) {
+                            if (t % 2 != 0) {
+                                yi = group_type::square(yi);
+                                ++t;
+                            }
+
+                            form_type mu;
+                            if (i < folded_rounds) {
+                                std::vector<form_type> folded(offsets[i].size());
+                                for (std::size_t m = 0; m < folded.size(); ++m) {
+                                    folded[m] = checkpoint(offsets[i][m]);
+                                }
+                                // Subsets without round j get the factor r_j
+                                for (std::size_t j = 0; j < i; ++j) {
+                                    std::vector<form_type> next(folded.size() / 2);
+                                    parallelization::parallel_for(0, next.size(), [&](std::size_t k) {
+                                        next[k] =
+                                            group_type::compose(group_type::pow(folded[2 * k], challenges[j]),
+                                                                folded[2 * k + 1]);
+                                    });
+                                    folded = std::move(next);
+                                }
+                                mu = folded[0];
+                            } else {
+                                mu = xi;
+                                for (std::size_t s = 0; s < h[i]; ++s) {
+                                    mu = group_type::square(mu);
+                                }
+                            }
+
+                            const IntegerType r = challenge<Hash>(d, xi, yi, mu, t);
+                            challenges.push_back(r);
+                            result.intermediates.push_back(mu);
+                            if (i + 1 < h.size()) {
+                                xi = group_type::compose(group_type::pow(xi, r), mu);
+                                yi = group_type::compose(group_type::pow(mu, r), yi);
+                            }
+                            t /= 2;
+                        }
+                        return result;
+                    }
+
+                    template<typename Hash, typename IntegerType>
+                    static bool verify(const IntegerType &d, const class_group_form<IntegerType> &x,
+                                       std::size_t iterations, const proof_type<IntegerType> &proof) {
+                        typedef class_group_functions<IntegerType> group_type;
+                        typedef class_group_form<IntegerType> form_type;
+
+                        if (iterations == 0 || !group_type::is_valid(x, d) || !group_type::is_valid(proof.y, d) ||
+                            proof.intermediates.size() != halves(iterations).size()) {
+                            return false;
+                        }
+
+                        form_type xi = x, yi = proof.y;
+                        std::size_t t = iterations;
+                        for (const form_type &mu : proof.intermediates) {
+                            if (!group_type::is_valid(mu, d)) {
+                                return false;
+                            }
+                            if (t % 2 != 0) {
+                                yi = group_type::square(yi);
+                                ++t;
+                            }
+                            const IntegerType r = challenge<Hash>(d, xi, yi, mu, t);
+                            xi = group_type::compose(group_type::pow(xi, r), mu);
+                            yi = group_type::compose(group_type::pow(mu, r), yi);
+                            t /= 2;
+                        }
+                        return t == 1 && group_type::square(xi) == yi;
+                    }
+                };
             }    // namespace detail
         }        // namespace vdf
     }            // namespace crypto3
 }    // namespace nil
 
-#endif    // CRYPTO3_PIETRZAK_POLICY_HPP
+#endif    // CRYPTO3_VDF_PIETRZAK_FUNCTIONS_HPP
@@ -25,11 +25,16 @@
 #ifndef CRYPTO3_VDF_PIETRZAK_POLICY_HPP
 #define CRYPTO3_VDF_PIETRZAK_POLICY_HPP
 
+#include <cstddef>
+
 namespace nil {
     namespace crypto3 {
         namespace vdf {
             namespace detail {
-                struct pietrzak_policy { };
+                struct pietrzak_policy {
+                    // Bit length of the challenges r_i of the halving rounds
+                    constexpr static const std::size_t challenge_bits = 128;
+                };
             }    // namespace detail
         }        // namespace vdf
     }            // namespace crypto3
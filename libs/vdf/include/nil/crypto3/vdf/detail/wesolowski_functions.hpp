@@ -25,16 +25,250 @@
 #ifndef CRYPTO3_VDF_WESOLOWSKI_FUNCTIONS_HPP
 #define CRYPTO3_VDF_WESOLOWSKI_FUNCTIONS_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/multiprecision/integer.hpp>
+
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+#include <nil/crypto3/vdf/detail/class_group.hpp>
 #include <nil/crypto3/vdf/detail/wesolowski_policy.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace vdf {
             namespace detail {
-                struct wesolowski_functions : public wesolowski_policy { };
+                /** @brief Wesolowski proofs of y = x^(2^T) in a class group.
+                 *
+                 * The proof is pi = x^floor(2^T / l) for a prime l derived from x and y, the verifier checks
+                 * pi^l * x^(2^T mod l) = y. The evaluation can be split in segments, each with its own proof.
+                 * A segment proof only needs the checkpoints of its segment, so it is computed by other
+                 * threads while squaring goes on with the next segment, and the proof is ready shortly after
+                 * the last squaring.
+                 */
+                struct wesolowski_functions : public wesolowski_policy {
+                    typedef wesolowski_policy policy_type;
+
+                    template<typename IntegerType>
+                    struct segment_type {
+                        std::size_t iterations;
+                        class_group_form<IntegerType> y;
+                        class_group_form<IntegerType> proof;
+
+                        bool operator==(const segment_type &other) const {
+                            return iterations == other.iterations && y == other.y && proof == other.proof;
+                        }
+
+                        bool operator!=(const segment_type &other) const {
+                            return !(*this == other);
+                        }
+                    };
+
+                    // Segment i proves y_i = y_{i - 1}^(2^iterations_i), where y_{-1} is the input
+                    template<typename IntegerType>
+                    using proof_type = std::vector<segment_type<IntegerType>>;
+
+                    template<typename Hash, typename IntegerType>
+                    static IntegerType challenge(const IntegerType &d, const class_group_form<IntegerType> &x,
+                                                 const class_group_form<IntegerType> &y, std::size_t iterations) {
+                        typedef class_group_functions<IntegerType> group_type;
+
+                        std::vector<std::uint8_t> data;
+                        group_type::serialize(data, d);
+                        group_type::serialize(data, x);
+                        group_type::serialize(data, y);
+                        group_type::serialize(data, IntegerType(iterations));
+                        return group_type::template hash_to_prime<Hash>(data, prime_bits);
+                    }
+
+                    // Beyond this the 2^k buckets of prove_segment outweigh any saving on the compositions
+                    constexpr static const std::size_t max_checkpoint_interval = 20;
+
+                    /*!
+                     * @brief Checkpoint interval k which minimizes the proof time: T / k compositions to fill the
+                     * buckets, split between the threads, and 2^(k + 1) to combine the buckets of each thread.
+                     */
+                    static std::size_t default_checkpoint_interval(std::size_t iterations, std::size_t concurrency) {
+                        std::size_t best = 1;
+                        double best_cost = static_cast<double>(iterations);
+                        for (std::size_t k = 1; k <= max_checkpoint_interval; ++k) {
+                            const double cost = static_cast<double>(iterations) / (k * concurrency) +
+                                                static_cast<double>(std::size_t(2) << k);
+                            if (cost < best_cost) {
+                                best = k;
+                                best_cost = cost;
+                            }
+                        }
+                        return best;
+                    }
+
+                    /*!
+                     * @brief Computes x^floor(2^T / l) from checkpoints[i] = x^(2^(k * i)), i < ceil(T / k).
+                     *
+                     * floor(2^T / l) is split in k-bit digits b_i = floor(2^k * (2^(T - k(i + 1)) mod l) / l),
+                     * checkpoints are multiplied into one bucket per digit value and the buckets are combined
+                     * as prod_b bucket_b^b (Wesolowski, "Efficient verifiable delay functions", section 4.1).
+                     */
+                    template<typename IntegerType>
+                    static class_group_form<IntegerType>
+                        prove_segment(const IntegerType &l, std::size_t iterations, std::size_t k,
+                                      const std::vector<class_group_form<IntegerType>> &checkpoints) {
+                        typedef class_group_functions<IntegerType> group_type;
+                        typedef class_group_form<IntegerType> form_type;
+
+                        if (k == 0 || k > max_checkpoint_interval) {
+                            throw std::invalid_argument("Wrong VDF checkpoint interval");
+                        }
+
+                        const std::size_t blocks = (iterations + k - 1) / k;
+                        BOOST_ASSERT(checkpoints.size() >= blocks);
+
+                        std::vector<std::uint32_t> digits(blocks);
+                        IntegerType r;
+                        bool is_r_set = false;
+                        for (std::size_t i = blocks; i-- > 0;) {
+                            if (iterations < k * (i + 1)) {
+                                digits[i] =
+                                    static_cast<std::uint32_t>((IntegerType(1) << (iterations - k * i)) / l);
+                                continue;
+                            }
+                            if (!is_r_set) {
+                                r = boost::multiprecision::powm(IntegerType(2),
+                                                                IntegerType(iterations - k * (i + 1)), l);
+                                is_r_set = true;
+                            } else {
+                                r = (r << k) % l;
+                            }
+                            digits[i] = static_cast<std::uint32_t>((r << k) / l);
+                        }
+
+                        const form_type identity = group_type::identity(group_type::discriminant(checkpoints[0]));
+                        return parallelization::parallel_reduce(
+                            0, blocks, identity,
+                            [&](std::size_t begin, std::size_t end) {
+                                std::vector<form_type> buckets(std::size_t(1) << k);
+                                std::vector<bool> is_set(buckets.size(), false);
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    const std::uint32_t digit = digits[i];
+                                    if (digit == 0) {
+                                        continue;
+                                    }
+                                    buckets[digit] =
+                                        is_set[digit] ? group_type::compose(buckets[digit], checkpoints[i]) :
+                                                        checkpoints[i];
+                                    is_set[digit] = true;
+                                }
+
+                                // sum_b b * bucket_b as a sum of suffix sums
+                                form_type suffix = identity, result = identity;
+                                bool is_suffix_set = false;
+                                for (std::size_t digit = buckets.size(); digit-- > 1;) {
+                                    if (is_set[digit]) {
+                                        suffix = is_suffix_set ? group_type::compose(suffix, buckets[digit]) :
+                                                                 buckets[digit];
+                                        is_suffix_set = true;
+                                    }
+                                    if (is_suffix_set) {
+                                        result = group_type::compose(result, suffix);
+                                    }
+                                }
+                                return result;
+                            },
+                            [](const form_type &a, const form_type &b) { return group_type::compose(a, b); });
+                    }
+
+                    template<typename Hash, typename Evaluator, typename IntegerType>
+                    static proof_type<IntegerType> prove(const IntegerType &d, const class_group_form<IntegerType> &x,
+                                                         std::size_t iterations, std::size_t segments_count,
+                                                         std::size_t checkpoint_interval) {
+                        typedef class_group_form<IntegerType> form_type;
+
+                        if (segments_count == 0 || segments_count > iterations) {
+                            throw std::invalid_argument("Wrong number of VDF segments");
+                        }
+                        if (checkpoint_interval > max_checkpoint_interval) {
+                            throw std::invalid_argument("Wrong VDF checkpoint interval");
+                        }
+
+                        proof_type<IntegerType> result(segments_count);
+                        parallelization::task_group proofs;
+                        form_type current = x;
+                        for (std::size_t s = 0; s < segments_count; ++s) {
+                            const std::size_t segment_iterations =
+                                iterations * (s + 1) / segments_count - iterations * s / segments_count;
+                            const std::size_t k =
+                                checkpoint_interval != 0 ?
+                                    checkpoint_interval :
+                                    default_checkpoint_interval(segment_iterations,
+                                                                proofs.get_executor().concurrency());
+
+                            std::vector<std::size_t> positions;
+                            for (std::size_t p = 0; p < segment_iterations; p += k) {
+                                positions.push_back(p);
+                            }
+                            auto checkpoints = std::make_shared<std::vector<form_type>>();
+                            const form_type y =
+                                Evaluator::evaluate(current, segment_iterations, positions, *checkpoints);
+
+                            result[s].iterations = segment_iterations;
+                            result[s].y = y;
+                            proofs.run([&d, &result, s, k, segment_iterations, checkpoints, current, y]() {
+                                const IntegerType l = challenge<Hash>(d, current, y, segment_iterations);
+                                result[s].proof = prove_segment(l, segment_iterations, k, *checkpoints);
+                            });
+                            current = y;
+                        }
+                        proofs.wait();
+                        return result;
+                    }
+
+                    template<typename Hash, typename IntegerType>
+                    static bool verify_segment(const IntegerType &d, const class_group_form<IntegerType> &x,
+                                               const segment_type<IntegerType> &segment) {
+                        typedef class_group_functions<IntegerType> group_type;
+
+                        if (!group_type::is_valid(segment.y, d) || !group_type::is_valid(segment.proof, d)) {
+                            return false;
+                        }
+                        const IntegerType l = challenge<Hash>(d, x, segment.y, segment.iterations);
+                        const IntegerType r =
+                            boost::multiprecision::powm(IntegerType(2), IntegerType(segment.iterations), l);
+                        return group_type::compose(group_type::pow(segment.proof, l), group_type::pow(x, r)) ==
+                               segment.y;
+                    }
+
+                    template<typename Hash, typename IntegerType>
+                    static bool verify(const IntegerType &d, const class_group_form<IntegerType> &x,
+                                       std::size_t iterations, const proof_type<IntegerType> &proof) {
+                        typedef class_group_functions<IntegerType> group_type;
+
+                        if (proof.empty() || !group_type::is_valid(x, d)) {
+                            return false;
+                        }
+                        std::size_t total_iterations = 0;
+                        for (const auto &segment : proof) {
+                            total_iterations += segment.iterations;
+                        }
+                        if (total_iterations != iterations) {
+                            return false;
+                        }
+
+                        std::atomic<bool> is_valid(true);
+                        parallelization::parallel_for(0, proof.size(), [&](std::size_t s) {
+                            if (!verify_segment<Hash>(d, s == 0 ? x : proof[s - 1].y, proof[s])) {
+                                is_valid = false;
+                            }
+                        });
+                        return is_valid;
+                    }
+                };
             }    // namespace detail
         }        // namespace vdf
     }            // namespace crypto3
 }    // namespace nil
 
-#endif    // CRYPTO3_WESOLOWSKI_POLICY_HPP
+#endif    // CRYPTO3_VDF_WESOLOWSKI_FUNCTIONS_HPP
@@ -25,11 +25,16 @@
 #ifndef CRYPTO3_VDF_WESOLOWSKI_POLICY_HPP
 #define CRYPTO3_VDF_WESOLOWSKI_POLICY_HPP
 
+#include <cstddef>
+
 namespace nil {
     namespace crypto3 {
         namespace vdf {
             namespace detail {
-                struct wesolowski_policy { };
+                struct wesolowski_policy {
+                    // Bit length of the challenge prime l
+                    constexpr static const std::size_t prime_bits = 256;
+                };
             }    // namespace detail
         }        // namespace vdf
     }            // namespace crypto3
@@ -25,15 +25,54 @@
 #ifndef CRYPTO3_VDF_PIETRZAK_HPP
 #define CRYPTO3_VDF_PIETRZAK_HPP
 
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/vdf/detail/class_group_fixed.hpp>
 #include <nil/crypto3/vdf/detail/pietrzak_functions.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace vdf {
+            /*!
+             * @brief Pietrzak VDF over the class group of an imaginary quadratic field.
+             *
+             * Proofs hold log2(T) forms and take longer to check than Wesolowski proofs, but the prover only
+             * exponentiates by short challenges.
+             */
             class pietrzak {
                 typedef detail::pietrzak_functions policy_type;
 
             public:
+                template<typename IntegerType>
+                using form_type = class_group_form<IntegerType>;
+
+                template<typename IntegerType>
+                using proof_type = typename policy_type::template proof_type<IntegerType>;
+
+                /*!
+                 * @brief Computes x^(2^iterations) with its proof.
+                 * @tparam Evaluator squaring backend, fixed_class_group_evaluator<Bits> squares without
+                 * allocations
+                 * @param folded_rounds rounds whose intermediate values are folded from checkpoints, chosen
+                 * from the number of iterations when 0
+                 */
+                template<typename Hash = hashes::sha2<256>, typename Evaluator = detail::class_group_evaluator,
+                         typename IntegerType>
+                static proof_type<IntegerType> prove(const IntegerType &discriminant, const form_type<IntegerType> &x,
+                                                     std::size_t iterations, std::size_t folded_rounds = 0) {
+                    return policy_type::template prove<Hash, Evaluator>(discriminant, x, iterations, folded_rounds);
+                }
+
+                template<typename Hash = hashes::sha2<256>, typename IntegerType>
+                static bool verify(const IntegerType &discriminant, const form_type<IntegerType> &x,
+                                   std::size_t iterations, const proof_type<IntegerType> &proof) {
+                    return policy_type::template verify<Hash>(discriminant, x, iterations, proof);
+                }
+
+                template<typename IntegerType>
+                static const form_type<IntegerType> &output(const proof_type<IntegerType> &proof) {
+                    return proof.y;
+                }
             };
         }    // namespace vdf
     }        // namespace crypto3
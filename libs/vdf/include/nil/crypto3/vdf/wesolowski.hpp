@@ -25,15 +25,57 @@
 #ifndef CRYPTO3_VDF_WESOLOWSKI_HPP
 #define CRYPTO3_VDF_WESOLOWSKI_HPP
 
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/vdf/detail/class_group_fixed.hpp>
 #include <nil/crypto3/vdf/detail/wesolowski_functions.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace vdf {
+            /*!
+             * @brief Wesolowski VDF over the class group of an imaginary quadratic field.
+             *
+             * The evaluation can be split in segments whose proofs are computed in the background while
+             * squaring continues, the proof then holds one (y, pi) pair per segment.
+             */
             class wesolowski {
                 typedef detail::wesolowski_functions policy_type;
 
             public:
+                template<typename IntegerType>
+                using form_type = class_group_form<IntegerType>;
+
+                template<typename IntegerType>
+                using proof_type = typename policy_type::template proof_type<IntegerType>;
+
+                /*!
+                 * @brief Computes x^(2^iterations) with its proof.
+                 * @tparam Evaluator squaring backend, fixed_class_group_evaluator<Bits> squares without
+                 * allocations
+                 * @param checkpoint_interval squarings between stored checkpoints, chosen from the number of
+                 * iterations and threads when 0, at most 20
+                 */
+                template<typename Hash = hashes::sha2<256>, typename Evaluator = detail::class_group_evaluator,
+                         typename IntegerType>
+                static proof_type<IntegerType> prove(const IntegerType &discriminant, const form_type<IntegerType> &x,
+                                                     std::size_t iterations, std::size_t segments_count = 1,
+                                                     std::size_t checkpoint_interval = 0) {
+                    return policy_type::template prove<Hash, Evaluator>(discriminant, x, iterations, segments_count,
+                                                                        checkpoint_interval);
+                }
+
+                template<typename Hash = hashes::sha2<256>, typename IntegerType>
+                static bool verify(const IntegerType &discriminant, const form_type<IntegerType> &x,
+                                   std::size_t iterations, const proof_type<IntegerType> &proof) {
+                    return policy_type::template verify<Hash>(discriminant, x, iterations, proof);
+                }
+
+                // x^(2^iterations), the output of the last segment
+                template<typename IntegerType>
+                static const form_type<IntegerType> &output(const proof_type<IntegerType> &proof) {
+                    return proof.back().y;
+                }
             };
         }    // namespace vdf
     }        // namespace crypto3
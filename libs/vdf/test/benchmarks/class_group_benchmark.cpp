@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE class_group_benchmark_test
+
+#include <nil/crypto3/vdf/pietrzak.hpp>
+#include <nil/crypto3/vdf/wesolowski.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::vdf;
+
+typedef boost::multiprecision::cpp_int integer_type;
+typedef hashes::sha2<256> hash_type;
+typedef detail::class_group_functions<integer_type> group_type;
+typedef class_group_form<integer_type> form_type;
+
+static integer_type test_discriminant() {
+    return group_type::create_discriminant<hash_type>(std::vector<std::uint8_t> {0x76, 0x64, 0x66}, 256);
+}
+
+BOOST_AUTO_TEST_SUITE(class_group_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(wesolowski_prove_verify_benchmark) {
+    const integer_type d = test_discriminant();
+    const form_type g = group_type::generator(d);
+    const std::size_t iterations = 1 << 14;
+
+    auto start = std::chrono::steady_clock::now();
+    const auto proof = wesolowski::prove<hash_type>(d, g, iterations);
+    auto proved = std::chrono::steady_clock::now();
+    BOOST_CHECK(wesolowski::verify<hash_type>(d, g, iterations, proof));
+    auto verified = std::chrono::steady_clock::now();
+
+    std::cout << "Wesolowski, " << iterations << " iterations: prove "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(proved - start).count() << " ms, verify "
+              << std::chrono::duration_cast<std::chrono::microseconds>(verified - proved).count() << " us"
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(pietrzak_prove_verify_benchmark) {
+    const integer_type d = test_discriminant();
+    const form_type g = group_type::generator(d);
+    const std::size_t iterations = 1 << 14;
+
+    auto start = std::chrono::steady_clock::now();
+    const auto proof = pietrzak::prove<hash_type>(d, g, iterations);
+    auto proved = std::chrono::steady_clock::now();
+    BOOST_CHECK(pietrzak::verify<hash_type>(d, g, iterations, proof));
+    auto verified = std::chrono::steady_clock::now();
+
+    std::cout << "Pietrzak, " << iterations << " iterations: prove "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(proved - start).count() << " ms, verify "
+              << std::chrono::duration_cast<std::chrono::microseconds>(verified - proved).count() << " us"
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(fixed_width_squaring_benchmark) {
+    typedef fixed_class_group_evaluator<384> evaluator_type;
+
+    const integer_type d = test_discriminant();
+    const form_type g = group_type::generator(d);
+    const std::size_t iterations = 2000;
+
+    std::vector<form_type> checkpoints, fixed_checkpoints;
+    auto start = std::chrono::steady_clock::now();
+    const form_type y = detail::class_group_evaluator::evaluate(g, iterations, {}, checkpoints);
+    auto generic_done = std::chrono::steady_clock::now();
+    const form_type fixed_y = evaluator_type::evaluate(g, iterations, {}, fixed_checkpoints);
+    auto fixed_done = std::chrono::steady_clock::now();
+
+    BOOST_CHECK(y == fixed_y);
+    std::cout << "Squarings per second: generic "
+              << iterations * 1000000 /
+                     (std::chrono::duration_cast<std::chrono::microseconds>(generic_done - start).count() + 1)
+              << ", fixed width "
+              << iterations * 1000000 /
+                     (std::chrono::duration_cast<std::chrono::microseconds>(fixed_done - generic_done).count() + 1)
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
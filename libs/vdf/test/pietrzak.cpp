@@ -26,24 +26,51 @@
 
 #include <nil/crypto3/vdf/pietrzak.hpp>
 
-#include <nil/crypto3/vdf/algorithm/compute.hpp>
-#include <nil/crypto3/vdf/algorithm/verify.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
 
-#include <boost/test/unit_test.hpp>
-#include <boost/test/data/test_case.hpp>
-#include <boost/test/data/monomorphic.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
 
-#include <boost/static_assert.hpp>
+#include <boost/test/unit_test.hpp>
 
-#include <iostream>
-#include <string>
-#include <unordered_map>
+#include <cstdint>
+#include <vector>
 
+using namespace nil::crypto3;
 using namespace nil::crypto3::vdf;
 
+typedef boost::multiprecision::cpp_int integer_type;
+typedef hashes::sha2<256> hash_type;
+typedef detail::class_group_functions<integer_type> group_type;
+typedef class_group_form<integer_type> form_type;
+
+static integer_type test_discriminant() {
+    return group_type::create_discriminant<hash_type>(std::vector<std::uint8_t> {0x76, 0x64, 0x66}, 256);
+}
+
 BOOST_AUTO_TEST_SUITE(pietrzak_test_suite)
 
 BOOST_AUTO_TEST_CASE(pietrzak_vdf) {
+    const integer_type d = test_discriminant();
+    const form_type g = group_type::generator(d);
+
+    for (std::size_t iterations : {1, 2, 3, 17, 100, 1001}) {
+        for (std::size_t folded_rounds : {0, 1, 3, 20}) {
+            const auto proof = pietrzak::prove<hash_type>(d, g, iterations, folded_rounds);
+            BOOST_CHECK(pietrzak::output(proof) == group_type::pow(g, integer_type(1) << iterations));
+            BOOST_CHECK(pietrzak::verify<hash_type>(d, g, iterations, proof));
+            BOOST_CHECK(!pietrzak::verify<hash_type>(d, g, iterations + 1, proof));
+
+            auto wrong_proof = proof;
+            wrong_proof.y = group_type::square(wrong_proof.y);
+            BOOST_CHECK(!pietrzak::verify<hash_type>(d, g, iterations, wrong_proof));
+
+            if (!proof.intermediates.empty()) {
+                wrong_proof = proof;
+                wrong_proof.intermediates.front() = group_type::compose(wrong_proof.intermediates.front(), g);
+                BOOST_CHECK(!pietrzak::verify<hash_type>(d, g, iterations, wrong_proof));
+            }
+        }
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -26,24 +26,104 @@
 
 #include <nil/crypto3/vdf/wesolowski.hpp>
 
-#include <nil/crypto3/vdf/algorithm/compute.hpp>
-#include <nil/crypto3/vdf/algorithm/verify.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
 
-#include <boost/test/unit_test.hpp>
-#include <boost/test/data/test_case.hpp>
-#include <boost/test/data/monomorphic.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
 
-#include <boost/static_assert.hpp>
+#include <boost/test/unit_test.hpp>
 
-#include <iostream>
-#include <string>
-#include <unordered_map>
+#include <cstdint>
+#include <vector>
 
+using namespace nil::crypto3;
 using namespace nil::crypto3::vdf;
 
+typedef boost::multiprecision::cpp_int integer_type;
+typedef hashes::sha2<256> hash_type;
+typedef detail::class_group_functions<integer_type> group_type;
+typedef class_group_form<integer_type> form_type;
+
+static integer_type test_discriminant() {
+    return group_type::create_discriminant<hash_type>(std::vector<std::uint8_t> {0x76, 0x64, 0x66}, 256);
+}
+
 BOOST_AUTO_TEST_SUITE(wesolowski_test_suite)
 
+BOOST_AUTO_TEST_CASE(wesolowski_class_group) {
+    const integer_type d = test_discriminant();
+    const form_type g = group_type::generator(d);
+    BOOST_CHECK(group_type::is_valid(g, d));
+
+    const form_type a = group_type::pow(g, 12345), b = group_type::pow(g, 999), c = group_type::pow(g, 31337);
+    BOOST_CHECK(group_type::compose(group_type::compose(a, b), c) == group_type::compose(a, group_type::compose(b, c)));
+    BOOST_CHECK(group_type::compose(a, group_type::inverse(a)) == group_type::identity(d));
+    BOOST_CHECK(group_type::pow(g, 12345 + 999) == group_type::compose(a, b));
+
+    std::vector<form_type> checkpoints;
+    const form_type y = group_type::evaluate(g, 100, {0, 10, 200}, checkpoints);
+    BOOST_CHECK(y == group_type::pow(g, integer_type(1) << 100));
+    BOOST_CHECK_EQUAL(checkpoints.size(), 3);
+    BOOST_CHECK(checkpoints[0] == g);
+    BOOST_CHECK(checkpoints[1] == group_type::pow(g, integer_type(1) << 10));
+    BOOST_CHECK(checkpoints[2] == group_type::pow(g, integer_type(1) << 200));
+}
+
 BOOST_AUTO_TEST_CASE(wesolowski_vdf) {
+    const integer_type d = test_discriminant();
+    const form_type g = group_type::generator(d);
+
+    for (std::size_t iterations : {1, 2, 3, 17, 100, 1001}) {
+        for (std::size_t segments_count : {1, 3}) {
+            if (segments_count > iterations) {
+                continue;
+            }
+            for (std::size_t checkpoint_interval : {0, 1, 4}) {
+                const auto proof =
+                    wesolowski::prove<hash_type>(d, g, iterations, segments_count, checkpoint_interval);
+                BOOST_CHECK_EQUAL(proof.size(), segments_count);
+                BOOST_CHECK(wesolowski::output(proof) == group_type::pow(g, integer_type(1) << iterations));
+                BOOST_CHECK(wesolowski::verify<hash_type>(d, g, iterations, proof));
+                BOOST_CHECK(!wesolowski::verify<hash_type>(d, g, iterations + 1, proof));
+
+                auto wrong_proof = proof;
+                wrong_proof.back().y = group_type::square(wrong_proof.back().y);
+                BOOST_CHECK(!wesolowski::verify<hash_type>(d, g, iterations, wrong_proof));
+
+                wrong_proof = proof;
+                wrong_proof.front().proof = group_type::compose(wrong_proof.front().proof, g);
+                BOOST_CHECK(!wesolowski::verify<hash_type>(d, g, iterations, wrong_proof));
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW(wesolowski::prove<hash_type>(d, g, 100, 1, 21), std::invalid_argument);
+    BOOST_CHECK_THROW(wesolowski::prove<hash_type>(d, g, 100, 1, 32), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(wesolowski_fixed_width_evaluator) {
+    typedef fixed_class_group_evaluator<384> evaluator_type;
+
+    const integer_type d = test_discriminant();
+    const form_type g = group_type::generator(d);
+    const std::size_t iterations = 2000;
+
+    std::vector<std::size_t> positions;
+    for (std::size_t i = 0; i <= iterations; i += 7) {
+        positions.push_back(i);
+    }
+
+    std::vector<form_type> checkpoints, fixed_checkpoints;
+    const form_type y = detail::class_group_evaluator::evaluate(g, iterations, positions, checkpoints);
+    const form_type fixed_y = evaluator_type::evaluate(g, iterations, positions, fixed_checkpoints);
+
+    BOOST_CHECK(y == fixed_y);
+    BOOST_CHECK(checkpoints == fixed_checkpoints);
+
+    const auto proof = wesolowski::prove<hash_type, evaluator_type>(d, g, iterations, 2);
+    BOOST_CHECK(wesolowski::verify<hash_type>(d, g, iterations, proof));
+
+    BOOST_CHECK_THROW(fixed_class_group_evaluator<256>::evaluate(g, iterations, positions, fixed_checkpoints),
+                      std::invalid_argument);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
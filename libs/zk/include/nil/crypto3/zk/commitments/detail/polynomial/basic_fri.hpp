@@ -45,6 +45,8 @@
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
 
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
@@ -377,32 +379,34 @@ namespace nil {
                         detail::fri_field_element_consumer<FRI>(coset_size)
                     );
 
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+                    // Leaves are independent, each one only writes its own consumer
+                    parallelization::parallel_for(
+                        0, leafs_number, [&f, &y_data, domain_size, coset_size](std::size_t x_index) {
+                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+                            s_indices[0][0] = x_index;
+                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
 
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        element_consumer.consume(f[s_indices[0][0]]);
-                        element_consumer.consume(f[s_indices[0][1]]);
+                            auto& element_consumer = y_data[x_index].reset_cursor();
+                            element_consumer.consume(f[s_indices[0][0]]);
+                            element_consumer.consume(f[s_indices[0][1]]);
 
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
+                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                            std::size_t prev_half_size = 1;
+                            std::size_t i = 1;
+                            while (i < coset_size / FRI::m) {
+                                for (std::size_t j = 0; j < prev_half_size; j++) {
+                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
 
-                                element_consumer.consume(f[s_indices[i][0]]);
-                                element_consumer.consume(f[s_indices[i][1]]);
+                                    element_consumer.consume(f[s_indices[i][0]]);
+                                    element_consumer.consume(f[s_indices[i][1]]);
 
-                                i++;
+                                    i++;
+                                }
+                                base_index /= FRI::m;
+                                prev_half_size <<= 1;
                             }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
-                        }
-                    }
+                        });
 
                     return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
                                                                                                      y_data.end());
@@ -448,11 +452,13 @@ namespace nil {
                 ) {
                     PROFILE_PLACEHOLDER_SCOPE("Basic FRI Precommit time");
 
-                    for (std::size_t i = 0; i < poly.size(); ++i) {
+                    // Domains build their FFT caches on first use, do it before D is shared between threads
+                    D->prepare_fft_cache();
+                    parallelization::parallel_for(0, poly.size(), [&poly, &D](std::size_t i) {
                         if (poly[i].size() != D->size()) {
                             poly[i].resize(D->size(), nullptr, D);
                         }
-                    }
+                    });
 
                     std::size_t domain_size = D->size();
                     std::size_t list_size = poly.size();
@@ -463,33 +469,34 @@ namespace nil {
                         detail::fri_field_element_consumer<FRI>(coset_size * list_size)
                     );
 
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        auto& element_consumer = y_data[x_index].reset_cursor();
-                        for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
-
-                                    i++;
+                    parallelization::parallel_for(
+                        0, leafs_number, [&poly, &y_data, domain_size, list_size, coset_size](std::size_t x_index) {
+                            auto& element_consumer = y_data[x_index].reset_cursor();
+                            for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
+                                s_indices[0][0] = x_index;
+                                s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
+
+                                element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
+                                element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
+
+                                std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                                std::size_t prev_half_size = 1;
+                                std::size_t i = 1;
+                                while (i < coset_size / FRI::m) {
+                                    for (std::size_t j = 0; j < prev_half_size; j++) {
+                                        s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
+                                        s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
+                                        element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
+                                        element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
+
+                                        i++;
+                                    }
+                                    base_index /= FRI::m;
+                                    prev_half_size <<= 1;
                                 }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
                             }
-                        }
-                    }
+                        });
 
                     return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
                                                                                                      y_data.end());
@@ -515,10 +522,11 @@ namespace nil {
                 ) {
                     std::size_t list_size = poly.size();
                     std::vector<math::polynomial_dfs<typename FRI::field_type::value_type>> poly_dfs(list_size);
-                    for (std::size_t i = 0; i < list_size; i++) {
+                    D->prepare_fft_cache();
+                    parallelization::parallel_for(0, list_size, [&poly, &poly_dfs, &D](std::size_t i) {
                         poly_dfs[i].from_coefficients(poly[i]);
                         poly_dfs[i].resize(D->size(), nullptr, D);
-                    }
+                    });
 
                     return precommit<FRI>(poly_dfs, D, fri_step);
                 }
@@ -627,39 +627,48 @@ namespace nil {
                         return res;
                     }
 
+                    // coefficients of b_poly(chals, X) multiplied by scale, s[i] = scale * prod of chals over bits of i
                     static std::vector<typename scalar_field_type::value_type>
-                    b_poly_coefficents(const std::vector<typename scalar_field_type::value_type> &chals) {
+                    b_poly_coefficents(const std::vector<typename scalar_field_type::value_type> &chals,
+                                       const typename scalar_field_type::value_type &scale =
+                                               scalar_field_type::value_type::one()) {
                         auto rounds = chals.size();
-                        auto s_len = 1 << rounds;
-                        std::vector<typename scalar_field_type::value_type> s(
-                                s_len, scalar_field_type::value_type::one());
-                        int k = 0;
-                        int pow = 1;
-                        for (int i = 1; i < s_len; ++i) {
-                            (i == pow) ? (k += 1) : (k += 0);
-                            (i == pow) ? (pow <<= 1) : (pow <<= 0);
-                            s[i] = s[i - (pow >> 1)] * chals[rounds - 1 - (k - 1)];
+                        std::vector<typename scalar_field_type::value_type> s(std::size_t(1) << rounds);
+                        s[0] = scale;
+                        // every round doubles the filled prefix, one multiplication per coefficient
+                        for (std::size_t k = 0; k < rounds; ++k) {
+                            std::size_t half = std::size_t(1) << k;
+                            for (std::size_t i = 0; i < half; ++i) {
+                                s[half + i] = s[i] * chals[rounds - 1 - k];
+                            }
                         }
                         return s;
                     }
 
+                    // Opening proofs checked up to sg == <s, G>, where s = b_poly_coefficents(chals). Only the
+                    // challenges and the claimed sg are kept, and all the deferred checks are settled by settle()
+                    // with a single multiexponentiation over G.
+                    struct accumulator_type {
+                        std::vector<std::vector<typename scalar_field_type::value_type>> chals;
+                        std::vector<typename group_type::value_type> sg;
+                    };
+
                     static bool verify_eval(params_type &params, group_map_type &group_map,
                                             std::vector<batchproof_type> &batches) {
+                        accumulator_type acc;
+                        return verify_eval(params, group_map, batches, acc) && settle(params, acc);
+                    }
 
-                        std::size_t power_of_two = 1;
-                        for (; power_of_two < params.g.size(); power_of_two <<= 1);
+                    // Checks batches but the sg == <s, G> part, which is added to acc instead
+                    static bool verify_eval(params_type &params, group_map_type &group_map,
+                                            std::vector<batchproof_type> &batches, accumulator_type &acc) {
 
                         std::vector<typename group_type::value_type> points = {params.h};
-                        points.insert(points.end(), params.g.begin(), params.g.end());
-                        points.resize(power_of_two + 1, group_type::value_type::zero());
-
-                        std::vector<typename scalar_field_type::value_type> scalars(power_of_two + 1,
-                                                                                    scalar_field_type::value_type::zero());
+                        std::vector<typename scalar_field_type::value_type> scalars = {
+                                scalar_field_type::value_type::zero()};
 
                         typename scalar_field_type::value_type rand_base = algebra::random_element<scalar_field_type>();
-                        typename scalar_field_type::value_type sg_rand_base = algebra::random_element<scalar_field_type>();
                         typename scalar_field_type::value_type rand_base_i = scalar_field_type::value_type::one();
-                        typename scalar_field_type::value_type sg_rand_base_i = scalar_field_type::value_type::one();
 
                         for (auto &batch: batches) {
                             std::vector<std::tuple<evaluation_type, int>> es;
@@ -693,20 +702,13 @@ namespace nil {
                                 scale *= batch.r;
                             }
 
-                            std::vector<typename scalar_field_type::value_type> s = b_poly_coefficents(chals);
+                            acc.chals.push_back(chals);
+                            acc.sg.push_back(batch.opening.sg);
 
                             auto neg_rand_base_i = -rand_base_i;
 
                             points.push_back(batch.opening.sg);
-                            scalars.push_back(neg_rand_base_i * batch.opening.z1 - sg_rand_base_i);
-
-                            std::transform(s.begin(), s.end(), s.begin(), [&sg_rand_base_i](auto &iter_s) {
-                                return iter_s * sg_rand_base_i;
-                            });
-
-                            for (int i = 0; i < s.size(); ++i) {
-                                scalars[i + 1] += s[i];
-                            }
+                            scalars.push_back(neg_rand_base_i * batch.opening.z1);
 
                             scalars[0] -= rand_base_i * batch.opening.z2;
                             scalars.push_back(neg_rand_base_i * batch.opening.z1 * b0);
@@ -747,13 +749,55 @@ namespace nil {
                             points.push_back(batch.opening.delta);
 
                             rand_base_i *= rand_base;
-                            sg_rand_base_i *= sg_rand_base;
                         }
 
                         return (algebra::multiexp_with_mixed_addition<multiexp_method>(
                                 points.begin(), points.end(), scalars.begin(), scalars.end(), 1) ==
                                 group_type::value_type::zero());
                     }
+
+                    // Checks sum_j r^j * sg_j == <sum_j r^j * s_j, G> for all deferred proofs and clears acc
+                    static bool settle(const params_type &params, accumulator_type &acc) {
+                        std::size_t power_of_two = 1;
+                        for (; power_of_two < params.g.size(); power_of_two <<= 1);
+
+                        std::vector<typename group_type::value_type> points(params.g.begin(), params.g.end());
+                        points.resize(power_of_two, group_type::value_type::zero());
+
+                        std::vector<typename scalar_field_type::value_type> scalars(power_of_two,
+                                                                                    scalar_field_type::value_type::zero());
+
+                        typename scalar_field_type::value_type rand_base = algebra::random_element<scalar_field_type>();
+                        typename scalar_field_type::value_type rand_base_i = scalar_field_type::value_type::one();
+
+                        bool is_valid = true;
+                        for (std::size_t j = 0; j < acc.sg.size(); ++j) {
+                            if ((std::size_t(1) << acc.chals[j].size()) != power_of_two) {
+                                is_valid = false;
+                                break;
+                            }
+
+                            std::vector<typename scalar_field_type::value_type> s =
+                                    b_poly_coefficents(acc.chals[j], rand_base_i);
+                            for (std::size_t i = 0; i < power_of_two; ++i) {
+                                scalars[i] += s[i];
+                            }
+
+                            points.push_back(acc.sg[j]);
+                            scalars.push_back(-rand_base_i);
+
+                            rand_base_i *= rand_base;
+                        }
+
+                        bool is_empty = acc.sg.empty();
+                        acc.chals.clear();
+                        acc.sg.clear();
+
+                        return is_valid &&
+                               (is_empty || algebra::multiexp_with_mixed_addition<multiexp_method>(
+                                                    points.begin(), points.end(), scalars.begin(), scalars.end(), 1) ==
+                                                    group_type::value_type::zero());
+                    }
                 };
             }    // namespace commitments
         }        // namespace zk
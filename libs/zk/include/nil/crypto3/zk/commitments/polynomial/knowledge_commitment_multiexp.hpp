@@ -36,6 +36,7 @@
 */
 
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/parallelization/parallel_for.hpp>
 
 #include <nil/crypto3/zk/commitments/polynomial/knowledge_commitment.hpp>
 
@@ -181,17 +182,14 @@ namespace nil {
 
                     chunk_pos[num_chunks] = v.size();
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                    for (std::size_t i = 0; i < num_chunks; ++i) {
+                    parallelization::parallel_for(0, num_chunks, [&](std::size_t i) {
                         tmp[i] = kc_batch_exp_internal<T1, T2, FieldType>(
                             scalar_size, T1_window, T2_window, T1_table, T2_table, T1_coeff, T2_coeff, v, chunk_pos[i],
                             chunk_pos[i + 1], i == num_chunks - 1 ? last_chunk : chunk_size);
 #ifdef USE_MIXED_ADDITION
                         algebra::batch_to_special<typename commitments<T1, T2>::value_type>(tmp[i].values);
 #endif
-                    }
+                    });
 
                     if (num_chunks == 1) {
                         tmp[0].domain_size_ = v.size();
@@ -40,6 +40,7 @@
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
+#include <nil/crypto3/math/polynomial/subproduct_tree.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
@@ -192,34 +193,65 @@ namespace nil {
                     return proof_eval<CommitmentSchemeType>(params, f, pk.z);
                 }
 
+                namespace detail {
+                    /** @brief Line coefficients of the G2 generator, computed on first use and shared by all calls.
+                     */
+                    template<typename CurveType>
+                    const typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type &
+                        kzg_g2_one_precomputed() {
+                        static const typename algebra::pairing::pairing_policy<CurveType>::g2_precomputed_type
+                            g2_one_precomputed = algebra::precompute_g2<CurveType>(
+                                CurveType::template g2_type<>::value_type::one());
+                        return g2_one_precomputed;
+                    }
+                }    // namespace detail
+
+                /** @brief Checks an opening against a verification key precomputed by precompute_g2.
+                 *
+                 * The check e(proof, [alpha]_2 - z * [1]_2) * e(eval * [1]_1 - commit, [1]_2) = 1 is
+                 * evaluated as e(proof, [alpha]_2) * e(eval * [1]_1 - commit - z * proof, [1]_2) = 1, so both
+                 * G2 arguments are fixed: the key is precomputed once by the caller and the generator
+                 * once per process. Only the two G1 points are prepared per opening.
+                 */
                 template<typename CommitmentSchemeType,
                         typename std::enable_if<
                                 std::is_base_of<
                                         commitments::kzg<typename CommitmentSchemeType::curve_type>, CommitmentSchemeType>::value,
                                 bool>::type = true>
-                static bool verify_eval(const typename CommitmentSchemeType::params_type &params,
+                static bool verify_eval(const typename algebra::pairing::pairing_policy<
+                                                typename CommitmentSchemeType::curve_type>::g2_precomputed_type
+                                                &verification_key_precomputed,
                                         const typename CommitmentSchemeType::proof_type &proof,
                                         const typename CommitmentSchemeType::public_key_type &public_key) {
+                    using curve_type = typename CommitmentSchemeType::curve_type;
+
+                    auto A_1 = algebra::precompute_g1<curve_type>(proof);
+                    auto B_1 = algebra::precompute_g1<curve_type>(
+                            public_key.eval * curve_type::template g1_type<>::value_type::one() -
+                            public_key.commit - public_key.z * proof);
 
-                    auto A_1 = algebra::precompute_g1<typename CommitmentSchemeType::curve_type>(proof);
-                    auto A_2 = algebra::precompute_g2<typename CommitmentSchemeType::curve_type>(
-                            params.verification_key -
-                            public_key.z *
-                            CommitmentSchemeType::curve_type::template g2_type<>::value_type::one());
-                    auto B_1 = algebra::precompute_g1<typename CommitmentSchemeType::curve_type>(
-                            public_key.eval * CommitmentSchemeType::curve_type::template g1_type<>::value_type::one() -
-                            public_key.commit);
-                    auto B_2 = algebra::precompute_g2<typename CommitmentSchemeType::curve_type>(
-                            CommitmentSchemeType::curve_type::template g2_type<>::value_type::one());
-
-                    typename CommitmentSchemeType::gt_value_type gt3 = algebra::double_miller_loop<typename CommitmentSchemeType::curve_type>(
-                            A_1, A_2,
-                            B_1, B_2);
-                    typename CommitmentSchemeType::gt_value_type gt_4 = algebra::final_exponentiation<typename CommitmentSchemeType::curve_type>(
+                    typename CommitmentSchemeType::gt_value_type gt3 = algebra::double_miller_loop<curve_type>(
+                            A_1, verification_key_precomputed,
+                            B_1, detail::kzg_g2_one_precomputed<curve_type>());
+                    typename CommitmentSchemeType::gt_value_type gt_4 = algebra::final_exponentiation<curve_type>(
                             gt3);
 
                     return gt_4 == CommitmentSchemeType::gt_value_type::one();
                 }
+
+                template<typename CommitmentSchemeType,
+                        typename std::enable_if<
+                                std::is_base_of<
+                                        commitments::kzg<typename CommitmentSchemeType::curve_type>, CommitmentSchemeType>::value,
+                                bool>::type = true>
+                static bool verify_eval(const typename CommitmentSchemeType::params_type &params,
+                                        const typename CommitmentSchemeType::proof_type &proof,
+                                        const typename CommitmentSchemeType::public_key_type &public_key) {
+
+                    return verify_eval<CommitmentSchemeType>(
+                            algebra::precompute_g2<typename CommitmentSchemeType::curve_type>(params.verification_key),
+                            proof, public_key);
+                }
             } // namespace algorithms
 
             namespace commitments {
@@ -381,11 +413,11 @@ namespace nil {
                     BOOST_ASSERT(polys.size() == S.size());
                     std::vector<typename CommitmentSchemeType::polynomial_type> rs(polys.size());
                     for (std::size_t i = 0; i < polys.size(); ++i) {
-                        typename std::vector<std::pair<typename CommitmentSchemeType::scalar_value_type, typename CommitmentSchemeType::scalar_value_type>> evals;
+                        std::vector<typename CommitmentSchemeType::scalar_value_type> evals;
                         for (auto s: S[i]) {
-                            evals.push_back(std::make_pair(s, polys[i].evaluate(s)));
+                            evals.push_back(polys[i].evaluate(s));
                         }
-                        rs[i] = math::lagrange_interpolation(evals);
+                        rs[i] = math::fast_interpolation(S[i], evals);
                     }
                     return rs;
                 }
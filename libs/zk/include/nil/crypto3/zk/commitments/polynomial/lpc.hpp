@@ -105,6 +105,17 @@ namespace nil {
                         return _trees[index].root();
                     }
 
+                    // Same as commit(index), with the tree built by an earlier commit of the same polynomials.
+                    commitment_type commit(std::size_t index, precommitment_type precommitment) {
+                        this->state_commited(index);
+                        _trees[index] = std::move(precommitment);
+                        return _trees[index].root();
+                    }
+
+                    const precommitment_type &get_precommitment(std::size_t index) const {
+                        return _trees.at(index);
+                    }
+
                     // Should be done after commitment.
                     void mark_batch_as_fixed(std::size_t index) {
                         _batch_fixed[index] = true;
@@ -50,10 +50,10 @@ namespace nil {
                 };
 
                 // Specialization for polynomial DFS with caching
-                template<typename FieldValueType>
-                class multiplier<typename nil::crypto3::math::polynomial_dfs<FieldValueType>> {
+                template<typename FieldValueType, typename Allocator>
+                class multiplier<typename nil::crypto3::math::polynomial_dfs<FieldValueType, Allocator>> {
                 public:
-                    using ValueType = typename nil::crypto3::math::polynomial_dfs<FieldValueType>;
+                    using ValueType = typename nil::crypto3::math::polynomial_dfs<FieldValueType, Allocator>;
                     using FieldType = typename FieldValueType::field_type;
                     using DomainType = typename nil::crypto3::math::evaluation_domain<FieldType>;
 
@@ -0,0 +1,322 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of interfaces for a R1CS constraint system frozen in
+// compressed sparse row (CSR) form.
+//
+// Every matrix keeps its non-zero entries in three flat arrays: row offsets,
+// column indices and coefficients. Rows are independent, so sparse matrix by
+// vector products are split over rows without synchronization.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_R1CS_CSR_CONSTRAINT_SYSTEM_HPP
+#define CRYPTO3_ZK_R1CS_CSR_CONSTRAINT_SYSTEM_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /************************* R1CS sparse matrix ********************************/
+                /**
+                 * A sparse matrix over <FieldType> in compressed sparse row form.
+                 *
+                 * The entries of row i are columns[k], values[k] for k in
+                 * [row_offsets[i], row_offsets[i + 1]); row_offsets has num_rows() + 1 elements.
+                 * Columns are sorted within a row and never repeat.
+                 */
+                template<typename FieldType>
+                struct r1cs_sparse_matrix {
+                    typedef FieldType field_type;
+                    typedef typename FieldType::value_type field_value_type;
+
+                    std::size_t num_columns;
+                    std::vector<std::size_t> row_offsets;
+                    std::vector<std::size_t> columns;
+                    std::vector<field_value_type> values;
+
+                    r1cs_sparse_matrix() : num_columns(0), row_offsets(1, 0) {
+                    }
+
+                    r1cs_sparse_matrix(std::size_t num_columns,
+                                       std::vector<std::size_t> &&row_offsets,
+                                       std::vector<std::size_t> &&columns,
+                                       std::vector<field_value_type> &&values) :
+                        num_columns(num_columns),
+                        row_offsets(std::move(row_offsets)), columns(std::move(columns)), values(std::move(values)) {
+                        assert(!this->row_offsets.empty());
+                        assert(this->columns.size() == this->values.size());
+                        assert(this->row_offsets.back() == this->columns.size());
+                    }
+
+                    std::size_t num_rows() const {
+                        return row_offsets.size() - 1;
+                    }
+
+                    std::size_t num_nonzeros() const {
+                        return columns.size();
+                    }
+
+                    /**
+                     * Inner product of the row-th row with x.
+                     */
+                    field_value_type row_product(std::size_t row, const std::vector<field_value_type> &x) const {
+                        field_value_type acc = field_value_type::zero();
+                        for (std::size_t k = row_offsets[row]; k < row_offsets[row + 1]; ++k) {
+                            acc += values[k] * x[columns[k]];
+                        }
+                        return acc;
+                    }
+
+                    /**
+                     * Overwrites the first num_rows() elements of result with M * x.
+                     * Elements of result past num_rows() are left as is, so result may be a
+                     * longer, zero-padded evaluation vector.
+                     */
+                    void multiply(const std::vector<field_value_type> &x, std::vector<field_value_type> &result) const {
+                        assert(x.size() >= num_columns);
+                        assert(result.size() >= num_rows());
+
+                        parallelization::parallel_for(0, num_rows(), [&](std::size_t i) {
+                            result[i] = row_product(i, x);
+                        });
+                    }
+
+                    /**
+                     * The transposed matrix, built with a counting sort over the columns.
+                     * Rows of the result come out sorted since the rows of this are scanned in order.
+                     */
+                    r1cs_sparse_matrix transposed() const {
+                        std::vector<std::size_t> t_row_offsets(num_columns + 1, 0);
+                        for (std::size_t k = 0; k < columns.size(); ++k) {
+                            ++t_row_offsets[columns[k] + 1];
+                        }
+                        for (std::size_t j = 0; j < num_columns; ++j) {
+                            t_row_offsets[j + 1] += t_row_offsets[j];
+                        }
+
+                        std::vector<std::size_t> t_columns(columns.size());
+                        std::vector<field_value_type> t_values(values.size());
+                        std::vector<std::size_t> next(t_row_offsets.begin(), t_row_offsets.end() - 1);
+                        for (std::size_t i = 0; i < num_rows(); ++i) {
+                            for (std::size_t k = row_offsets[i]; k < row_offsets[i + 1]; ++k) {
+                                const std::size_t pos = next[columns[k]]++;
+                                t_columns[pos] = i;
+                                t_values[pos] = values[k];
+                            }
+                        }
+
+                        return r1cs_sparse_matrix(num_rows(), std::move(t_row_offsets), std::move(t_columns),
+                                                  std::move(t_values));
+                    }
+
+                    bool operator==(const r1cs_sparse_matrix<FieldType> &other) const {
+                        return (this->num_columns == other.num_columns && this->row_offsets == other.row_offsets &&
+                                this->columns == other.columns && this->values == other.values);
+                    }
+                };
+
+                /************************* R1CS CSR constraint system ************************/
+                /**
+                 * A R1CS constraint system with the matrices A, B, C frozen in CSR form.
+                 *
+                 * Row k of each matrix is the linear combination of the k-th constraint and column j is
+                 * the variable x_j, so column 0 is the constant 1 and there are num_variables() + 1 columns.
+                 * It is built once from a r1cs_constraint_system, after which the linear combinations
+                 * are no longer needed: constraint evaluation becomes three sparse matrix by vector
+                 * products over contiguous arrays instead of a walk over per-constraint term vectors.
+                 */
+                template<typename FieldType>
+                struct r1cs_csr_constraint_system {
+                    typedef FieldType field_type;
+                    typedef typename FieldType::value_type field_value_type;
+                    typedef r1cs_sparse_matrix<FieldType> matrix_type;
+
+                    std::size_t primary_input_size;
+                    std::size_t auxiliary_input_size;
+
+                    matrix_type A, B, C;
+
+                    r1cs_csr_constraint_system() : primary_input_size(0), auxiliary_input_size(0) {
+                    }
+
+                    r1cs_csr_constraint_system(std::size_t primary_input_size,
+                                               std::size_t auxiliary_input_size,
+                                               matrix_type &&A,
+                                               matrix_type &&B,
+                                               matrix_type &&C) :
+                        primary_input_size(primary_input_size),
+                        auxiliary_input_size(auxiliary_input_size), A(std::move(A)), B(std::move(B)),
+                        C(std::move(C)) {
+                    }
+
+                    explicit r1cs_csr_constraint_system(const r1cs_constraint_system<FieldType> &cs) :
+                        primary_input_size(cs.primary_input_size), auxiliary_input_size(cs.auxiliary_input_size),
+                        A(freeze(cs, &r1cs_constraint<FieldType>::a)), B(freeze(cs, &r1cs_constraint<FieldType>::b)),
+                        C(freeze(cs, &r1cs_constraint<FieldType>::c)) {
+                    }
+
+                    std::size_t num_inputs() const {
+                        return primary_input_size;
+                    }
+
+                    std::size_t num_variables() const {
+                        return primary_input_size + auxiliary_input_size;
+                    }
+
+                    std::size_t num_constraints() const {
+                        return A.num_rows();
+                    }
+
+                    /**
+                     * The assignment (1, x_1, ..., x_m) the matrices are multiplied with.
+                     */
+                    static std::vector<field_value_type>
+                        extended_assignment(const r1cs_variable_assignment<FieldType> &full_variable_assignment) {
+                        std::vector<field_value_type> x;
+                        x.reserve(full_variable_assignment.size() + 1);
+                        x.emplace_back(field_value_type::one());
+                        x.insert(x.end(), full_variable_assignment.begin(), full_variable_assignment.end());
+                        return x;
+                    }
+
+                    /**
+                     * Evaluates < A_k , X >, < B_k , X >, < C_k , X > of every constraint. The first
+                     * num_constraints() elements of a, b, c are overwritten, see r1cs_sparse_matrix::multiply.
+                     */
+                    void evaluate(const r1cs_variable_assignment<FieldType> &full_variable_assignment,
+                                  std::vector<field_value_type> &a,
+                                  std::vector<field_value_type> &b,
+                                  std::vector<field_value_type> &c) const {
+                        assert(full_variable_assignment.size() == num_variables());
+
+                        const std::vector<field_value_type> x = extended_assignment(full_variable_assignment);
+                        A.multiply(x, a);
+                        B.multiply(x, b);
+                        C.multiply(x, c);
+                    }
+
+                    bool is_satisfied(const r1cs_primary_input<FieldType> &primary_input,
+                                      const r1cs_auxiliary_input<FieldType> &auxiliary_input) const {
+                        assert(primary_input.size() == num_inputs());
+                        assert(primary_input.size() + auxiliary_input.size() == num_variables());
+
+                        std::vector<field_value_type> x;
+                        x.reserve(num_variables() + 1);
+                        x.emplace_back(field_value_type::one());
+                        x.insert(x.end(), primary_input.begin(), primary_input.end());
+                        x.insert(x.end(), auxiliary_input.begin(), auxiliary_input.end());
+
+                        // 1 for a chunk with an unsatisfied constraint. Not a bool, since the partial results are
+                        // written concurrently into a std::vector.
+                        const std::size_t unsatisfied_chunks = parallelization::parallel_reduce(
+                            std::size_t(0), num_constraints(), std::size_t(0),
+                            [&](std::size_t begin, std::size_t end) -> std::size_t {
+                                for (std::size_t k = begin; k < end; ++k) {
+                                    if (A.row_product(k, x) * B.row_product(k, x) != C.row_product(k, x)) {
+                                        return 1;
+                                    }
+                                }
+                                return 0;
+                            },
+                            [](std::size_t a, std::size_t b) { return a + b; });
+                        return unsatisfied_chunks == 0;
+                    }
+
+                    bool operator==(const r1cs_csr_constraint_system<FieldType> &other) const {
+                        return (this->A == other.A && this->B == other.B && this->C == other.C &&
+                                this->primary_input_size == other.primary_input_size &&
+                                this->auxiliary_input_size == other.auxiliary_input_size);
+                    }
+
+                private:
+                    typedef math::linear_combination<math::linear_variable<FieldType>> linear_combination_type;
+
+                    /**
+                     * Collects one of the A, B, C sides of every constraint into a matrix. Terms of a row
+                     * are sorted by variable and repeated variables are merged, as they are when the
+                     * constraints are reduced to a QAP.
+                     */
+                    static matrix_type freeze(const r1cs_constraint_system<FieldType> &cs,
+                                              linear_combination_type r1cs_constraint<FieldType>::*side) {
+                        std::size_t num_terms = 0;
+                        for (std::size_t i = 0; i < cs.constraints.size(); ++i) {
+                            num_terms += (cs.constraints[i].*side).terms.size();
+                        }
+
+                        std::vector<std::size_t> row_offsets;
+                        std::vector<std::size_t> columns;
+                        std::vector<field_value_type> values;
+                        row_offsets.reserve(cs.constraints.size() + 1);
+                        columns.reserve(num_terms);
+                        values.reserve(num_terms);
+
+                        std::vector<std::pair<std::size_t, field_value_type>> row;
+                        row_offsets.emplace_back(0);
+                        for (std::size_t i = 0; i < cs.constraints.size(); ++i) {
+                            const linear_combination_type &lc = cs.constraints[i].*side;
+
+                            row.clear();
+                            for (std::size_t j = 0; j < lc.terms.size(); ++j) {
+                                row.emplace_back(lc.terms[j].index, lc.terms[j].coeff);
+                            }
+                            std::stable_sort(row.begin(), row.end(),
+                                             [](const std::pair<std::size_t, field_value_type> &l,
+                                                const std::pair<std::size_t, field_value_type> &r) {
+                                                 return l.first < r.first;
+                                             });
+
+                            for (std::size_t j = 0; j < row.size(); ++j) {
+                                if (j > 0 && row[j].first == row[j - 1].first) {
+                                    values.back() += row[j].second;
+                                } else {
+                                    columns.emplace_back(row[j].first);
+                                    values.emplace_back(row[j].second);
+                                }
+                            }
+                            row_offsets.emplace_back(columns.size());
+                        }
+
+                        columns.shrink_to_fit();
+                        values.shrink_to_fit();
+
+                        return matrix_type(cs.num_variables() + 1, std::move(row_offsets), std::move(columns),
+                                           std::move(values));
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_R1CS_CSR_CONSTRAINT_SYSTEM_HPP
@@ -51,8 +51,11 @@
 #include <nil/crypto3/math/coset.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
 #include <nil/crypto3/zk/snark/arithmetization/arithmetic_programs/qap.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs_csr.hpp>
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 
@@ -76,44 +79,62 @@ namespace nil {
                          *   m = number of variables of the QAP
                          * and
                          *   each A_i,B_i,C_i is expressed in the Lagrange basis.
+                         *
+                         * Builds a CSR copy of cs on every call; callers that map the same system more than once
+                         * should build r1cs_csr_constraint_system once and use the overload below.
                          */
                         static qap_instance<FieldType> instance_map(const r1cs_constraint_system<FieldType> &cs) {
+                            return instance_map(r1cs_csr_constraint_system<FieldType>(cs));
+                        }
+
+                        /**
+                         * The columns of the transposed matrices are the Lagrange basis coordinates of
+                         * A_i, B_i, C_i, already sorted, so every map is filled with hinted insertions at its end
+                         * and the variables are processed independently.
+                         */
+                        static qap_instance<FieldType> instance_map(const r1cs_csr_constraint_system<FieldType> &cs) {
+                            typedef typename FieldType::value_type field_value_type;
 
                             const std::shared_ptr<math::evaluation_domain<FieldType>> domain =
                                 math::make_evaluation_domain<FieldType>(cs.num_constraints() + cs.num_inputs() + 1);
 
-                            std::vector<std::map<std::size_t, typename FieldType::value_type>> A_in_Lagrange_basis(
+                            std::vector<std::map<std::size_t, field_value_type>> A_in_Lagrange_basis(
                                 cs.num_variables() + 1);
-                            std::vector<std::map<std::size_t, typename FieldType::value_type>> B_in_Lagrange_basis(
+                            std::vector<std::map<std::size_t, field_value_type>> B_in_Lagrange_basis(
                                 cs.num_variables() + 1);
-                            std::vector<std::map<std::size_t, typename FieldType::value_type>> C_in_Lagrange_basis(
+                            std::vector<std::map<std::size_t, field_value_type>> C_in_Lagrange_basis(
                                 cs.num_variables() + 1);
 
-                            /**
-                             * add and process the constraints
-                             *     input_i * 0 = 0
-                             * to ensure soundness of input consistency
-                             */
-                            for (std::size_t i = 0; i <= cs.num_inputs(); ++i) {
-                                A_in_Lagrange_basis[i][cs.num_constraints() + i] = FieldType::value_type::one();
-                            }
-                            /* process all other constraints */
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
-                                for (std::size_t j = 0; j < cs.constraints[i].a.terms.size(); ++j) {
-                                    A_in_Lagrange_basis[cs.constraints[i].a.terms[j].index][i] +=
-                                        cs.constraints[i].a.terms[j].coeff;
+                            const r1cs_sparse_matrix<FieldType> At = cs.A.transposed();
+                            const r1cs_sparse_matrix<FieldType> Bt = cs.B.transposed();
+                            const r1cs_sparse_matrix<FieldType> Ct = cs.C.transposed();
+
+                            parallelization::parallel_for(0, cs.num_variables() + 1, [&](std::size_t i) {
+                                for (std::size_t k = At.row_offsets[i]; k < At.row_offsets[i + 1]; ++k) {
+                                    A_in_Lagrange_basis[i].emplace_hint(A_in_Lagrange_basis[i].end(), At.columns[k],
+                                                                        At.values[k]);
+                                }
+                                /**
+                                 * add and process the constraints
+                                 *     input_i * 0 = 0
+                                 * to ensure soundness of input consistency
+                                 */
+                                if (i <= cs.num_inputs()) {
+                                    A_in_Lagrange_basis[i].emplace_hint(A_in_Lagrange_basis[i].end(),
+                                                                        cs.num_constraints() + i,
+                                                                        field_value_type::one());
                                 }
 
-                                for (std::size_t j = 0; j < cs.constraints[i].b.terms.size(); ++j) {
-                                    B_in_Lagrange_basis[cs.constraints[i].b.terms[j].index][i] +=
-                                        cs.constraints[i].b.terms[j].coeff;
+                                for (std::size_t k = Bt.row_offsets[i]; k < Bt.row_offsets[i + 1]; ++k) {
+                                    B_in_Lagrange_basis[i].emplace_hint(B_in_Lagrange_basis[i].end(), Bt.columns[k],
+                                                                        Bt.values[k]);
                                 }
 
-                                for (std::size_t j = 0; j < cs.constraints[i].c.terms.size(); ++j) {
-                                    C_in_Lagrange_basis[cs.constraints[i].c.terms[j].index][i] +=
-                                        cs.constraints[i].c.terms[j].coeff;
+                                for (std::size_t k = Ct.row_offsets[i]; k < Ct.row_offsets[i + 1]; ++k) {
+                                    C_in_Lagrange_basis[i].emplace_hint(C_in_Lagrange_basis[i].end(), Ct.columns[k],
+                                                                        Ct.values[k]);
                                 }
-                            }
+                            });
 
                             return qap_instance<FieldType>(
                                 domain, cs.num_variables(), domain->m, cs.num_inputs(), std::move(A_in_Lagrange_basis),
@@ -134,11 +155,23 @@ namespace nil {
                          * where
                          *   m = number of variables of the QAP
                          *   n = degree of the QAP
+                         *
+                         * Builds a CSR copy of cs on every call, see instance_map.
                          */
                         static qap_instance_evaluation<FieldType>
                             instance_map_with_evaluation(const r1cs_constraint_system<FieldType> &cs,
                                                          const typename FieldType::value_type &t) {
-                            const std::shared_ptr<math::evaluation_domain<FieldType>> domain = 
+                            return instance_map_with_evaluation(r1cs_csr_constraint_system<FieldType>(cs), t);
+                        }
+
+                        /**
+                         * At, Bt, Ct are the products of the transposed matrices with the vector of Lagrange
+                         * polynomials evaluated at t.
+                         */
+                        static qap_instance_evaluation<FieldType>
+                            instance_map_with_evaluation(const r1cs_csr_constraint_system<FieldType> &cs,
+                                                         const typename FieldType::value_type &t) {
+                            const std::shared_ptr<math::evaluation_domain<FieldType>> domain =
                                 math::make_evaluation_domain<FieldType>(cs.num_constraints() + cs.num_inputs() + 1);
 
                             std::vector<typename FieldType::value_type> At, Bt, Ct, Ht;
@@ -152,27 +185,18 @@ namespace nil {
 
                             const std::vector<typename FieldType::value_type> u =
                                 domain->evaluate_all_lagrange_polynomials(t);
+
+                            cs.A.transposed().multiply(u, At);
+                            cs.B.transposed().multiply(u, Bt);
+                            cs.C.transposed().multiply(u, Ct);
+
                             /**
                              * add and process the constraints
                              *     input_i * 0 = 0
                              * to ensure soundness of input consistency
                              */
                             for (std::size_t i = 0; i <= cs.num_inputs(); ++i) {
-                                At[i] = u[cs.num_constraints() + i];
-                            }
-                            /* process all other constraints */
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
-                                for (std::size_t j = 0; j < cs.constraints[i].a.terms.size(); ++j) {
-                                    At[cs.constraints[i].a.terms[j].index] += u[i] * cs.constraints[i].a.terms[j].coeff;
-                                }
-
-                                for (std::size_t j = 0; j < cs.constraints[i].b.terms.size(); ++j) {
-                                    Bt[cs.constraints[i].b.terms[j].index] += u[i] * cs.constraints[i].b.terms[j].coeff;
-                                }
-
-                                for (std::size_t j = 0; j < cs.constraints[i].c.terms.size(); ++j) {
-                                    Ct[cs.constraints[i].c.terms[j].index] += u[i] * cs.constraints[i].c.terms[j].coeff;
-                                }
+                                At[i] += u[cs.num_constraints() + i];
                             }
 
                             typename FieldType::value_type ti = FieldType::value_type::one();
@@ -214,7 +238,13 @@ namespace nil {
                          * d3) + d1*d2*Z )
                          *
                          * The code below is not as simple as the above high-level description due to
-                         * some reshuffling to save space.
+                         * some reshuffling to save space: step (1) is a product of the CSR matrices with
+                         * the assignment, steps (2)-(3) run concurrently for A, B and C,
+                         * and the coefficients of H and of A d2 + B d1 are interpolated together from T,
+                         * so at most three domain-sized vectors are alive at once.
+                         *
+                         * This overload builds a CSR copy of cs on every call; the prover passes the one kept
+                         * in the proving key instead.
                          */
                         static qap_witness<FieldType>
                             witness_map(const r1cs_constraint_system<FieldType> &cs,
@@ -223,102 +253,89 @@ namespace nil {
                                         const typename FieldType::value_type &d1,
                                         const typename FieldType::value_type &d2,
                                         const typename FieldType::value_type &d3) {
+                            return witness_map(r1cs_csr_constraint_system<FieldType>(cs), primary_input,
+                                               auxiliary_input, d1, d2, d3);
+                        }
+
+                        static qap_witness<FieldType>
+                            witness_map(const r1cs_csr_constraint_system<FieldType> &cs,
+                                        const r1cs_primary_input<FieldType> &primary_input,
+                                        const r1cs_auxiliary_input<FieldType> &auxiliary_input,
+                                        const typename FieldType::value_type &d1,
+                                        const typename FieldType::value_type &d2,
+                                        const typename FieldType::value_type &d3) {
                             /* sanity check */
                             assert(cs.is_satisfied(primary_input, auxiliary_input));
 
+                            typedef typename FieldType::value_type field_value_type;
+
+                            const std::size_t domain_size = cs.num_constraints() + cs.num_inputs() + 1;
                             const std::shared_ptr<math::evaluation_domain<FieldType>> domain =
-                                math::make_evaluation_domain<FieldType>(cs.num_constraints() + cs.num_inputs() + 1);
+                                math::make_evaluation_domain<FieldType>(domain_size);
+                            // Domains build their twiddle caches lazily, build them before the concurrent transforms
+                            domain->prepare_fft_cache();
+
+                            const field_value_type coset_generator =
+                                field_value_type(fields::arithmetic_params<FieldType>::multiplicative_generator);
 
                             r1cs_variable_assignment<FieldType> full_variable_assignment = primary_input;
                             full_variable_assignment.insert(full_variable_assignment.end(), auxiliary_input.begin(),
                                                             auxiliary_input.end());
 
-                            std::vector<typename FieldType::value_type> aA(domain->m, FieldType::value_type::zero()),
-                                aB(domain->m, FieldType::value_type::zero());
+                            std::vector<field_value_type> aA, aB, aC;
+                            // aA ends up holding the coefficients of H, which have one more entry
+                            aA.reserve(domain->m + 1);
+                            aA.resize(domain->m, field_value_type::zero());
+                            aB.resize(domain->m, field_value_type::zero());
+                            aC.resize(domain->m, field_value_type::zero());
 
+                            /* evaluations of A, B, C on S */
+                            cs.evaluate(full_variable_assignment, aA, aB, aC);
                             /* account for the additional constraints input_i * 0 = 0 */
                             for (std::size_t i = 0; i <= cs.num_inputs(); ++i) {
                                 aA[i + cs.num_constraints()] =
-                                    (i > 0 ? full_variable_assignment[i - 1] : FieldType::value_type::one());
+                                    (i > 0 ? full_variable_assignment[i - 1] : field_value_type::one());
                             }
-                            /* account for all other constraints */
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
-                                aA[i] += cs.constraints[i].a.evaluate(full_variable_assignment);
-                                aB[i] += cs.constraints[i].b.evaluate(full_variable_assignment);
-                            }
-
-                            domain->inverse_fft(aA);
-
-                            domain->inverse_fft(aB);
-
-                            std::vector<typename FieldType::value_type> coefficients_for_H(
-                                domain->m + 1, FieldType::value_type::zero());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            /* add coefficients of the polynomial (d2*A + d1*B - d3) + d1*d2*Z */
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] = d2 * aA[i] + d1 * aB[i];
-                            }
-                            coefficients_for_H[0] -= d3;
-                            domain->add_poly_z(d1 * d2, coefficients_for_H);
 
-                            math::multiply_by_coset(
-                                aA,
-                                typename FieldType::value_type(
-                                    fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aA);
-
-                            math::multiply_by_coset(
-                                aB,
-                                typename FieldType::value_type(
-                                    fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aB);
-
-                            std::vector<typename FieldType::value_type> &H_tmp = aA;
-                            // can overwrite aA because it is not used later
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                H_tmp[i] = aA[i] * aB[i];
+                            /* coefficients of A, B, C and their evaluations on T,
+                             * the three transforms are independent and run concurrently */
+                            {
+                                parallelization::task_group transforms;
+                                transforms.run([&]() {
+                                    domain->inverse_fft(aA);
+                                    domain->coset_fft(aA, coset_generator);
+                                });
+                                transforms.run([&]() {
+                                    domain->inverse_fft(aB);
+                                    domain->coset_fft(aB, coset_generator);
+                                });
+                                domain->inverse_fft(aC);
+                                domain->coset_fft(aC, coset_generator);
+                                transforms.wait();
                             }
-                            std::vector<typename FieldType::value_type>().swap(aB);    // destroy aB
 
-                            std::vector<typename FieldType::value_type> aC(domain->m, FieldType::value_type::zero());
-                            for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
-                                aC[i] += cs.constraints[i].c.evaluate(full_variable_assignment);
-                            }
-
-                            domain->inverse_fft(aC);
+                            /* evaluation of H = (A * B - C) / Z on T; the polynomial d2 * A + d1 * B is added
+                             * on T as well, so that a single inverse transform yields the coefficients of both */
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
+                                aC[i] = aA[i] * aB[i] - aC[i];
+                                aA[i] = d2 * aA[i] + d1 * aB[i];
+                            });
+                            std::vector<field_value_type>().swap(aB);    // destroy aB
 
-                            math::multiply_by_coset(
-                                aC,
-                                typename FieldType::value_type(
-                                    fields::arithmetic_params<FieldType>::multiplicative_generator));
-                            domain->fft(aC);
-
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                H_tmp[i] = (H_tmp[i] - aC[i]);
-                            }
+                            domain->divide_by_z_on_coset(aC);
 
-                            domain->divide_by_z_on_coset(H_tmp);
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
+                                aA[i] += aC[i];
+                            });
+                            std::vector<field_value_type>().swap(aC);    // destroy aC
 
-                            domain->inverse_fft(H_tmp);
+                            domain->inverse_coset_fft(aA, coset_generator);
 
-                            multiply_by_coset(H_tmp,
-                                              typename FieldType::value_type(
-                                                  fields::arithmetic_params<FieldType>::multiplicative_generator)
-                                                  .inversed());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
-                                coefficients_for_H[i] += H_tmp[i];
-                            }
+                            /* add coefficients of the polynomial - d3 + d1*d2*Z */
+                            std::vector<field_value_type> &coefficients_for_H = aA;
+                            coefficients_for_H.resize(domain->m + 1, field_value_type::zero());
+                            coefficients_for_H[0] -= d3;
+                            domain->add_poly_z(d1 * d2, coefficients_for_H);
 
                             return qap_witness<FieldType>(cs.num_variables(), domain->m, cs.num_inputs(), d1, d2, d3,
                                                           full_variable_assignment, std::move(coefficients_for_H));
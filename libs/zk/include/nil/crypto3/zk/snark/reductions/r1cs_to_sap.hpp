@@ -53,6 +53,8 @@
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
 #include <nil/crypto3/zk/snark/arithmetization/arithmetic_programs/sap.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
 
@@ -386,13 +388,10 @@ namespace nil {
 
                             std::vector<typename FieldType::value_type> coefficients_for_H(
                                     domain->m + 1, FieldType::value_type::zero());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
                             /* add coefficients of the polynomial (2*d1*A - d2) + d1*d1*Z */
-                            for (std::size_t i = 0; i < domain->m; ++i) {
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
                                 coefficients_for_H[i] = (d1 * aA[i]) + (d1 * aA[i]);
-                            }
+                            });
                             coefficients_for_H[0] -= d2;
                             domain->add_poly_z(d1 * d1, coefficients_for_H);
 
@@ -404,12 +403,9 @@ namespace nil {
 
                             std::vector<typename FieldType::value_type> &H_tmp =
                                     aA;    // can overwrite aA because it is not used later
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
                                 H_tmp[i] = aA[i] * aA[i];
-                            }
+                            });
 
                             std::vector<typename FieldType::value_type> aC(domain->m, FieldType::value_type::zero());
                             /* again, accounting for all constraints */
@@ -440,12 +436,9 @@ namespace nil {
                                             algebra::fields::arithmetic_params<FieldType>::multiplicative_generator));
                             domain->fft(aC);
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
                                 H_tmp[i] = (H_tmp[i] - aC[i]);
-                            }
+                            });
 
                             domain->divide_by_z_on_coset(H_tmp);
 
@@ -455,12 +448,9 @@ namespace nil {
                                                       algebra::fields::arithmetic_params<FieldType>::multiplicative_generator)
                                                       .inversed());
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
                                 coefficients_for_H[i] += H_tmp[i];
-                            }
+                            });
 
                             return sap_witness<FieldType>(sap_num_variables,
                                                           domain->m,
@@ -52,6 +52,8 @@
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 
+#include <nil/crypto3/parallelization/parallel_for.hpp>
+
 #include <nil/crypto3/zk/snark/arithmetization/arithmetic_programs/ssp.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/uscs.hpp>
 
@@ -200,13 +202,10 @@ namespace nil {
 
                             std::vector<typename FieldType::value_type> coefficients_for_H(
                                 domain->m + 1, FieldType::value_type::zero());
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
                             /* add coefficients of the polynomial 2*d*V(z) + d*d*Z(z) */
-                            for (std::size_t i = 0; i < domain->m; ++i) {
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
                                 coefficients_for_H[i] = typename FieldType::value_type(2) * d * aA[i];
-                            }
+                            });
                             domain->add_poly_z(d.squared(), coefficients_for_H);
 
                             math::multiply_by_coset(
@@ -217,12 +216,9 @@ namespace nil {
 
                             std::vector<typename FieldType::value_type> &H_tmp =
                                 aA;    // can overwrite aA because it is not used later
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
                                 H_tmp[i] = aA[i].squared() - FieldType::value_type::one();
-                            }
+                            });
 
                             domain->divide_by_z_on_coset(H_tmp);
 
@@ -232,12 +228,9 @@ namespace nil {
                                                   fields::arithmetic_params<FieldType>::multiplicative_generator)
                                                   .inversed());
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-                            for (std::size_t i = 0; i < domain->m; ++i) {
+                            parallelization::parallel_for(0, domain->m, [&](std::size_t i) {
                                 coefficients_for_H[i] += H_tmp[i];
-                            }
+                            });
 
                             return ssp_witness<FieldType>(cs.num_variables(),
                                                           domain->m,
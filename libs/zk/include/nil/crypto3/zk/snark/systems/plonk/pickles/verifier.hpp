@@ -382,6 +382,21 @@ namespace nil {
                         return commitment_scheme::verify_eval(srs, g_map, batch);
                     }
 
+                    // Leaves the full-size sg == <s, G> checks in acc, so that the proofs of a long chain can be
+                    // settled at once with commitment_scheme::settle
+                    static bool batch_verify(group_map<CurveType> &g_map,
+                                             proofs_type &proofs,
+                                             typename commitment_scheme::accumulator_type &acc) {
+                        std::vector<batchproof_type> batch;
+
+                        typename commitment_scheme::params_type &srs = std::get<0>(proofs.front()).srs;
+                        for (auto &[index, proof]: proofs) {
+                            batch.push_back(to_batch(index, proof));
+                        }
+
+                        return commitment_scheme::verify_eval(srs, g_map, batch, acc);
+                    }
+
                     static bool verify(group_map<CurveType> &g_map,
                                        VerifierIndexType &index,
                                        proof_type<CurveType> &proof) {
@@ -26,16 +26,40 @@
 #define CRYPTO3_PLACEHOLDER_SCOPED_PROFILER_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <unordered_map>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
 namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace snark {
                 namespace detail {
 
+                    // Peak resident set size of the process in kilobytes, or 0 where it is not available.
+                    inline std::uint64_t placeholder_peak_memory_kb() {
+#if defined(__unix__) || defined(__APPLE__)
+                        struct rusage usage;
+                        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+                            return 0;
+                        }
+#if defined(__APPLE__)
+                        // ru_maxrss is in bytes on macOS and in kilobytes elsewhere.
+                        return static_cast<std::uint64_t>(usage.ru_maxrss) / 1024;
+#else
+                        return static_cast<std::uint64_t>(usage.ru_maxrss);
+#endif
+#else
+                        return 0;
+#endif
+                    }
+
                     // Measures execution time of a given function just once. Prints 
-                    // the time when leaving the function in which this class was created.
+                    // the time and the peak memory of the process so far when leaving the function in which
+                    // this class was created.
                     class placeholder_scoped_profiler
                     {
                         public:
@@ -48,7 +72,8 @@ namespace nil {
                                 auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                                                 std::chrono::high_resolution_clock::now() - start);
                                 std::cout << name << ": " << std::fixed << std::setprecision(3)
-                                    << elapsed.count() << " ms" << std::endl;
+                                    << elapsed.count() << " ms, peak memory "
+                                    << placeholder_peak_memory_kb() / 1024 << " MB" << std::endl;
                             }
                     
                         private:
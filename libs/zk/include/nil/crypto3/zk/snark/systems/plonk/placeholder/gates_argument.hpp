@@ -29,13 +29,16 @@
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_GATES_ARGUMENT_HPP
 
 #include <unordered_map>
+#include <unordered_set>
 #include <iostream>
+#include <iterator>
 #include <memory>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/memory/arena_allocator.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
@@ -66,8 +69,14 @@ namespace nil {
                     typedef typename ParamsType::transcript_hash_type transcript_hash_type;
                     using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
                     using polynomial_dfs_type = math::polynomial_dfs<typename FieldType::value_type>;
+                    // The expression evaluation creates and drops a lot of equally sized polynomials,
+                    // they are drawn from the current memory arena of the prover, if there is one.
+                    using arena_container_type = std::vector<typename FieldType::value_type,
+                                                             memory::arena_allocator<typename FieldType::value_type>>;
+                    using arena_polynomial_dfs_type = math::polynomial_dfs<
+                        typename FieldType::value_type, memory::arena_allocator<typename FieldType::value_type>>;
                     using variable_type = plonk_variable<typename FieldType::value_type>;
-                    using polynomial_dfs_variable_type = plonk_variable<polynomial_dfs_type>;
+                    using polynomial_dfs_variable_type = plonk_variable<arena_polynomial_dfs_type>;
 
                     typedef detail::placeholder_policy<FieldType, ParamsType> policy_type;
 
@@ -78,7 +87,7 @@ namespace nil {
                         const plonk_polynomial_dfs_table<FieldType> &assignments,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
                         std::size_t extended_domain_size,
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type>& variable_values_out) {
+                        std::unordered_map<polynomial_dfs_variable_type, arena_polynomial_dfs_type>& variable_values_out) {
 
                         std::unordered_map<polynomial_dfs_variable_type, size_t> variable_counts;
 
@@ -93,19 +102,19 @@ namespace nil {
                             // We may have variable values in required sizes in some cases.
                             if (variable_values_out.find(var) != variable_values_out.end())
                                 continue;
-                            polynomial_dfs_type assignment;
+                            const polynomial_dfs_type *column = nullptr;
                             switch (var.type) {
                                 case polynomial_dfs_variable_type::column_type::witness:
-                                    assignment = assignments.witness(var.index);
+                                    column = &assignments.witness(var.index);
                                     break;
                                 case polynomial_dfs_variable_type::column_type::public_input:
-                                    assignment = assignments.public_input(var.index);
+                                    column = &assignments.public_input(var.index);
                                     break;
                                 case polynomial_dfs_variable_type::column_type::constant:
-                                    assignment = assignments.constant(var.index);
+                                    column = &assignments.constant(var.index);
                                     break;
                                 case polynomial_dfs_variable_type::column_type::selector:
-                                    assignment = assignments.selector(var.index);
+                                    column = &assignments.selector(var.index);
                                     break;
                                 default:
                                     std::cerr << "Invalid column type";
@@ -113,16 +122,27 @@ namespace nil {
                                     break;
                             }
 
-                            if (var.rotation != 0) {
-                                assignment = math::polynomial_shift(assignment, var.rotation, domain->m);
-                            }
+                            // The (rotated) column is written straight into arena storage which already has room
+                            // for the extended domain, so the resize below transforms it in place.
+                            const std::size_t column_size = column->size();
+                            arena_container_type values;
+                            values.reserve(count > 1 ? std::max(column_size, extended_domain_size) : column_size);
+                            math::polynomial_shift(*column, var.rotation, domain->m, std::back_inserter(values));
+
+                            arena_polynomial_dfs_type assignment(column->degree(), std::move(values));
                             if (count > 1) {
                                 assignment.resize(extended_domain_size, domain, extended_domain);
                             }
-                            variable_values_out[var] = assignment;
+                            variable_values_out[var] = std::move(assignment);
                         }
                     }
 
+                    /**
+                     * @param memory_budget bound in bytes for the extended-domain column copies which are alive at
+                     * once. Gates are evaluated in batches whose columns fit into it, a column used by several
+                     * batches is extended again for each of them. A single gate may still exceed the budget.
+                     * 0 evaluates all gates at once.
+                     */
                     static inline std::array<polynomial_dfs_type, argument_size>
                         prove_eval(
                             const typename policy_type::constraint_system_type &constraint_system,
@@ -131,7 +151,8 @@ namespace nil {
                             std::shared_ptr<math::evaluation_domain<FieldType>> original_domain,
                             std::uint32_t max_gates_degree,
                             const polynomial_dfs_type &mask_polynomial,
-                            transcript_type& transcript) {
+                            transcript_type& transcript,
+                            std::size_t memory_budget = 0) {
                         PROFILE_PLACEHOLDER_SCOPE("gate_argument_time");
 
                         // max_gates_degree that comes from the outside does not take into account multiplication
@@ -141,7 +162,7 @@ namespace nil {
 
                         auto value_type_to_polynomial_dfs = [](
                             const typename variable_type::assignment_type& coeff) {
-                                return polynomial_dfs_type(0, 1, coeff);
+                                return arena_polynomial_dfs_type(0, 1, coeff);
                             };
 
                         std::vector<std::uint32_t> extended_domain_sizes;
@@ -154,7 +175,11 @@ namespace nil {
                         degree_limits.push_back(max_degree / 2);
                         extended_domain_sizes.push_back(max_domain_size / 2);
 
-                        std::vector<math::expression<polynomial_dfs_variable_type>> expressions(extended_domain_sizes.size());
+                        // expressions of every batch of gates, one per extended domain size
+                        std::vector<std::vector<math::expression<polynomial_dfs_variable_type>>> gate_batches(
+                            1, std::vector<math::expression<polynomial_dfs_variable_type>>(extended_domain_sizes.size()));
+                        std::unordered_set<polynomial_dfs_variable_type> batch_variables;
+                        const std::size_t column_bytes = max_domain_size * sizeof(typename FieldType::value_type);
 
                         auto theta_acc = FieldType::value_type::one();
 
@@ -191,26 +216,58 @@ namespace nil {
 
                             for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
                                 gate_results[i] *= selector;
-                                expressions[i] += gate_results[i];
                             }
-                        }
 
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type> variable_values;
-                        std::array<polynomial_dfs_type, argument_size> F;
+                            if (memory_budget != 0) {
+                                std::unordered_set<polynomial_dfs_variable_type> gate_variables;
+                                math::expression_for_each_variable_visitor<polynomial_dfs_variable_type> variables_visitor(
+                                    [&gate_variables](const polynomial_dfs_variable_type& var) {
+                                        gate_variables.insert(var);
+                                });
+                                for (const auto& gate_result : gate_results) {
+                                    variables_visitor.visit(gate_result);
+                                }
 
-                        for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
-                            if (i != 0 && extended_domain_sizes[i] != extended_domain_sizes[i-1]) {
-                                variable_values.clear();
+                                std::size_t new_variables = 0;
+                                for (const auto& var : gate_variables) {
+                                    new_variables += batch_variables.count(var) == 0 ? 1 : 0;
+                                }
+                                if (!batch_variables.empty() &&
+                                    (batch_variables.size() + new_variables) * column_bytes > memory_budget) {
+                                    gate_batches.emplace_back(extended_domain_sizes.size());
+                                    batch_variables.clear();
+                                }
+                                batch_variables.insert(gate_variables.begin(), gate_variables.end());
                             }
-                            build_variable_value_map(expressions[i], column_polynomials, original_domain,
-                                extended_domain_sizes[i], variable_values);
 
-                            math::cached_expression_evaluator<polynomial_dfs_variable_type> evaluator(
-                                expressions[i], [&assignments=variable_values, domain_size=extended_domain_sizes[i]](const polynomial_dfs_variable_type &var) {
-                                return assignments[var];
-                            });
+                            for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
+                                gate_batches.back()[i] += gate_results[i];
+                            }
+                        }
+
+                        std::unordered_map<polynomial_dfs_variable_type, arena_polynomial_dfs_type> variable_values;
+                        // Accumulated right away in the returned storage, the evaluations are added to it
+                        // straight from the arena.
+                        std::array<polynomial_dfs_type, argument_size> F;
 
-                            F[0] += evaluator.evaluate();
+                        for (const auto& expressions : gate_batches) {
+                            for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
+                                build_variable_value_map(expressions[i], column_polynomials, original_domain,
+                                    extended_domain_sizes[i], variable_values);
+
+                                math::cached_expression_evaluator<polynomial_dfs_variable_type> evaluator(
+                                    expressions[i], [&assignments=variable_values, domain_size=extended_domain_sizes[i]](const polynomial_dfs_variable_type &var) {
+                                    return assignments[var];
+                                });
+
+                                F[0] += evaluator.evaluate();
+                                // Extended copies of the columns are the bulk of the gate argument memory,
+                                // drop them once the last expression of this domain size is evaluated.
+                                if (i + 1 == extended_domain_sizes.size() ||
+                                    extended_domain_sizes[i + 1] != extended_domain_sizes[i]) {
+                                    variable_values.clear();
+                                }
+                            }
                         }
 
                         F[0] *= mask_polynomial;
@@ -29,6 +29,8 @@
 
 #include <algorithm>
 
+#include <nil/crypto3/algebra/algorithms/batch_inverse.hpp>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
@@ -38,6 +40,7 @@
 #include <nil/crypto3/hash/sha2.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
+#include <nil/crypto3/parallelization/parallel_for.hpp>
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/params.hpp>
@@ -104,7 +107,7 @@ namespace nil {
                         std::vector<math::polynomial_dfs<typename FieldType::value_type>> h_v = S_sigma;
                         BOOST_ASSERT(global_indices.size() == S_id.size());
                         BOOST_ASSERT(global_indices.size() == S_sigma.size());
-                        for (std::size_t i = 0; i < S_id.size(); i++) {
+                        parallelization::parallel_for(0, S_id.size(), [&](std::size_t i) {
                             BOOST_ASSERT(column_polynomials[global_indices[i]].size() == basic_domain->size());
                             BOOST_ASSERT(S_id[i].size() == basic_domain->size());
                             BOOST_ASSERT(S_sigma[i].size() == basic_domain->size());
@@ -118,18 +121,25 @@ namespace nil {
                             h_v[i] *= beta;
                             h_v[i] += gamma;
                             h_v[i] += column_polynomials[global_indices[i]];
-                        }
+                        });
 
-                        V_P[0] = FieldType::value_type::one();
-                        for (std::size_t j = 1; j < basic_domain->size(); j++) {
-                            typename FieldType::value_type nom = FieldType::value_type::one();
-                            typename FieldType::value_type denom = FieldType::value_type::one();
+                        // Collect all denominators first, so that they are inverted with a single batch inversion
+                        std::vector<typename FieldType::value_type> nom(basic_domain->size() - 1);
+                        std::vector<typename FieldType::value_type> denom(basic_domain->size() - 1);
+                        parallelization::parallel_for(1, basic_domain->size(), [&](std::size_t j) {
+                            nom[j - 1] = FieldType::value_type::one();
+                            denom[j - 1] = FieldType::value_type::one();
 
                             for (std::size_t i = 0; i < S_id.size(); i++) {
-                                nom *= g_v[i][j - 1];
-                                denom *= h_v[i][j - 1];
+                                nom[j - 1] *= g_v[i][j - 1];
+                                denom[j - 1] *= h_v[i][j - 1];
                             }
-                            V_P[j] = V_P[j - 1] * nom * denom.inversed();
+                        });
+                        algebra::batch_inverse(denom);
+
+                        V_P[0] = FieldType::value_type::one();
+                        for (std::size_t j = 1; j < basic_domain->size(); j++) {
+                            V_P[j] = V_P[j - 1] * nom[j - 1] * denom[j - 1];
                         }
 
                         // 4. Compute and add commitment to $V_P$ to $\text{transcript}$.
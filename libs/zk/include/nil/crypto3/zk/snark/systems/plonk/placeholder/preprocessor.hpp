@@ -471,11 +471,12 @@ namespace nil {
                         return q_blind;
                     }
 
-                    static inline typename preprocessed_data_type::public_commitments_type commitments(
+                    // Polynomials of FIXED_VALUES_BATCH in the order they are committed.
+                    static inline void append_fixed_values(
                         const plonk_public_polynomial_dfs_table<FieldType> &public_table,
-                        std::vector<polynomial_dfs_type> &id_perm_polys,
-                        std::vector<polynomial_dfs_type> &sigma_perm_polys,
-                        std::array<polynomial_dfs_type, 2> &q_last_q_blind,
+                        const std::vector<polynomial_dfs_type> &id_perm_polys,
+                        const std::vector<polynomial_dfs_type> &sigma_perm_polys,
+                        const std::array<polynomial_dfs_type, 2> &q_last_q_blind,
                         commitment_scheme_type &commitment_scheme
                     ) {
                         commitment_scheme.append_to_batch(FIXED_VALUES_BATCH, id_perm_polys);
@@ -484,12 +485,39 @@ namespace nil {
                         commitment_scheme.append_to_batch(FIXED_VALUES_BATCH, q_last_q_blind[1]);
                         commitment_scheme.append_to_batch(FIXED_VALUES_BATCH, public_table.constants());
                         commitment_scheme.append_to_batch(FIXED_VALUES_BATCH, public_table.selectors());
+                    }
+
+                    static inline typename preprocessed_data_type::public_commitments_type commitments(
+                        const plonk_public_polynomial_dfs_table<FieldType> &public_table,
+                        std::vector<polynomial_dfs_type> &id_perm_polys,
+                        std::vector<polynomial_dfs_type> &sigma_perm_polys,
+                        std::array<polynomial_dfs_type, 2> &q_last_q_blind,
+                        commitment_scheme_type &commitment_scheme
+                    ) {
+                        append_fixed_values(public_table, id_perm_polys, sigma_perm_polys, q_last_q_blind, commitment_scheme);
 
                         auto result = typename preprocessed_data_type::public_commitments_type({commitment_scheme.commit(FIXED_VALUES_BATCH)});
                         commitment_scheme.mark_batch_as_fixed(FIXED_VALUES_BATCH);
                         return result;
                     }
 
+                    // Hash of the circuit and of everything process() derives from it, the first part of verification_key.
+                    static inline typename transcript_hash_type::digest_type compute_constraint_system_with_params_hash(
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        const plonk_table_description<FieldType> &table_description,
+                        const typename commitment_scheme_type::params_type &commitment_params,
+                        const typename FieldType::value_type &delta
+                    ) {
+                        return nil::crypto3::zk::snark::detail::compute_constraint_system_with_params_hash<ParamsType, transcript_hash_type>(
+                            constraint_system,
+                            table_description,
+                            table_description.rows_amount,
+                            table_description.usable_rows_amount,
+                            commitment_params,
+                            "Default application dependent transcript initialization string",
+                            delta);
+                    }
+
                     // TODO: columns_with_copy_constraints -- It should be extracted from constraint_system
                     static inline preprocessed_data_type process(
                         const plonk_constraint_system<FieldType> &constraint_system,
@@ -569,14 +597,8 @@ namespace nil {
                             columns_rotations(constraint_system, table_description);
 
                         typename transcript_hash_type::digest_type constraint_system_with_params_hash =
-                            nil::crypto3::zk::snark::detail::compute_constraint_system_with_params_hash<ParamsType, transcript_hash_type>(
-                                constraint_system,
-                                table_description,
-                                N_rows,
-                                table_description.usable_rows_amount,
-                                commitment_scheme.get_commitment_params(),
-                                "Default application dependent transcript initialization string",
-                                delta);
+                            compute_constraint_system_with_params_hash(
+                                constraint_system, table_description, commitment_scheme.get_commitment_params(), delta);
 
                         typename preprocessed_data_type::verification_key vk = {constraint_system_with_params_hash, public_commitments.fixed_values};
 
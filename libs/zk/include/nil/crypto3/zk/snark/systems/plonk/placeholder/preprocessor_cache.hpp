@@ -0,0 +1,237 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_PLONK_PLACEHOLDER_PREPROCESSOR_CACHE_HPP
+#define CRYPTO3_ZK_PLONK_PLACEHOLDER_PREPROCESSOR_CACHE_HPP
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+
+#include <nil/crypto3/zk/commitments/type_traits.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/plonk/table_description.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/detail/column_polynomial.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_policy.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/detail/placeholder_scoped_profiler.hpp>
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                /** @brief Reuses the public preprocessing of a circuit across proofs.
+                 *
+                 * Entries are addressed by constraint_system_with_params_hash, which covers the constraint
+                 * system, the table description, the commitment params and delta, together with
+                 * max_quotient_poly_chunks. Constant and selector columns are not part of that hash, so a
+                 * candidate entry is only used if they are equal to the cached ones.
+                 *
+                 * Each entry keeps the preprocessed data and a copy of the commitment scheme taken right
+                 * after process(), i.e. with FIXED_VALUES_BATCH committed: its Merkle trees or KZG
+                 * commitments and the polynomials of the batch. process() takes a scheme that holds no
+                 * batches yet and returns the preprocessed data with a scheme to prove with, which on a hit
+                 * is a copy of the cached one. Only the public input columns are rebuilt on a hit, as they
+                 * may differ between proofs.
+                 *
+                 * The cache lives in memory, see marshalling/zk/types/placeholder/preprocessor_cache.hpp
+                 * to save it to disk and to insert() a saved entry in another process. For LPC the Merkle
+                 * tree of FIXED_VALUES_BATCH is saved too, so such an entry is not committed again.
+                 * Not thread safe.
+                 */
+                template<typename FieldType, typename ParamsType>
+                class placeholder_public_preprocessor_cache {
+                    typedef placeholder_public_preprocessor<FieldType, ParamsType> preprocessor_type;
+                    typedef detail::placeholder_policy<FieldType, ParamsType> policy_type;
+                    typedef typename math::polynomial_dfs<typename FieldType::value_type> polynomial_dfs_type;
+
+                public:
+                    using commitment_scheme_type = typename ParamsType::commitment_scheme_type;
+                    using preprocessed_data_type = typename preprocessor_type::preprocessed_data_type;
+
+                    struct entry_type {
+                        preprocessed_data_type preprocessed_data;
+                        // FIXED_VALUES_BATCH is committed and marked as fixed
+                        commitment_scheme_type commitment_scheme;
+                    };
+
+                    entry_type process(
+                        const plonk_constraint_system<FieldType> &constraint_system,
+                        typename policy_type::variable_assignment_type::public_table_type public_assignment,
+                        const plonk_table_description<FieldType> &table_description,
+                        const commitment_scheme_type &commitment_scheme,
+                        const std::size_t max_quotient_poly_chunks = 0,
+                        const typename FieldType::value_type &delta =
+                            algebra::fields::arithmetic_params<FieldType>::multiplicative_generator
+                    ) {
+                        const auto constraint_system_with_params_hash =
+                            preprocessor_type::compute_constraint_system_with_params_hash(
+                                constraint_system, table_description, commitment_scheme.get_commitment_params(), delta);
+
+                        std::vector<const entry_type *> candidates;
+                        for (const entry_type &entry : _entries) {
+                            const auto &common_data = entry.preprocessed_data.common_data;
+                            if (common_data.vk.constraint_system_with_params_hash == constraint_system_with_params_hash &&
+                                common_data.desc == table_description &&
+                                common_data.max_quotient_chunks == max_quotient_poly_chunks) {
+                                candidates.push_back(&entry);
+                            }
+                        }
+
+                        if (!candidates.empty()) {
+                            PROFILE_PLACEHOLDER_SCOPE("Placeholder public preprocessor cache lookup");
+
+                            std::shared_ptr<math::evaluation_domain<FieldType>> basic_domain =
+                                math::make_evaluation_domain<FieldType>(table_description.rows_amount);
+
+                            std::vector<polynomial_dfs_type> constants = detail::column_range_polynomial_dfs<FieldType>(
+                                public_assignment.constants(), basic_domain);
+                            std::vector<polynomial_dfs_type> selectors = detail::column_range_polynomial_dfs<FieldType>(
+                                public_assignment.selectors(), basic_domain);
+
+                            for (const entry_type *entry : candidates) {
+                                const auto &cached_table = entry->preprocessed_data.public_polynomial_table;
+                                if (cached_table.constants() != constants || cached_table.selectors() != selectors) {
+                                    continue;
+                                }
+
+                                ++_hits;
+
+                                const preprocessed_data_type &cached = entry->preprocessed_data;
+                                return entry_type({
+                                    preprocessed_data_type({
+                                        plonk_public_polynomial_dfs_table<FieldType>(
+                                            detail::column_range_polynomial_dfs<FieldType>(
+                                                public_assignment.move_public_inputs(), basic_domain),
+                                            std::move(constants), std::move(selectors)),
+                                        cached.permutation_polynomials,
+                                        cached.identity_polynomials,
+                                        cached.q_last,
+                                        cached.q_blind,
+                                        cached.common_data
+                                    }),
+                                    entry->commitment_scheme
+                                });
+                            }
+                        }
+
+                        ++_misses;
+                        commitment_scheme_type fixed_commitment_scheme = commitment_scheme;
+                        preprocessed_data_type result = preprocessor_type::process(
+                            constraint_system, std::move(public_assignment), table_description,
+                            fixed_commitment_scheme, max_quotient_poly_chunks, delta);
+                        _entries.push_back({result, fixed_commitment_scheme});
+                        return entry_type({std::move(result), std::move(fixed_commitment_scheme)});
+                    }
+
+                    /** @brief Adds the output of placeholder_public_preprocessor::process computed elsewhere.
+                     *
+                     * FIXED_VALUES_BATCH is committed again from the polynomials of preprocessed_data into a
+                     * copy of commitment_scheme, which must hold no batches yet. This costs the Merkle trees or
+                     * KZG commitments, but not the permutation polynomials and the FFTs of the columns.
+                     * Throws std::invalid_argument if the commitment does not match the verification key.
+                     */
+                    void insert(preprocessed_data_type preprocessed_data, const commitment_scheme_type &commitment_scheme) {
+                        PROFILE_PLACEHOLDER_SCOPE("Placeholder public preprocessor cache insert");
+
+                        commitment_scheme_type fixed_commitment_scheme = commitment_scheme;
+                        std::array<polynomial_dfs_type, 2> q_last_q_blind = {
+                            preprocessed_data.q_last, preprocessed_data.q_blind};
+
+                        const auto public_commitments = preprocessor_type::commitments(
+                            preprocessed_data.public_polynomial_table, preprocessed_data.identity_polynomials,
+                            preprocessed_data.permutation_polynomials, q_last_q_blind, fixed_commitment_scheme);
+                        if (public_commitments.fixed_values !=
+                            preprocessed_data.common_data.vk.fixed_values_commitment) {
+                            throw std::invalid_argument(
+                                "Preprocessed data does not match its fixed values commitment");
+                        }
+
+                        _entries.push_back({std::move(preprocessed_data), std::move(fixed_commitment_scheme)});
+                    }
+
+                    /** @brief Same as insert(preprocessed_data, commitment_scheme), but takes the Merkle tree of
+                     * FIXED_VALUES_BATCH saved from an entry, see lpc_commitment_scheme::get_precommitment, instead
+                     * of building it again.
+                     *
+                     * Only the root of the tree is checked against the verification key, the rest of it is trusted
+                     * to come from the polynomials of preprocessed_data. Throws std::invalid_argument on mismatch.
+                     */
+                    template<typename CommitmentSchemeType = commitment_scheme_type,
+                             std::enable_if_t<nil::crypto3::zk::is_lpc<CommitmentSchemeType>, bool> = true>
+                    void insert(preprocessed_data_type preprocessed_data, const commitment_scheme_type &commitment_scheme,
+                                typename CommitmentSchemeType::precommitment_type fixed_values_precommitment) {
+                        commitment_scheme_type fixed_commitment_scheme = commitment_scheme;
+                        preprocessor_type::append_fixed_values(
+                            preprocessed_data.public_polynomial_table, preprocessed_data.identity_polynomials,
+                            preprocessed_data.permutation_polynomials,
+                            {preprocessed_data.q_last, preprocessed_data.q_blind}, fixed_commitment_scheme);
+
+                        if (fixed_commitment_scheme.commit(FIXED_VALUES_BATCH, std::move(fixed_values_precommitment)) !=
+                            preprocessed_data.common_data.vk.fixed_values_commitment) {
+                            throw std::invalid_argument(
+                                "Fixed values precommitment does not match its fixed values commitment");
+                        }
+                        fixed_commitment_scheme.mark_batch_as_fixed(FIXED_VALUES_BATCH);
+
+                        _entries.push_back({std::move(preprocessed_data), std::move(fixed_commitment_scheme)});
+                    }
+
+                    const std::vector<entry_type> &entries() const {
+                        return _entries;
+                    }
+
+                    std::size_t size() const {
+                        return _entries.size();
+                    }
+
+                    std::size_t hits() const {
+                        return _hits;
+                    }
+
+                    std::size_t misses() const {
+                        return _misses;
+                    }
+
+                    void clear() {
+                        _entries.clear();
+                    }
+
+                private:
+                    std::vector<entry_type> _entries;
+                    std::size_t _hits = 0;
+                    std::size_t _misses = 0;
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_PLACEHOLDER_PREPROCESSOR_CACHE_HPP
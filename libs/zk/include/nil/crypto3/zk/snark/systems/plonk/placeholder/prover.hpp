@@ -29,11 +29,14 @@
 #define CRYPTO3_ZK_PLONK_PLACEHOLDER_PROVER_HPP
 
 #include <chrono>
+#include <iomanip>
 #include <set>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/memory/memory_arena.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
+#include <nil/crypto3/parallelization/parallel_for.hpp>
 
 #include <nil/crypto3/zk/commitments/polynomial/lpc.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
@@ -89,6 +92,8 @@ namespace nil {
                     constexpr static const std::size_t permutation_parts = 3;
                     constexpr static const std::size_t lookup_parts = 6;
                     constexpr static const std::size_t f_parts = 8;
+                    // polynomials on the largest gate argument domain which the arena may keep for reuse
+                    constexpr static const std::size_t arena_cached_polynomials = 8;
               public:
 
                     static inline placeholder_proof<FieldType, ParamsType> process(
@@ -96,11 +101,13 @@ namespace nil {
                         typename private_preprocessor_type::preprocessed_data_type preprocessed_private_data,
                         const plonk_table_description<FieldType> &table_description,
                         const plonk_constraint_system<FieldType> &constraint_system,
-                        commitment_scheme_type commitment_scheme
+                        commitment_scheme_type commitment_scheme,
+                        std::size_t gate_memory_budget = 0,
+                        std::size_t arena_cache_limit = 0
                     ) {
                         auto prover = placeholder_prover<FieldType, ParamsType>(
                             preprocessed_public_data, std::move(preprocessed_private_data), table_description,
-                            constraint_system, commitment_scheme);
+                            constraint_system, commitment_scheme, gate_memory_budget, arena_cache_limit);
                         return prover.process();
                     }
 
@@ -109,7 +116,9 @@ namespace nil {
                         typename private_preprocessor_type::preprocessed_data_type preprocessed_private_data,
                         const plonk_table_description<FieldType> &table_description,
                         const plonk_constraint_system<FieldType> &constraint_system,
-                        const commitment_scheme_type &commitment_scheme
+                        const commitment_scheme_type &commitment_scheme,
+                        std::size_t gate_memory_budget = 0,
+                        std::size_t arena_cache_limit = 0
                     )
                             : preprocessed_public_data(preprocessed_public_data)
                             , table_description(table_description)
@@ -121,6 +130,8 @@ namespace nil {
                             , transcript(std::vector<std::uint8_t>({}))
                             , _is_lookup_enabled(constraint_system.lookup_gates().size() > 0)
                             , _commitment_scheme(commitment_scheme)
+                            , _gate_memory_budget(gate_memory_budget)
+                            , _arena_cache_limit(arena_cache_limit)
                     {
                         // Initialize transcript.
                         transcript(preprocessed_public_data.common_data.vk.constraint_system_with_params_hash);
@@ -133,6 +144,18 @@ namespace nil {
                     placeholder_proof<FieldType, ParamsType> process() {
                         PROFILE_PLACEHOLDER_SCOPE("Placeholder prover, total time");
 
+                        // Polynomials that opt into memory::arena_allocator reuse the blocks of this proof only.
+                        // The freed blocks kept for reuse are bounded by the arena cache limit, if there is one, or
+                        // by a few polynomials on the largest extended domain of the gate argument.
+                        memory::memory_arena arena(_arena_cache_limit != 0 ?
+                                                   _arena_cache_limit :
+                                                   arena_cached_polynomials *
+                                                       preprocessed_public_data.common_data.basic_domain->m *
+                                                       math::detail::power_of_two(
+                                                           preprocessed_public_data.common_data.max_gates_degree + 1) *
+                                                       sizeof(typename FieldType::value_type));
+                        memory::scoped_memory_arena arena_scope(arena);
+
                         // 2. Commit witness columns and public_input columns
                         _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->witnesses());
                         _commitment_scheme.append_to_batch(VARIABLE_VALUES_BATCH, _polynomial_table->public_inputs());
@@ -184,8 +207,20 @@ namespace nil {
                             preprocessed_public_data.common_data.basic_domain,
                             preprocessed_public_data.common_data.max_gates_degree,
                             mask_polynomial,
-                            transcript
+                            transcript,
+                            _gate_memory_budget
                         )[0];
+#ifdef ZK_PLACEHOLDER_PROFILING_ENABLED
+                        {
+                            const memory::arena_statistics stats = arena.statistics();
+                            std::cout << "gate argument arena: " << stats.bytes_allocated / (1024 * 1024)
+                                      << " MB allocated, " << stats.peak_bytes_in_use / (1024 * 1024)
+                                      << " MB peak, " << stats.allocations << " allocations, reuse rate "
+                                      << std::setprecision(3) << stats.reuse_rate() << std::endl;
+                        }
+#endif
+                        // Nothing past the gate argument draws from the arena, return its cached blocks now.
+                        arena.release();
 
                         /////TEST
 #ifdef ZK_PLACEHOLDER_DEBUG_ENABLED
@@ -218,6 +253,9 @@ namespace nil {
 
                 private:
                     std::vector<polynomial_dfs_type> quotient_polynomial_split_dfs() {
+                        // quotient_polynomial() consumes _F_dfs, remember the size of the split parts beforehand.
+                        const std::size_t T_splitted_dfs_size = _F_dfs[0].size();
+
                         // TODO: pass max_degree parameter placeholder
                         std::vector<polynomial_type> T_splitted = detail::split_polynomial<FieldType>(
                             quotient_polynomial(), table_description.rows_amount - 1
@@ -249,11 +287,13 @@ namespace nil {
                         // If some columns used in permutation or lookup argument are zero, real quotient polynomial degree
                         //      may be less than split_polynomial_size.
                         std::vector<polynomial_dfs_type> T_splitted_dfs(split_polynomial_size,
-                            polynomial_dfs_type(0, _F_dfs[0].size(), FieldType::value_type::zero()));
+                            polynomial_dfs_type(0, T_splitted_dfs_size, FieldType::value_type::zero()));
 
-                        for (std::size_t k = 0; k < T_splitted.size(); k++) {
+                        parallelization::parallel_for(0, T_splitted.size(), [&](std::size_t k) {
                             T_splitted_dfs[k].from_coefficients(T_splitted[k]);
-                        }
+                            // Free the coefficient form as soon as its evaluation form is ready.
+                            T_splitted[k] = polynomial_type();
+                        });
                         return T_splitted_dfs;
                     }
 
@@ -265,16 +305,25 @@ namespace nil {
                             transcript.template challenges<FieldType, f_parts>();
 
                         // 7.2. Compute F_consolidated
-                        std::vector<polynomial_dfs_type> F_consolidated_dfs_parts(_F_dfs.begin(), _F_dfs.end());
-                        for (std::size_t i = 0; i < F_consolidated_dfs_parts.size(); ++i) {
-                            if (_F_dfs[i].is_zero()) {
+                        // The parts are moved out of _F_dfs rather than copied, and polynomial_sum releases each
+                        // of them once it is added, so at most one extra copy of the F parts is alive at a time.
+                        std::vector<polynomial_dfs_type> F_consolidated_dfs_parts;
+                        F_consolidated_dfs_parts.reserve(_F_dfs.size());
+                        for (std::size_t i = 0; i < _F_dfs.size(); ++i) {
+                            F_consolidated_dfs_parts.emplace_back(std::move(_F_dfs[i]));
+                            _F_dfs[i] = polynomial_dfs_type();
+                            if (F_consolidated_dfs_parts[i].is_zero()) {
                                 continue;
                             }
                             F_consolidated_dfs_parts[i] *= alphas[i];
                         }
-                        polynomial_dfs_type F_consolidated_dfs = polynomial_sum<FieldType>(std::move(F_consolidated_dfs_parts));
 
-                        polynomial_type F_consolidated_normal(F_consolidated_dfs.coefficients());
+                        polynomial_type F_consolidated_normal;
+                        {
+                            polynomial_dfs_type F_consolidated_dfs =
+                                polynomial_sum<FieldType>(std::move(F_consolidated_dfs_parts));
+                            F_consolidated_normal = polynomial_type(F_consolidated_dfs.coefficients());
+                        }
 
                         polynomial_type T_consolidated =
                             F_consolidated_normal / preprocessed_public_data.common_data.Z;
@@ -477,6 +526,12 @@ namespace nil {
                     typename FieldType::value_type _omega;
                     std::vector<typename FieldType::value_type> _challenge_point;
                     commitment_scheme_type _commitment_scheme;
+                    // Bound in bytes for the extended-domain columns alive at once in the gate argument, 0 for
+                    // none. It does not cover the permutation and lookup arguments, the commitment batches or the
+                    // quotient.
+                    std::size_t _gate_memory_budget;
+                    // Bound in bytes for the freed blocks the proof's memory arena keeps for reuse, 0 for default.
+                    std::size_t _arena_cache_limit;
                 };
             }    // namespace snark
         }        // namespace zk
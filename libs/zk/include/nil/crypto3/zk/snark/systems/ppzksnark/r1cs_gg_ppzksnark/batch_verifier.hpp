@@ -0,0 +1,258 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+// @file Declaration of interfaces for batch verification of R1CS GG-ppzkSNARK proofs.
+//
+// N proofs against the same verification key are checked at once: every verification
+// equation is scaled by a random scalar r_i and the scaled equations are multiplied,
+//
+//     prod_i e(r_i A_i, B_i) * e(-sum_i r_i IC_i, gamma) * e(-sum_i r_i C_i, delta)
+//         == e(alpha, beta)^(sum_i r_i),
+//
+// which takes one multi-Miller loop over N + 2 pairs and one final exponentiation.
+// The verification key only keeps e(alpha, beta), hence the exponentiation in GT in place
+// of a pairing. A false batch of proofs passes with probability at most 1 / |Fr|.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BATCH_VERIFIER_HPP
+#define CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BATCH_VERIFIER_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/verifier.hpp>
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/detail/basic_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+
+                /**
+                 * Batch verifier for the R1CS GG-ppzkSNARK with strong input consistency.
+                 *
+                 * The public input part of the combined check is a single multi-scalar multiplication
+                 * over the verification key: sum_i r_i IC_i = (sum_i r_i) gamma_ABC_0 +
+                 * sum_j (sum_i r_i x_ij) gamma_ABC_j. The G2 lines of gamma and delta come from the
+                 * processed verification key, so only the B_i are precomputed per batch.
+                 */
+                template<typename CurveType>
+                class r1cs_gg_ppzksnark_batch_verifier {
+                    typedef detail::r1cs_gg_ppzksnark_basic_policy<CurveType, proving_mode::basic> policy_type;
+
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename CurveType::template g1_type<> g1_type;
+                    typedef typename CurveType::gt_type gt_type;
+                    typedef typename pairing::pairing_policy<CurveType>::g1_precomputed_type g1_precomputed_type;
+                    typedef typename pairing::pairing_policy<CurveType>::g2_precomputed_type g2_precomputed_type;
+
+                    typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename g1_type::value_type g1_value_type;
+
+                public:
+                    typedef typename policy_type::primary_input_type primary_input_type;
+                    typedef typename policy_type::verification_key_type verification_key_type;
+                    typedef typename policy_type::processed_verification_key_type processed_verification_key_type;
+                    typedef typename policy_type::proof_type proof_type;
+
+                    /**
+                     * Returns true if every proof verifies against its primary input.
+                     */
+                    static inline bool process(const verification_key_type &verification_key,
+                                               const std::vector<primary_input_type> &primary_inputs,
+                                               const std::vector<proof_type> &proofs) {
+                        return process(r1cs_gg_ppzksnark_process_verification_key<CurveType>::process(verification_key),
+                                       primary_inputs, proofs);
+                    }
+
+                    static inline bool process(const processed_verification_key_type &processed_verification_key,
+                                               const std::vector<primary_input_type> &primary_inputs,
+                                               const std::vector<proof_type> &proofs) {
+                        BOOST_ASSERT(primary_inputs.size() == proofs.size());
+
+                        std::vector<std::size_t> indices(proofs.size());
+                        for (std::size_t i = 0; i < indices.size(); ++i) {
+                            if (!is_admissible(processed_verification_key, primary_inputs[i], proofs[i])) {
+                                return false;
+                            }
+                            indices[i] = i;
+                        }
+
+                        return batch_check(processed_verification_key, primary_inputs, proofs, indices);
+                    }
+
+                    /**
+                     * Returns the sorted indices of the proofs that do not verify.
+                     *
+                     * A failing batch is split in halves until the failing proofs are isolated, so k
+                     * invalid proofs out of N cost O(k log N) batch checks rather than N single ones.
+                     */
+                    static inline std::vector<std::size_t>
+                        invalid_proofs(const verification_key_type &verification_key,
+                                       const std::vector<primary_input_type> &primary_inputs,
+                                       const std::vector<proof_type> &proofs) {
+                        return invalid_proofs(
+                            r1cs_gg_ppzksnark_process_verification_key<CurveType>::process(verification_key),
+                            primary_inputs, proofs);
+                    }
+
+                    static inline std::vector<std::size_t>
+                        invalid_proofs(const processed_verification_key_type &processed_verification_key,
+                                       const std::vector<primary_input_type> &primary_inputs,
+                                       const std::vector<proof_type> &proofs) {
+                        BOOST_ASSERT(primary_inputs.size() == proofs.size());
+
+                        std::vector<std::size_t> result, indices;
+                        indices.reserve(proofs.size());
+                        for (std::size_t i = 0; i < proofs.size(); ++i) {
+                            if (is_admissible(processed_verification_key, primary_inputs[i], proofs[i])) {
+                                indices.emplace_back(i);
+                            } else {
+                                result.emplace_back(i);
+                            }
+                        }
+
+                        bisect(processed_verification_key, primary_inputs, proofs, indices.begin(), indices.end(),
+                               result);
+
+                        std::sort(result.begin(), result.end());
+                        return result;
+                    }
+
+                private:
+                    /**
+                     * A proof enters a batch only if its points lie in the prime order subgroups: the
+                     * random linear combination does not protect against a small order component of
+                     * A, B or C, which would be annihilated by some r_i with non-negligible probability.
+                     */
+                    static inline bool is_admissible(const processed_verification_key_type &processed_verification_key,
+                                                     const primary_input_type &primary_input,
+                                                     const proof_type &proof) {
+                        return processed_verification_key.gamma_ABC_g1.domain_size() == primary_input.size() &&
+                               proof.is_well_formed() && algebra::curves::detail::subgroup_check(proof.g_A) &&
+                               algebra::curves::detail::subgroup_check(proof.g_B) &&
+                               algebra::curves::detail::subgroup_check(proof.g_C);
+                    }
+
+                    static inline scalar_field_value_type random_non_zero() {
+                        scalar_field_value_type r = algebra::random_element<scalar_field_type>();
+                        while (r.is_zero()) {
+                            r = algebra::random_element<scalar_field_type>();
+                        }
+                        return r;
+                    }
+
+                    static bool batch_check(const processed_verification_key_type &processed_verification_key,
+                                            const std::vector<primary_input_type> &primary_inputs,
+                                            const std::vector<proof_type> &proofs,
+                                            const std::vector<std::size_t> &indices) {
+                        if (indices.empty()) {
+                            return true;
+                        }
+
+                        const std::size_t n = indices.size();
+                        const std::size_t num_inputs = processed_verification_key.gamma_ABC_g1.domain_size();
+
+                        std::vector<scalar_field_value_type> r(n);
+                        scalar_field_value_type r_sum = scalar_field_value_type::zero();
+                        std::vector<scalar_field_value_type> input_scalars(num_inputs,
+                                                                           scalar_field_value_type::zero());
+                        std::vector<g1_value_type> g_C(n);
+                        for (std::size_t k = 0; k < n; ++k) {
+                            r[k] = random_non_zero();
+                            r_sum += r[k];
+
+                            const primary_input_type &primary_input = primary_inputs[indices[k]];
+                            for (std::size_t j = 0; j < num_inputs; ++j) {
+                                input_scalars[j] += r[k] * primary_input[j];
+                            }
+                            g_C[k] = proofs[indices[k]].g_C;
+                        }
+
+                        // sum_i r_i IC_i, accumulate_chunk adds gamma_ABC_0 with coefficient 1
+                        const g1_value_type &gamma_ABC_0 = processed_verification_key.gamma_ABC_g1.first;
+                        const g1_value_type acc =
+                            processed_verification_key.gamma_ABC_g1
+                                .accumulate_chunk(input_scalars.begin(), input_scalars.end(), 0)
+                                .first +
+                            (r_sum - scalar_field_value_type::one()) * gamma_ABC_0;
+
+                        const g1_value_type acc_C = algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                            g_C.begin(), g_C.end(), r.begin(), r.end(), 1);
+
+                        std::vector<g1_precomputed_type> prec_P;
+                        std::vector<g2_precomputed_type> prec_Q;
+                        prec_P.reserve(n + 2);
+                        prec_Q.reserve(n + 2);
+                        for (std::size_t k = 0; k < n; ++k) {
+                            const proof_type &proof = proofs[indices[k]];
+                            prec_P.emplace_back(precompute_g1<CurveType>(r[k] * proof.g_A));
+                            prec_Q.emplace_back(precompute_g2<CurveType>(proof.g_B));
+                        }
+                        prec_P.emplace_back(precompute_g1<CurveType>(-acc));
+                        prec_Q.emplace_back(processed_verification_key.vk_gamma_g2_precomp);
+                        prec_P.emplace_back(precompute_g1<CurveType>(-acc_C));
+                        prec_Q.emplace_back(processed_verification_key.vk_delta_g2_precomp);
+
+                        const typename gt_type::value_type QAP =
+                            final_exponentiation<CurveType>(multi_miller_loop<CurveType>(prec_P, prec_Q));
+
+                        return QAP == processed_verification_key.vk_alpha_g1_beta_g2.pow(r_sum.data);
+                    }
+
+                    static void bisect(const processed_verification_key_type &processed_verification_key,
+                                       const std::vector<primary_input_type> &primary_inputs,
+                                       const std::vector<proof_type> &proofs,
+                                       std::vector<std::size_t>::const_iterator first,
+                                       std::vector<std::size_t>::const_iterator last,
+                                       std::vector<std::size_t> &result) {
+                        if (first == last ||
+                            batch_check(processed_verification_key, primary_inputs, proofs,
+                                        std::vector<std::size_t>(first, last))) {
+                            return;
+                        }
+                        if (std::distance(first, last) == 1) {
+                            result.emplace_back(*first);
+                            return;
+                        }
+
+                        const std::vector<std::size_t>::const_iterator middle = first + std::distance(first, last) / 2;
+                        bisect(processed_verification_key, primary_inputs, proofs, first, middle, result);
+                        bisect(processed_verification_key, primary_inputs, proofs, middle, last, result);
+                    }
+                };
+            }    // namespace snark
+        }        // namespace zk
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BATCH_VERIFIER_HPP
@@ -26,8 +26,11 @@
 #ifndef CRYPTO3_R1CS_GG_PPZKSNARK_PROVING_KEY_HPP
 #define CRYPTO3_R1CS_GG_PPZKSNARK_PROVING_KEY_HPP
 
+#include <memory>
+
 #include <nil/crypto3/zk/commitments/polynomial/knowledge_commitment.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs_csr.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/modes.hpp>
 
 namespace nil {
@@ -39,6 +42,8 @@ namespace nil {
                 struct r1cs_gg_ppzksnark_proving_key {
                     typedef CurveType curve_type;
                     typedef r1cs_constraint_system<typename CurveType::scalar_field_type> constraint_system_type;
+                    typedef r1cs_csr_constraint_system<typename CurveType::scalar_field_type>
+                        csr_constraint_system_type;
 
                     typename CurveType::template g1_type<>::value_type alpha_g1;
                     typename CurveType::template g1_type<>::value_type beta_g1;
@@ -120,6 +125,19 @@ namespace nil {
                                1 * g1_type::value_bits + 1 * g2_type::value_bits;
                     }
 
+                    /**
+                     * CSR form of constraint_system, which is what the prover evaluates. Built on first use and
+                     * shared by copies of the key, so constraint_system must not change afterwards.
+                     */
+                    const csr_constraint_system_type &csr_constraint_system() const {
+                        std::shared_ptr<const csr_constraint_system_type> csr = std::atomic_load(&csr_cache);
+                        if (!csr) {
+                            csr = std::make_shared<const csr_constraint_system_type>(constraint_system);
+                            std::atomic_store(&csr_cache, csr);
+                        }
+                        return *csr;
+                    }
+
                     bool operator==(const r1cs_gg_ppzksnark_proving_key &other) const {
                         return (this->alpha_g1 == other.alpha_g1 && this->beta_g1 == other.beta_g1 &&
                                 this->beta_g2 == other.beta_g2 && this->delta_g1 == other.delta_g1 &&
@@ -127,6 +145,9 @@ namespace nil {
                                 this->B_query == other.B_query && this->H_query == other.H_query &&
                                 this->L_query == other.L_query && this->constraint_system == other.constraint_system);
                     }
+
+                private:
+                    mutable std::shared_ptr<const csr_constraint_system_type> csr_cache;
                 };
             }    // namespace snark
         }        // namespace zk
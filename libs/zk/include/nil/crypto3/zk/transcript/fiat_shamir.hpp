@@ -27,6 +27,8 @@
 #ifndef CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 #define CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 
+#include <array>
+
 #include <nil/marshalling/algorithms/pack.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
@@ -172,13 +174,23 @@ namespace nil {
                         algebra::is_field_element<element>::value
                         >
                     operator()(element const& data) {
-                        nil::marshalling::status_type status;
-                        std::vector<std::uint8_t> byte_data =
-                            nil::marshalling::pack<nil::marshalling::option::big_endian>(data, status);
-                        BOOST_ASSERT(status == nil::marshalling::status_type::success);
-                        auto acc_convertible = hash<hash_type>(state);
-                        state = accumulators::extract::hash<hash_type>(
-                                hash<hash_type>(byte_data, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                        absorb_element(data);
+                    }
+
+                    /*!
+                     * @brief Absorbs the field or group elements of [first, last) one by one, the challenges
+                     * are the same as after calling operator() on each element.
+                     */
+                    template<typename InputIterator>
+                    void absorb_elements(InputIterator first, InputIterator last) {
+                        for (; first != last; ++first) {
+                            absorb_element(*first);
+                        }
+                    }
+
+                    template<typename InputRange>
+                    void absorb_elements(const InputRange &r) {
+                        absorb_elements(std::begin(r), std::end(r));
                     }
 
                     template<typename Field>
@@ -231,6 +243,24 @@ namespace nil {
                     }
 
                 private:
+                    // Serializes to the same bytes as nil::marshalling::pack, but into a buffer on the stack
+                    template<typename element>
+                    void absorb_element(element const& data) {
+                        using marshalling_type = typename nil::marshalling::is_compatible<element>::template type<
+                            nil::marshalling::option::big_endian>;
+
+                        std::array<std::uint8_t, marshalling_type::max_length()> byte_data;
+                        marshalling_type filled_data(data);
+                        auto write_iter = byte_data.begin();
+                        nil::marshalling::status_type status = filled_data.write(write_iter, byte_data.size());
+                        BOOST_ASSERT(status == nil::marshalling::status_type::success);
+
+                        auto acc_convertible = hash<hash_type>(state);
+                        state = accumulators::extract::hash<hash_type>(
+                                hash<hash_type>(byte_data.cbegin(), byte_data.cbegin() + filled_data.length(),
+                                                static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                    }
+
                     typename hash_type::digest_type state;
                 };
 
@@ -303,6 +333,18 @@ namespace nil {
                         sponge.absorb(hash<hash_type>(first, last));
                     }
 
+                    template<typename InputIterator>
+                    void absorb_elements(InputIterator first, InputIterator last) {
+                        for (; first != last; ++first) {
+                            (*this)(*first);
+                        }
+                    }
+
+                    template<typename InputRange>
+                    void absorb_elements(const InputRange &r) {
+                        absorb_elements(std::begin(r), std::end(r));
+                    }
+
                     template<typename Field>
                     typename Field::value_type challenge() {
                         typename Field::value_type result = sponge.squeeze();
@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_to_qap_benchmark_test
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/coset.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+
+#include <nil/crypto3/zk/snark/reductions/r1cs_to_qap.hpp>
+
+#include "../systems/ppzksnark/r1cs_examples.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+// Coefficients of H computed step by step, one transform after another, as a reference
+template<typename FieldType>
+std::vector<typename FieldType::value_type>
+    reference_coefficients_for_H(const r1cs_example<FieldType> &example, const typename FieldType::value_type &d1,
+                                 const typename FieldType::value_type &d2, const typename FieldType::value_type &d3) {
+    typedef typename FieldType::value_type value_type;
+
+    const r1cs_constraint_system<FieldType> &cs = example.constraint_system;
+    const std::shared_ptr<math::evaluation_domain<FieldType>> domain =
+        math::make_evaluation_domain<FieldType>(cs.num_constraints() + cs.num_inputs() + 1);
+    const value_type g = value_type(algebra::fields::arithmetic_params<FieldType>::multiplicative_generator);
+
+    r1cs_variable_assignment<FieldType> full_variable_assignment = example.primary_input;
+    full_variable_assignment.insert(full_variable_assignment.end(), example.auxiliary_input.begin(),
+                                    example.auxiliary_input.end());
+
+    std::vector<value_type> aA(domain->m, value_type::zero()), aB(domain->m, value_type::zero()),
+        aC(domain->m, value_type::zero());
+    for (std::size_t i = 0; i <= cs.num_inputs(); ++i) {
+        aA[i + cs.num_constraints()] = (i > 0 ? full_variable_assignment[i - 1] : value_type::one());
+    }
+    for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
+        aA[i] += cs.constraints[i].a.evaluate(full_variable_assignment);
+        aB[i] += cs.constraints[i].b.evaluate(full_variable_assignment);
+        aC[i] += cs.constraints[i].c.evaluate(full_variable_assignment);
+    }
+
+    domain->inverse_fft(aA);
+    domain->inverse_fft(aB);
+    domain->inverse_fft(aC);
+
+    std::vector<value_type> coefficients_for_H(domain->m + 1, value_type::zero());
+    for (std::size_t i = 0; i < domain->m; ++i) {
+        coefficients_for_H[i] = d2 * aA[i] + d1 * aB[i];
+    }
+    coefficients_for_H[0] -= d3;
+    domain->add_poly_z(d1 * d2, coefficients_for_H);
+
+    math::multiply_by_coset(aA, g);
+    domain->fft(aA);
+    math::multiply_by_coset(aB, g);
+    domain->fft(aB);
+    math::multiply_by_coset(aC, g);
+    domain->fft(aC);
+
+    for (std::size_t i = 0; i < domain->m; ++i) {
+        aA[i] = aA[i] * aB[i] - aC[i];
+    }
+    domain->divide_by_z_on_coset(aA);
+    domain->inverse_fft(aA);
+    math::multiply_by_coset(aA, g.inversed());
+
+    for (std::size_t i = 0; i < domain->m; ++i) {
+        coefficients_for_H[i] += aA[i];
+    }
+    return coefficients_for_H;
+}
+
+template<typename FieldType>
+void run_witness_map(std::size_t log_domain_size, bool check_reference) {
+    typedef typename FieldType::value_type value_type;
+
+    const std::size_t num_inputs = 10;
+    const std::size_t num_constraints = (1ul << log_domain_size) - num_inputs - 1;
+
+    const r1cs_example<FieldType> example =
+        generate_r1cs_example_with_field_input<FieldType>(num_constraints, num_inputs);
+    const value_type d1 = algebra::random_element<FieldType>(), d2 = algebra::random_element<FieldType>(),
+                     d3 = algebra::random_element<FieldType>();
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    const qap_witness<FieldType> witness = reductions::r1cs_to_qap<FieldType>::witness_map(
+        example.constraint_system, example.primary_input, example.auxiliary_input, d1, d2, d3);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "witness_map for 2^" << log_domain_size << " constraints: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms" << std::endl;
+
+    if (check_reference) {
+        begin = std::chrono::high_resolution_clock::now();
+        const std::vector<value_type> expected = reference_coefficients_for_H(example, d1, d2, d3);
+        end = std::chrono::high_resolution_clock::now();
+
+        std::cout << "sequential reference for 2^" << log_domain_size << " constraints: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms"
+                  << std::endl;
+
+        BOOST_CHECK(witness.coefficients_for_H == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(r1cs_to_qap_benchmark_suite)
+
+BOOST_AUTO_TEST_CASE(witness_map_matches_reference) {
+    run_witness_map<algebra::curves::bls12<381>::scalar_field_type>(10, true);
+}
+
+BOOST_AUTO_TEST_CASE(witness_map_benchmark) {
+    run_witness_map<algebra::curves::bls12<381>::scalar_field_type>(20, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -249,4 +249,61 @@ BOOST_AUTO_TEST_SUITE(kimchi_commitment_test_suite)
         BOOST_CHECK(kimchi_pedersen::verify_eval(params, g_map, batch));
     }
 
+    BOOST_AUTO_TEST_CASE(kimchi_commitment_test_b_poly_coefficents) {
+        std::vector<scalar_value_type> chals(5);
+        std::generate(chals.begin(), chals.end(), []() { return algebra::random_element<scalar_field_type>(); });
+        scalar_value_type x = algebra::random_element<scalar_field_type>();
+        scalar_value_type scale = algebra::random_element<scalar_field_type>();
+
+        std::vector<scalar_value_type> s = kimchi_pedersen::b_poly_coefficents(chals, scale);
+        BOOST_CHECK_EQUAL(s.size(), std::size_t(1) << chals.size());
+        BOOST_CHECK(math::polynomial<scalar_value_type>(s).evaluate(x) == scale * kimchi_pedersen::b_poly(chals, x));
+    }
+
+    BOOST_AUTO_TEST_CASE(kimchi_commitment_test_deferred_opening_proofs) {
+        snark::group_map<curve_type> g_map;
+        params_type params = kimchi_pedersen::setup(20);
+
+        auto make_batch = [&]() {
+            sponge_type fq_sponge;
+            std::vector<scalar_value_type> coeffs(15);
+            std::generate(coeffs.begin(), coeffs.end(), []() { return algebra::random_element<scalar_field_type>(); });
+            math::polynomial<scalar_value_type> poly(coeffs);
+
+            blinded_commitment_type commitment = kimchi_pedersen::commitment(params, poly, -1);
+            scalar_value_type u = algebra::random_element<scalar_field_type>();
+            scalar_value_type v = algebra::random_element<scalar_field_type>();
+            polynomial_type polys{{poly, -1, std::get<1>(commitment)}};
+            std::vector<scalar_value_type> elm{algebra::random_element<scalar_field_type>(),
+                                               algebra::random_element<scalar_field_type>()};
+
+            proof_type proof = kimchi_pedersen::proof_eval(params, g_map, polys, elm, v, u, fq_sponge);
+
+            chunked_polynomial poly_chunked(poly, params.g.size());
+            std::vector<std::vector<scalar_value_type>> poly_chunked_evals = {poly_chunked.evaluate_chunks(elm[0]),
+                                                                              poly_chunked.evaluate_chunks(elm[1])};
+            std::vector<evaluation_type> evals;
+            evals.emplace_back(std::get<0>(commitment), poly_chunked_evals, -1);
+
+            std::vector<batchproof_type> batch;
+            batch.emplace_back(sponge_type(), evals, elm, v, u, proof);
+            return batch;
+        };
+
+        // a chain of verifications, each leaving its <s, G> check in the accumulator
+        kimchi_pedersen::accumulator_type acc;
+        for (std::size_t i = 0; i < 4; ++i) {
+            std::vector<batchproof_type> batch = make_batch();
+            BOOST_CHECK(kimchi_pedersen::verify_eval(params, g_map, batch, acc));
+        }
+        BOOST_CHECK_EQUAL(acc.sg.size(), std::size_t(4));
+
+        kimchi_pedersen::accumulator_type wrong_acc = acc;
+        std::swap(wrong_acc.sg[1], wrong_acc.sg[2]);
+
+        BOOST_CHECK(kimchi_pedersen::settle(params, acc));
+        BOOST_CHECK(acc.sg.empty());
+        BOOST_CHECK(!kimchi_pedersen::settle(params, wrong_acc));
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 agent <agent@local>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE r1cs_csr_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/constraint_satisfaction_problems/r1cs_csr.hpp>
+#include <nil/crypto3/zk/snark/reductions/r1cs_to_qap.hpp>
+
+#include "../../systems/ppzksnark/r1cs_examples.hpp"
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+typedef algebra::curves::bls12<381>::scalar_field_type field_type;
+typedef field_type::value_type value_type;
+
+BOOST_AUTO_TEST_SUITE(r1cs_csr_test_suite)
+
+BOOST_AUTO_TEST_CASE(r1cs_csr_evaluate_test) {
+    const r1cs_example<field_type> example = generate_r1cs_example_with_field_input<field_type>(100, 10);
+    const r1cs_constraint_system<field_type> &cs = example.constraint_system;
+    const r1cs_csr_constraint_system<field_type> csr(cs);
+
+    BOOST_CHECK_EQUAL(csr.num_constraints(), cs.num_constraints());
+    BOOST_CHECK_EQUAL(csr.num_variables(), cs.num_variables());
+    BOOST_CHECK_EQUAL(csr.num_inputs(), cs.num_inputs());
+
+    r1cs_variable_assignment<field_type> full_variable_assignment = example.primary_input;
+    full_variable_assignment.insert(full_variable_assignment.end(), example.auxiliary_input.begin(),
+                                    example.auxiliary_input.end());
+
+    std::vector<value_type> a(cs.num_constraints()), b(cs.num_constraints()), c(cs.num_constraints());
+    csr.evaluate(full_variable_assignment, a, b, c);
+    for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
+        BOOST_CHECK(a[i] == cs.constraints[i].a.evaluate(full_variable_assignment));
+        BOOST_CHECK(b[i] == cs.constraints[i].b.evaluate(full_variable_assignment));
+        BOOST_CHECK(c[i] == cs.constraints[i].c.evaluate(full_variable_assignment));
+    }
+
+    BOOST_CHECK(csr.is_satisfied(example.primary_input, example.auxiliary_input));
+
+    r1cs_auxiliary_input<field_type> wrong_auxiliary_input = example.auxiliary_input;
+    wrong_auxiliary_input[0] += value_type::one();
+    BOOST_CHECK(!csr.is_satisfied(example.primary_input, wrong_auxiliary_input));
+    BOOST_CHECK(!cs.is_satisfied(example.primary_input, wrong_auxiliary_input));
+
+    BOOST_CHECK(csr.A.transposed().transposed() == csr.A);
+    BOOST_CHECK(csr.B.transposed().transposed() == csr.B);
+    BOOST_CHECK(csr.C.transposed().transposed() == csr.C);
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_csr_repeated_variables_test) {
+    r1cs_constraint_system<field_type> cs;
+    cs.primary_input_size = 1;
+    cs.auxiliary_input_size = 2;
+
+    math::linear_variable<field_type> x1(1), x2(2), x3(3);
+    // (x1 + x2 + x1) * x2 = x3
+    cs.add_constraint(r1cs_constraint<field_type>({x1, x2, x1}, {x2}, {x3}));
+
+    const r1cs_csr_constraint_system<field_type> csr(cs);
+    BOOST_CHECK_EQUAL(csr.A.num_nonzeros(), 2u);
+    BOOST_CHECK(csr.A.columns == std::vector<std::size_t>({1, 2}));
+    BOOST_CHECK(csr.A.values == std::vector<value_type>({value_type(2u), value_type::one()}));
+
+    const r1cs_primary_input<field_type> primary_input = {value_type(3u)};
+    const r1cs_auxiliary_input<field_type> auxiliary_input = {value_type(5u), value_type(55u)};
+    BOOST_CHECK(cs.is_satisfied(primary_input, auxiliary_input));
+    BOOST_CHECK(csr.is_satisfied(primary_input, auxiliary_input));
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_csr_qap_test) {
+    const r1cs_example<field_type> example = generate_r1cs_example_with_binary_input<field_type>(200, 10);
+    const r1cs_constraint_system<field_type> &cs = example.constraint_system;
+    const r1cs_csr_constraint_system<field_type> csr(cs);
+
+    const value_type t = algebra::random_element<field_type>(), d1 = algebra::random_element<field_type>(),
+                     d2 = algebra::random_element<field_type>(), d3 = algebra::random_element<field_type>();
+
+    const qap_instance<field_type> instance = reductions::r1cs_to_qap<field_type>::instance_map(csr);
+    const qap_instance_evaluation<field_type> instance_evaluation =
+        reductions::r1cs_to_qap<field_type>::instance_map_with_evaluation(csr, t);
+    const qap_witness<field_type> witness = reductions::r1cs_to_qap<field_type>::witness_map(
+        csr, example.primary_input, example.auxiliary_input, d1, d2, d3);
+
+    BOOST_CHECK(instance.is_satisfied(witness));
+    BOOST_CHECK(instance_evaluation.is_satisfied(witness));
+
+    // Reference evaluation straight from the linear combinations
+    const std::vector<value_type> u = instance_evaluation.domain->evaluate_all_lagrange_polynomials(t);
+    std::vector<value_type> At(cs.num_variables() + 1, value_type::zero()),
+        Bt(cs.num_variables() + 1, value_type::zero()), Ct(cs.num_variables() + 1, value_type::zero());
+    for (std::size_t i = 0; i <= cs.num_inputs(); ++i) {
+        At[i] = u[cs.num_constraints() + i];
+    }
+    for (std::size_t i = 0; i < cs.num_constraints(); ++i) {
+        for (const auto &term : cs.constraints[i].a.terms) {
+            At[term.index] += u[i] * term.coeff;
+        }
+        for (const auto &term : cs.constraints[i].b.terms) {
+            Bt[term.index] += u[i] * term.coeff;
+        }
+        for (const auto &term : cs.constraints[i].c.terms) {
+            Ct[term.index] += u[i] * term.coeff;
+        }
+    }
+
+    BOOST_CHECK(instance_evaluation.At == At);
+    BOOST_CHECK(instance_evaluation.Bt == Bt);
+    BOOST_CHECK(instance_evaluation.Ct == Ct);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
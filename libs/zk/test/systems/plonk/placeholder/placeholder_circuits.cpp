@@ -74,6 +74,19 @@ BOOST_AUTO_TEST_SUITE(placeholder_circuits)
         BOOST_CHECK(test_runner.run_test());
     }
 
+    BOOST_AUTO_TEST_CASE(circuit2_cached_preprocessing)
+    {
+        test_tools::random_test_initializer<field_type> random_test_initializer;
+        auto pi0 = random_test_initializer.alg_random_engines.template get_alg_engine<field_type>()();
+        auto circuit = circuit_test_t<field_type>(
+                pi0,
+                random_test_initializer.alg_random_engines.template get_alg_engine<field_type>(),
+                random_test_initializer.generic_random_engine
+        );
+        test_runner_type test_runner(circuit);
+        BOOST_CHECK(test_runner.run_cached_test());
+    }
+
     BOOST_AUTO_TEST_CASE(circuit3)
     {
         test_tools::random_test_initializer<field_type> random_test_initializer;
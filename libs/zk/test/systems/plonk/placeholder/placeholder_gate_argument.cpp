@@ -143,11 +143,21 @@ BOOST_AUTO_TEST_SUITE(placeholder_gate_argument)
         mask_polynomial -= preprocessed_public_data.q_last;
         mask_polynomial -= preprocessed_public_data.q_blind;
 
+        transcript::fiat_shamir_heuristic_sequential<placeholder_test_params::transcript_hash_type> budgeted_transcript =
+                prover_transcript;
+
         std::array<math::polynomial_dfs<typename field_type::value_type>, 1> prover_res =
                 placeholder_gates_argument<field_type, lpc_placeholder_params_type>::prove_eval(
                         constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain,
                         preprocessed_public_data.common_data.max_gates_degree, mask_polynomial, prover_transcript);
 
+        // A budget below one column evaluates the gates one by one
+        std::array<math::polynomial_dfs<typename field_type::value_type>, 1> budgeted_res =
+                placeholder_gates_argument<field_type, lpc_placeholder_params_type>::prove_eval(
+                        constraint_system, polynomial_table, preprocessed_public_data.common_data.basic_domain,
+                        preprocessed_public_data.common_data.max_gates_degree, mask_polynomial, budgeted_transcript, 1);
+        BOOST_CHECK(budgeted_res[0] == prover_res[0]);
+
         // Challenge phase
         typename field_type::value_type y = algebra::random_element<field_type>();
         typename field_type::value_type omega = preprocessed_public_data.common_data.basic_domain->get_domain_element(
@@ -33,6 +33,7 @@
 #include <cmath>
 #include <utility>
 
+#include <nil/crypto3/zk/snark/systems/plonk/placeholder/preprocessor_cache.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/prover.hpp>
 #include <nil/crypto3/zk/snark/systems/plonk/placeholder/verifier.hpp>
 
@@ -109,6 +110,32 @@ struct placeholder_test_runner {
         return verifier_res;
     }
 
+    // Proves twice through the public preprocessor cache, the second time from the cached entry.
+    bool run_cached_test() {
+        placeholder_public_preprocessor_cache<field_type, lpc_placeholder_params_type> cache;
+        bool verifier_res = true;
+
+        for (std::size_t i = 0; i < 2; ++i) {
+            auto cached = cache.process(
+                    constraint_system, circuit.table.public_table(), desc, lpc_scheme_type(fri_params),
+                    max_quotient_poly_chunks);
+            auto &lpc_preprocessed_public_data = cached.preprocessed_data;
+            auto &lpc_scheme = cached.commitment_scheme;
+
+            typename placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::preprocessed_data_type
+                    lpc_preprocessed_private_data = placeholder_private_preprocessor<field_type, lpc_placeholder_params_type>::process(
+                    constraint_system, circuit.table.private_table(), desc);
+
+            auto lpc_proof = placeholder_prover<field_type, lpc_placeholder_params_type>::process(
+                    lpc_preprocessed_public_data, std::move(lpc_preprocessed_private_data), desc, constraint_system,
+                    lpc_scheme);
+
+            verifier_res = verifier_res && placeholder_verifier<field_type, lpc_placeholder_params_type>::process(
+                    lpc_preprocessed_public_data.common_data, lpc_proof, desc, constraint_system, lpc_scheme);
+        }
+        return verifier_res && cache.size() == 1 && cache.hits() == 1;
+    }
+
     circuit_type circuit;
     plonk_table_description<field_type> desc;
     typename policy_type::constraint_system_type constraint_system;
@@ -39,16 +39,24 @@
 #include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/params/multiexp/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/params/wnaf/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
 #include <nil/crypto3/algebra/pairing/bls12.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/test_tools/curve_points.hpp>
 
 #include "../r1cs_examples.hpp"
 #include "run_r1cs_gg_ppzksnark.hpp"
 
+using namespace nil::crypto3::zk;
 using namespace nil::crypto3::zk::snark;
 using namespace nil::crypto3::algebra;
+using nil::crypto3::algebra::test_tools::small_order_point;
 
 template<typename CurveType>
 void run_r1cs_gg_ppzksnark_basic_test(std::size_t num_constraints, std::size_t input_size) {
@@ -58,10 +66,86 @@ void run_r1cs_gg_ppzksnark_basic_test(std::size_t num_constraints, std::size_t i
     BOOST_CHECK(bit);
 }
 
+template<typename CurveType>
+void run_r1cs_gg_ppzksnark_batch_verifier_test(std::size_t num_constraints, std::size_t input_size,
+                                               std::size_t batch_size) {
+    typedef r1cs_gg_ppzksnark<CurveType> proof_system_type;
+    typedef r1cs_gg_ppzksnark_batch_verifier<CurveType> batch_verifier_type;
+
+    r1cs_example<typename CurveType::scalar_field_type> example =
+        generate_r1cs_example_with_binary_input<typename CurveType::scalar_field_type>(num_constraints, input_size);
+
+    typename proof_system_type::keypair_type keypair = generate<proof_system_type>(example.constraint_system);
+    typename proof_system_type::processed_verification_key_type pvk =
+        r1cs_gg_ppzksnark_process_verification_key<CurveType>::process(keypair.second);
+
+    std::vector<typename proof_system_type::primary_input_type> primary_inputs(batch_size, example.primary_input);
+    std::vector<typename proof_system_type::proof_type> proofs;
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        proofs.emplace_back(prove<proof_system_type>(keypair.first, example.primary_input, example.auxiliary_input));
+    }
+
+    BOOST_CHECK(batch_verifier_type::process(keypair.second, primary_inputs, proofs));
+    BOOST_CHECK(batch_verifier_type::process(pvk, primary_inputs, proofs));
+    BOOST_CHECK(batch_verifier_type::invalid_proofs(pvk, primary_inputs, proofs).empty());
+
+    proofs[1].g_C = proofs[1].g_C + CurveType::template g1_type<>::value_type::one();
+    primary_inputs[batch_size - 1][0] += CurveType::scalar_field_type::value_type::one();
+
+    BOOST_CHECK(!batch_verifier_type::process(pvk, primary_inputs, proofs));
+    BOOST_CHECK(batch_verifier_type::invalid_proofs(pvk, primary_inputs, proofs) ==
+                std::vector<std::size_t>({1, batch_size - 1}));
+
+    primary_inputs[0].pop_back();
+    BOOST_CHECK(batch_verifier_type::invalid_proofs(pvk, primary_inputs, proofs) ==
+                std::vector<std::size_t>({0, 1, batch_size - 1}));
+}
+
+template<typename CurveType>
+void run_r1cs_gg_ppzksnark_batch_verifier_small_order_test(std::size_t num_constraints, std::size_t input_size,
+                                                           std::size_t batch_size) {
+    typedef r1cs_gg_ppzksnark<CurveType> proof_system_type;
+    typedef r1cs_gg_ppzksnark_batch_verifier<CurveType> batch_verifier_type;
+    typedef typename CurveType::template g1_type<> g1_type;
+    typedef typename CurveType::template g2_type<> g2_type;
+
+    r1cs_example<typename CurveType::scalar_field_type> example =
+        generate_r1cs_example_with_binary_input<typename CurveType::scalar_field_type>(num_constraints, input_size);
+
+    typename proof_system_type::keypair_type keypair = generate<proof_system_type>(example.constraint_system);
+    typename proof_system_type::processed_verification_key_type pvk =
+        r1cs_gg_ppzksnark_process_verification_key<CurveType>::process(keypair.second);
+
+    std::vector<typename proof_system_type::primary_input_type> primary_inputs(batch_size, example.primary_input);
+    std::vector<typename proof_system_type::proof_type> proofs;
+    for (std::size_t i = 0; i < batch_size; ++i) {
+        proofs.emplace_back(prove<proof_system_type>(keypair.first, example.primary_input, example.auxiliary_input));
+    }
+
+    // on-curve points outside the prime order subgroups are rejected before batching
+    proofs[0].g_A = proofs[0].g_A + small_order_point<g1_type>();
+    proofs[1].g_B = proofs[1].g_B + small_order_point<g2_type>();
+    proofs[2].g_C = proofs[2].g_C + small_order_point<g1_type>();
+    BOOST_CHECK(proofs[0].is_well_formed() && proofs[1].is_well_formed() && proofs[2].is_well_formed());
+
+    BOOST_CHECK(!batch_verifier_type::process(pvk, primary_inputs, proofs));
+    BOOST_CHECK(batch_verifier_type::invalid_proofs(pvk, primary_inputs, proofs) ==
+                std::vector<std::size_t>({0, 1, 2}));
+}
+
 BOOST_AUTO_TEST_SUITE(r1cs_gg_ppzksnark_test_suite)
 
 BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_basic_test) {
     run_r1cs_gg_ppzksnark_basic_test<curves::mnt4<298>>(100, 10);
 }
 
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_batch_verifier_test) {
+    run_r1cs_gg_ppzksnark_batch_verifier_test<curves::mnt4<298>>(100, 10, 5);
+    run_r1cs_gg_ppzksnark_batch_verifier_test<curves::bls12<381>>(100, 10, 8);
+}
+
+BOOST_AUTO_TEST_CASE(r1cs_gg_ppzksnark_batch_verifier_small_order_test) {
+    run_r1cs_gg_ppzksnark_batch_verifier_small_order_test<curves::bls12<381>>(100, 10, 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
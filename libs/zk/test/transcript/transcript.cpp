@@ -66,6 +66,127 @@ BOOST_AUTO_TEST_CASE(zk_transcript_manual_test) {
     BOOST_CHECK_EQUAL(ch_n[2].data, field_type::value_type(0x10bfe2f4a414eec551dda5fd9899e9b46e327648b4fa564ed0517b6a99396aec_cppui_modular254).data);
 }
 
+BOOST_AUTO_TEST_CASE(zk_transcript_absorb_elements_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using hash_type = hashes::keccak_1600<256>;
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<typename field_type::value_type> elements = {
+        field_type::value_type(1), field_type::value_type(0x1234567890abcdef_cppui_modular254),
+        -field_type::value_type::one(), field_type::value_type::zero()};
+
+    transcript::fiat_shamir_heuristic_sequential<hash_type> per_element(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> bulk(init_blob);
+    // Each element used to be packed into a vector and hashed together with the previous state
+    transcript::fiat_shamir_heuristic_sequential<hash_type> packed(init_blob);
+
+    for (const auto &element : elements) {
+        per_element(element);
+
+        nil::marshalling::status_type status;
+        std::vector<std::uint8_t> byte_data =
+            nil::marshalling::pack<nil::marshalling::option::big_endian>(element, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        packed(byte_data);
+    }
+    bulk.absorb_elements(elements);
+
+    auto expected = per_element.challenge<field_type>();
+    BOOST_CHECK_EQUAL(bulk.challenge<field_type>().data, expected.data);
+
+    auto packed_challenge = packed.challenge<field_type>();
+    BOOST_CHECK_EQUAL(packed_challenge.data, expected.data);
+}
+
+BOOST_AUTO_TEST_CASE(zk_transcript_absorb_group_elements_test) {
+    using curve_type = algebra::curves::bls12_381;
+    using field_type = typename curve_type::scalar_field_type;
+    using g1_type = typename curve_type::template g1_type<>;
+    using hash_type = hashes::keccak_1600<256>;
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<typename g1_type::value_type> elements = {
+        g1_type::value_type::one(), g1_type::value_type::zero(), g1_type::value_type::one().doubled(),
+        -g1_type::value_type::one()};
+
+    transcript::fiat_shamir_heuristic_sequential<hash_type> per_element(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> bulk(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> packed(init_blob);
+
+    for (const auto &element : elements) {
+        per_element(element);
+
+        nil::marshalling::status_type status;
+        std::vector<std::uint8_t> byte_data =
+            nil::marshalling::pack<nil::marshalling::option::big_endian>(element, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        packed(byte_data);
+    }
+    bulk.absorb_elements(elements);
+
+    auto expected = per_element.challenge<field_type>();
+    BOOST_CHECK_EQUAL(bulk.challenge<field_type>().data, expected.data);
+    BOOST_CHECK_EQUAL(packed.challenge<field_type>().data, expected.data);
+
+    // The order of the elements matters
+    transcript::fiat_shamir_heuristic_sequential<hash_type> reversed(init_blob);
+    reversed.absorb_elements(elements.rbegin(), elements.rend());
+    BOOST_CHECK(reversed.challenge<field_type>() != expected);
+}
+
+BOOST_AUTO_TEST_CASE(zk_transcript_absorb_bytes_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using hash_type = hashes::keccak_1600<256>;
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<std::uint8_t> data {0xde, 0xad, 0xbe, 0xef, 0x00, 0xff};
+
+    transcript::fiat_shamir_heuristic_sequential<hash_type> range(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> iterators(init_blob);
+    range(data);
+    iterators(data.begin(), data.end());
+
+    // Absorbing sets the state to H(state || data)
+    typename hash_type::digest_type init_state = hash<hash_type>(init_blob);
+    std::vector<std::uint8_t> state_and_data(init_state.begin(), init_state.end());
+    state_and_data.insert(state_and_data.end(), data.begin(), data.end());
+    transcript::fiat_shamir_heuristic_sequential<hash_type> expected(state_and_data);
+
+    auto expected_challenge = expected.challenge<field_type>();
+    BOOST_CHECK_EQUAL(range.challenge<field_type>().data, expected_challenge.data);
+    BOOST_CHECK_EQUAL(iterators.challenge<field_type>().data, expected_challenge.data);
+
+    // Every absorb is hashed on its own, so splitting the bytes changes the challenges
+    transcript::fiat_shamir_heuristic_sequential<hash_type> split(init_blob);
+    split(data.begin(), data.begin() + 3);
+    split(data.begin() + 3, data.end());
+    BOOST_CHECK(split.challenge<field_type>() != expected_challenge);
+}
+
+BOOST_AUTO_TEST_CASE(zk_transcript_domain_separator_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using hash_type = hashes::keccak_1600<256>;
+    std::vector<std::uint8_t> domain {'p', 'l', 'a', 'c', 'e', 'h', 'o', 'l', 'd', 'e', 'r'};
+    std::vector<std::uint8_t> other_domain {'p', 'l', 'a', 'c', 'e', 'h', 'o', 'l', 'd', 'e', 's'};
+    std::vector<std::uint8_t> data {1, 2, 3};
+
+    transcript::fiat_shamir_heuristic_sequential<hash_type> tr(domain);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> same(domain);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> other(other_domain);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> none;
+    tr(data);
+    same(data);
+    other(data);
+    none(data);
+
+    auto ch = tr.challenges<field_type, 2>();
+    BOOST_CHECK(same.challenges<field_type, 2>() == ch);
+
+    auto other_ch = other.challenges<field_type, 2>();
+    auto none_ch = none.challenges<field_type, 2>();
+    for (std::size_t i = 0; i < ch.size(); i++) {
+        BOOST_CHECK(other_ch[i] != ch[i]);
+        BOOST_CHECK(none_ch[i] != ch[i]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -100,6 +221,51 @@ BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_init_test) {
     BOOST_CHECK_EQUAL(ch_int, 0xC92);
 }
 
+BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_domain_separator_test) {
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+
+    std::vector<std::uint8_t> domain {'p', 'l', 'a', 'c', 'e', 'h', 'o', 'l', 'd', 'e', 'r'};
+    std::vector<std::uint8_t> other_domain {'p', 'l', 'a', 'c', 'e', 'h', 'o', 'l', 'd', 'e', 's'};
+
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> tr{
+        hashes::block_to_field_elements_wrapper<field_type, std::vector<std::uint8_t>>(domain)};
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> same{
+        hashes::block_to_field_elements_wrapper<field_type, std::vector<std::uint8_t>>(domain)};
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> other{
+        hashes::block_to_field_elements_wrapper<field_type, std::vector<std::uint8_t>>(other_domain)};
+    tr(field_type::value_type(42));
+    same(field_type::value_type(42));
+    other(field_type::value_type(42));
+
+    auto ch = tr.challenge<field_type>();
+    BOOST_CHECK_EQUAL(same.challenge<field_type>().data, ch.data);
+    BOOST_CHECK(other.challenge<field_type>() != ch);
+}
+
+BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_group_elements_test) {
+    using curve_type = algebra::curves::pallas;
+    using field_type = typename curve_type::base_field_type;
+    using g1_type = typename curve_type::template g1_type<>;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>>;
+
+    std::vector<typename g1_type::value_type> elements = {
+        g1_type::value_type::one(), g1_type::value_type::one().doubled()};
+
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> bulk;
+    // A point is absorbed as its affine coordinates
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> coordinates;
+    bulk.absorb_elements(elements);
+    for (const auto &element : elements) {
+        auto affine = element.to_affine();
+        coordinates(affine.X);
+        coordinates(affine.Y);
+    }
+
+    BOOST_CHECK_EQUAL(bulk.challenge<field_type>().data, coordinates.challenge<field_type>().data);
+}
+
 BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_no_init_test) {
     using curve_type = algebra::curves::pallas;
     using field_type = typename curve_type::base_field_type;